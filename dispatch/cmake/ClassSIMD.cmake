@@ -52,9 +52,10 @@ function(fastsimd_add_feature_set_source fastsimd_library_sources feature_set is
                 if(is_relaxed)
                     set_property(SOURCE ${feature_set_source} APPEND PROPERTY COMPILE_OPTIONS -mfma)
                 else()
-                    set_property(SOURCE ${feature_set_source} APPEND PROPERTY COMPILE_OPTIONS -mno-fma)
+                    # -mavx512f implies FMA again, stop the compiler contracting mul + add instead
+                    set_property(SOURCE ${feature_set_source} APPEND PROPERTY COMPILE_OPTIONS -ffp-contract=off)
                 endif()
-                set_property(SOURCE ${feature_set_source} APPEND PROPERTY COMPILE_OPTIONS -mavx512f -mavx512dq -mavx512vl -mavx512bw)
+                set_property(SOURCE ${feature_set_source} APPEND PROPERTY COMPILE_OPTIONS -mavx512f -mavx512dq -mavx512vl -mavx512bw -mavx512cd)
 
             elseif(${feature_set} MATCHES WASM)
                 if(is_relaxed)
@@ -67,7 +68,7 @@ endfunction()
 
 function(fastsimd_create_dispatch_library simd_library_name)
 
-    cmake_parse_arguments(PARSE_ARGV 0 fastsimd_create_dispatch_library "RELAXED" "" "SOURCES;FEATURE_SETS")
+    cmake_parse_arguments(PARSE_ARGV 0 fastsimd_create_dispatch_library "RELAXED;DETERMINISTIC" "" "SOURCES;FEATURE_SETS")
 
     list(LENGTH fastsimd_create_dispatch_library_FEATURE_SETS FEATURE_SET_COUNT)
     list(LENGTH fastsimd_create_dispatch_library_SOURCES SOURCES_COUNT)
@@ -76,6 +77,10 @@ function(fastsimd_create_dispatch_library simd_library_name)
         message(FATAL_ERROR "FastSIMD: \"${simd_library_name}\" No SOURCES specified, example usage: fastsimd_create_dispatch_library(example_simd SOURCES \"example.inl\")")
     endif()
 
+    if(fastsimd_create_dispatch_library_RELAXED AND fastsimd_create_dispatch_library_DETERMINISTIC)
+        message(FATAL_ERROR "FastSIMD: \"${simd_library_name}\" RELAXED and DETERMINISTIC can not be used together")
+    endif()
+
     if(FEATURE_SET_COUNT EQUAL 0)
         message("FastSIMD: \"${simd_library_name}\" No FEATURE_SETS specified, using default feature sets")
         set(fastsimd_create_dispatch_library_FEATURE_SETS
@@ -116,10 +121,24 @@ function(fastsimd_create_dispatch_library simd_library_name)
         set(relaxed_log_msg " (RELAXED)")
     endif()
 
+    # Bit identical results on every feature set: no FMA contraction and no approximate instructions
+    if(fastsimd_create_dispatch_library_DETERMINISTIC)
+        target_compile_definitions(${simd_library_name} PUBLIC FASTSIMD_IS_DETERMINISTIC=1)
+        if(NOT CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
+            target_compile_options(${simd_library_name} PRIVATE -ffp-contract=off)
+        endif()
+        set(relaxed_log_msg " (DETERMINISTIC)")
+    endif()
+
     set(feature_set_list "")
     set(feature_set_list_debug "")
 
     foreach(feature_set ${fastsimd_create_dispatch_library_FEATURE_SETS})
+        # 32 bit NEON flushes denormals to zero, fall back to SCALAR instead
+        if(fastsimd_create_dispatch_library_DETERMINISTIC AND feature_set STREQUAL "NEON")
+            continue()
+        endif()
+
         if(APPLE AND (NOT CMAKE_OSX_ARCHITECTURES STREQUAL "") AND (NOT feature_set STREQUAL "SCALAR"))
             # Loop through OSX arches and test compile on each separately
             foreach(CMAKE_OSX_ARCHITECTURES ${CMAKE_OSX_ARCHITECTURES})
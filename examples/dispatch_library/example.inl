@@ -21,7 +21,9 @@ class FastSIMD::DispatchClass<ExampleSIMD, SIMD> : public ExampleSIMD
         auto vMultiplier = FS::f32<N>( multiplier );
         auto vCutoff     = FS::f32<N>( cutoff );
 
-        for( std::size_t i = 0; i < dataSize; i += N )
+        std::size_t i = 0;
+
+        for( ; i + N <= dataSize; i += N )
         {
             FS::f32<N> data = FS::Load<N>( in + i );
 
@@ -29,6 +31,16 @@ class FastSIMD::DispatchClass<ExampleSIMD, SIMD> : public ExampleSIMD
 
             FS::Store( out + i, data );
         }
+
+        // Remaining elements, no scalar epilogue or padding required
+        if( i < dataSize )
+        {
+            FS::f32<N> data = FS::LoadPartial<N>( in + i, dataSize - i );
+
+            data = FS::Select( data < vCutoff, data * vMultiplier, data );
+
+            FS::StorePartial( out + i, data, dataSize - i );
+        }
     }
 };
 
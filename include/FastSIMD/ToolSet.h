@@ -18,6 +18,13 @@ namespace FastSIMD
     {
         return RELAXED;
     }
+
+    // Results are bit identical across all FeatureSets, see DETERMINISTIC in fastsimd_create_dispatch_library
+    template<auto = 0, bool DETERMINISTIC = FASTSIMD_IS_DETERMINISTIC>
+    static constexpr bool IsDeterministic()
+    {
+        return DETERMINISTIC;
+    }
 } // namespace FastSIMD
 
 #include "ToolSet/Generic/Functions.h"
@@ -252,4 +252,120 @@ namespace FS
     {
         return vmlsq_f32( c.native, a.native, b.native );
     }
+
+
+    template<std::size_t C, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE std::array<f32<4, SIMD>, C> LoadInterleaved( TypeWrapper<const float*, 4, SIMD> ptr )
+    {
+        if constexpr( C == 2 )
+        {
+            auto r = vld2q_f32( ptr.value );
+            return { r.val[0], r.val[1] };
+        }
+        else if constexpr( C == 3 )
+        {
+            auto r = vld3q_f32( ptr.value );
+            return { r.val[0], r.val[1], r.val[2] };
+        }
+        else
+        {
+            auto r = vld4q_f32( ptr.value );
+            return { r.val[0], r.val[1], r.val[2], r.val[3] };
+        }
+    }
+
+    template<std::size_t C, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE void StoreInterleaved( typename f32<4, SIMD>::ElementType* ptr, const std::array<f32<4, SIMD>, C>& a )
+    {
+        if constexpr( C == 2 )
+        {
+            vst2q_f32( ptr, { { a[0].native, a[1].native } } );
+        }
+        else if constexpr( C == 3 )
+        {
+            vst3q_f32( ptr, { { a[0].native, a[1].native, a[2].native } } );
+        }
+        else
+        {
+            vst4q_f32( ptr, { { a[0].native, a[1].native, a[2].native, a[3].native } } );
+        }
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE float ReduceAdd( const f32<4, SIMD>& a )
+    {
+        /* add halves before the pairwise add to match the reduction order of other ToolSets */
+        float32x2_t tmp = vadd_f32( vget_low_f32( a.native ), vget_high_f32( a.native ) );
+        return vget_lane_f32( vpadd_f32( tmp, tmp ), 0 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE float ReduceMin( const f32<4, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vminvq_f32( a.native );
+        }
+        else
+        {
+            float32x2_t tmp = vmin_f32( vget_low_f32( a.native ), vget_high_f32( a.native ) );
+            return vget_lane_f32( vpmin_f32( tmp, tmp ), 0 );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE float ReduceMax( const f32<4, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vmaxvq_f32( a.native );
+        }
+        else
+        {
+            float32x2_t tmp = vmax_f32( vget_low_f32( a.native ), vget_high_f32( a.native ) );
+            return vget_lane_f32( vpmax_f32( tmp, tmp ), 0 );
+        }
+    }
+
+
+    template<std::size_t... I, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Shuffle( const f32<4, SIMD>& a, std::index_sequence<I...> )
+    {
+        return Permute( a, Constant<std::int32_t, SIMD>( static_cast<std::int32_t>( I )... ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Permute( const f32<4, SIMD>& a, const i32<4, SIMD>& idx )
+    {
+        /* spread each element index to the 4 byte indices it covers */
+        uint32x4_t elementIdx = vandq_u32( vreinterpretq_u32_s32( idx.native ), vdupq_n_u32( 3 ) );
+        u8<16, SIMD> byteIdx = vreinterpretq_u8_u32( vmlaq_n_u32( vdupq_n_u32( 0x03020100 ), elementIdx, 0x04040404 ) );
+
+        return vreinterpretq_f32_u8( TableLookup( u8<16, SIMD>( vreinterpretq_u8_f32( a.native ) ), byteIdx ).native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> PrefixSum( const f32<4, SIMD>& a )
+    {
+        const float32x4_t zero = vdupq_n_f32( 0 );
+        float32x4_t sum = vaddq_f32( a.native, vextq_f32( zero, a.native, 3 ) );
+        return vaddq_f32( sum, vextq_f32( zero, sum, 2 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Compress( const typename f32<4, SIMD>::MaskTypeArg& mask, const f32<4, SIMD>& a )
+    {
+        u8<16, SIMD> shuffle = vld1q_u8( impl::CompressByteTable4x32[BitMask( mask )].data() );
+
+        return vreinterpretq_f32_u8( TableLookup( u8<16, SIMD>( vreinterpretq_u8_f32( a.native ) ), shuffle ).native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Expand( const typename f32<4, SIMD>::MaskTypeArg& mask, const f32<4, SIMD>& a )
+    {
+        u8<16, SIMD> shuffle = vld1q_u8( impl::ExpandByteTable4x32[BitMask( mask )].data() );
+
+        return vreinterpretq_f32_u8( TableLookup( u8<16, SIMD>( vreinterpretq_u8_f32( a.native ) ), shuffle ).native );
+    }
 }
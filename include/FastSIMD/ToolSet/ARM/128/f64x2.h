@@ -0,0 +1,211 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<double, 2, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AARCH64>>
+    {
+        static constexpr size_t ElementCount = 2;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = float64x2_t;
+        using ElementType = double;
+        using MaskType = m64<ElementCount, true, SIMD>;
+        using MaskTypeArg = m64<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( double v ) : native( vdupq_n_f64( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = vaddq_f64( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = vsubq_f64( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = vmulq_f64( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator /=( const Register& rhs )
+        {
+            native = vdivq_f64( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = vreinterpretq_f64_u64( vandq_u64( vreinterpretq_u64_f64( native ), vreinterpretq_u64_f64( rhs.native ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = vreinterpretq_f64_u64( vorrq_u64( vreinterpretq_u64_f64( native ), vreinterpretq_u64_f64( rhs.native ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = vreinterpretq_f64_u64( veorq_u64( vreinterpretq_u64_f64( native ), vreinterpretq_u64_f64( rhs.native ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator~() const
+        {
+            return vreinterpretq_f64_u32( vmvnq_u32( vreinterpretq_u32_f64( native ) ) );
+        }
+
+        FS_FORCEINLINE Register operator-() const
+        {
+            return vnegq_f64( native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return vceqq_f64( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~( *this == rhs );
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return vcgeq_f64( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return vcleq_f64( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return vcgtq_f64( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return vcltq_f64( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Load( TypeWrapper<const double*, 2, SIMD> ptr )
+    {
+        return vld1q_f64( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE void Store( typename f64<2, SIMD>::ElementType* ptr, const f64<2, SIMD>& a )
+    {
+        vst1q_f64( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE double Extract0( const f64<2, SIMD>& a )
+    {
+        return vgetq_lane_f64( a.native, 0 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Abs( const f64<2, SIMD>& a )
+    {
+        return vabsq_f64( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Round( const f64<2, SIMD>& a )
+    {
+        return vrndnq_f64( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Floor( const f64<2, SIMD>& a )
+    {
+        return vrndmq_f64( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Ceil( const f64<2, SIMD>& a )
+    {
+        return vrndpq_f64( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Trunc( const f64<2, SIMD>& a )
+    {
+        return vrndq_f64( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Min( const f64<2, SIMD>& a, const f64<2, SIMD>& b )
+    {
+        return vminq_f64( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Max( const f64<2, SIMD>& a, const f64<2, SIMD>& b )
+    {
+        return vmaxq_f64( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Select( const typename f64<2, SIMD>::MaskTypeArg& mask, const f64<2, SIMD>& ifTrue, const f64<2, SIMD>& ifFalse )
+    {
+        return vbslq_f64( mask.native, ifTrue.native, ifFalse.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Masked( const typename f64<2, SIMD>::MaskTypeArg& mask, const f64<2, SIMD>& a )
+    {
+        return vreinterpretq_f64_u64( vandq_u64( vreinterpretq_u64_f64( a.native ), mask.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> InvMasked( const typename f64<2, SIMD>::MaskTypeArg& mask, const f64<2, SIMD>& a )
+    {
+        return vreinterpretq_f64_u64( vbicq_u64( vreinterpretq_u64_f64( a.native ), mask.native ) );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Sqrt( const f64<2, SIMD>& a )
+    {
+        return vsqrtq_f64( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>, typename = EnableIfRelaxed<SIMD>>
+    FS_FORCEINLINE f64<2, SIMD> FMulAdd( const f64<2, SIMD>& a, const f64<2, SIMD>& b, const f64<2, SIMD>& c )
+    {
+        return vfmaq_f64( c.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>, typename = EnableIfRelaxed<SIMD>>
+    FS_FORCEINLINE f64<2, SIMD> FNMulAdd( const f64<2, SIMD>& a, const f64<2, SIMD>& b, const f64<2, SIMD>& c )
+    {
+        return vfmsq_f64( c.native, a.native, b.native );
+    }
+}
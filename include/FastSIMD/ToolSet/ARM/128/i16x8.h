@@ -0,0 +1,199 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int16_t, 8, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::NEON>>
+    {
+        static constexpr size_t ElementCount = 8;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = int16x8_t;
+        using ElementType = std::int16_t;
+        using MaskType = m16<ElementCount, false, SIMD>;
+        using MaskTypeArg = m16<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int16_t v ) : native( vdupq_n_s16( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = vaddq_s16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = vsubq_s16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = vmulq_s16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = vandq_s16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = vorrq_s16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = veorq_s16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = vshlq_s16( native, vdupq_n_s16( -rhs ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = vshlq_s16( native, vdupq_n_s16( rhs ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return vmvnq_s16( native );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return vnegq_s16( native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return vceqq_s16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return vcgeq_s16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return vcleq_s16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return vcgtq_s16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return vcltq_s16( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Load( TypeWrapper<const std::int16_t*, 8, SIMD> ptr )
+    {
+        return vld1q_s16( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE void Store( typename i16<8, SIMD>::ElementType* ptr, const i16<8, SIMD>& a )
+    {
+        vst1q_s16( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE std::int16_t Extract0( const i16<8, SIMD>& a )
+    {
+        return vgetq_lane_s16( a.native, 0 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Abs( const i16<8, SIMD>& a )
+    {
+        return vabsq_s16( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Min( const i16<8, SIMD>& a, const i16<8, SIMD>& b )
+    {
+        return vminq_s16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Max( const i16<8, SIMD>& a, const i16<8, SIMD>& b )
+    {
+        return vmaxq_s16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Select( const typename i16<8, SIMD>::MaskTypeArg& mask, const i16<8, SIMD>& ifTrue, const i16<8, SIMD>& ifFalse )
+    {
+        return vbslq_s16( mask.native, ifTrue.native, ifFalse.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> BitShiftRightZeroExtend( const i16<8, SIMD>& a, int b )
+    {
+        return vreinterpretq_s16_u16( vshlq_u16( vreinterpretq_u16_s16( a.native ), vdupq_n_s16( -b ) ) );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Masked( const typename i16<8, SIMD>::MaskTypeArg& mask, const i16<8, SIMD>& a )
+    {
+        return vandq_s16( vreinterpretq_s16_u16( mask.native ), a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> MaskedIncrement( const typename i16<8, SIMD>::MaskTypeArg& mask, const i16<8, SIMD>& a )
+    {
+        return vsubq_s16( a.native, vreinterpretq_s16_u16( mask.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> MaskedDecrement( const typename i16<8, SIMD>::MaskTypeArg& mask, const i16<8, SIMD>& a )
+    {
+        return vaddq_s16( a.native, vreinterpretq_s16_u16( mask.native ) );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> AddSat( const i16<8, SIMD>& a, const i16<8, SIMD>& b )
+    {
+        return vqaddq_s16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> SubSat( const i16<8, SIMD>& a, const i16<8, SIMD>& b )
+    {
+        return vqsubq_s16( a.native, b.native );
+    }
+}
@@ -72,6 +72,18 @@ namespace FS
             return *this;
         }
 
+        FS_FORCEINLINE Register& operator >>=( const Register& rhs )
+        {
+            native = vshlq_s32( native, vnegq_s32( rhs.native ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( const Register& rhs )
+        {
+            native = vshlq_s32( native, rhs.native );
+            return *this;
+        }
+
         FS_FORCEINLINE Register operator ~() const
         {
             return vmvnq_s32( native );        
@@ -183,4 +195,153 @@ namespace FS
     {
         return vaddq_s32( a.native, vreinterpretq_s32_u32( mask.native ) );    
     }
+
+
+    template<std::size_t C, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE std::array<i32<4, SIMD>, C> LoadInterleaved( TypeWrapper<const std::int32_t*, 4, SIMD> ptr )
+    {
+        if constexpr( C == 2 )
+        {
+            auto r = vld2q_s32( ptr.value );
+            return { r.val[0], r.val[1] };
+        }
+        else if constexpr( C == 3 )
+        {
+            auto r = vld3q_s32( ptr.value );
+            return { r.val[0], r.val[1], r.val[2] };
+        }
+        else
+        {
+            auto r = vld4q_s32( ptr.value );
+            return { r.val[0], r.val[1], r.val[2], r.val[3] };
+        }
+    }
+
+    template<std::size_t C, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE void StoreInterleaved( typename i32<4, SIMD>::ElementType* ptr, const std::array<i32<4, SIMD>, C>& a )
+    {
+        if constexpr( C == 2 )
+        {
+            vst2q_s32( ptr, { { a[0].native, a[1].native } } );
+        }
+        else if constexpr( C == 3 )
+        {
+            vst3q_s32( ptr, { { a[0].native, a[1].native, a[2].native } } );
+        }
+        else
+        {
+            vst4q_s32( ptr, { { a[0].native, a[1].native, a[2].native, a[3].native } } );
+        }
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE std::int32_t ReduceAdd( const i32<4, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vaddvq_s32( a.native );
+        }
+        else
+        {
+            int32x2_t tmp = vadd_s32( vget_low_s32( a.native ), vget_high_s32( a.native ) );
+            return vget_lane_s32( vpadd_s32( tmp, tmp ), 0 );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE std::int32_t ReduceMin( const i32<4, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vminvq_s32( a.native );
+        }
+        else
+        {
+            int32x2_t tmp = vmin_s32( vget_low_s32( a.native ), vget_high_s32( a.native ) );
+            return vget_lane_s32( vpmin_s32( tmp, tmp ), 0 );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE std::int32_t ReduceMax( const i32<4, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vmaxvq_s32( a.native );
+        }
+        else
+        {
+            int32x2_t tmp = vmax_s32( vget_low_s32( a.native ), vget_high_s32( a.native ) );
+            return vget_lane_s32( vpmax_s32( tmp, tmp ), 0 );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> PrefixSum( const i32<4, SIMD>& a )
+    {
+        const int32x4_t zero = vdupq_n_s32( 0 );
+        int32x4_t sum = vaddq_s32( a.native, vextq_s32( zero, a.native, 3 ) );
+        return vaddq_s32( sum, vextq_s32( zero, sum, 2 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> MulHi( const i32<4, SIMD>& a, const i32<4, SIMD>& b )
+    {
+        int32x4_t low = vreinterpretq_s32_s64( vmull_s32( vget_low_s32( a.native ), vget_low_s32( b.native ) ) );
+        int32x4_t high = vreinterpretq_s32_s64( vmull_s32( vget_high_s32( a.native ), vget_high_s32( b.native ) ) );
+        return vuzpq_s32( low, high ).val[1];
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MulWidenEven( const i32<4, SIMD>& a, const i32<4, SIMD>& b )
+    {
+        return vmull_s32( vmovn_s64( vreinterpretq_s64_s32( a.native ) ), vmovn_s64( vreinterpretq_s64_s32( b.native ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MulWidenOdd( const i32<4, SIMD>& a, const i32<4, SIMD>& b )
+    {
+        return vmull_s32( vshrn_n_s64( vreinterpretq_s64_s32( a.native ), 32 ), vshrn_n_s64( vreinterpretq_s64_s32( b.native ), 32 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> AddSat( const i32<4, SIMD>& a, const i32<4, SIMD>& b )
+    {
+        return vqaddq_s32( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> SubSat( const i32<4, SIMD>& a, const i32<4, SIMD>& b )
+    {
+        return vqsubq_s32( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> PopCount( const i32<4, SIMD>& a )
+    {
+        return vreinterpretq_s32_u32( vpaddlq_u16( vpaddlq_u8( vcntq_u8( vreinterpretq_u8_s32( a.native ) ) ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> CountLeadingZeros( const i32<4, SIMD>& a )
+    {
+        return vclzq_s32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> Compress( const typename i32<4, SIMD>::MaskTypeArg& mask, const i32<4, SIMD>& a )
+    {
+        u8<16, SIMD> shuffle = vld1q_u8( impl::CompressByteTable4x32[BitMask( mask )].data() );
+
+        return vreinterpretq_s32_u8( TableLookup( u8<16, SIMD>( vreinterpretq_u8_s32( a.native ) ), shuffle ).native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> Expand( const typename i32<4, SIMD>::MaskTypeArg& mask, const i32<4, SIMD>& a )
+    {
+        u8<16, SIMD> shuffle = vld1q_u8( impl::ExpandByteTable4x32[BitMask( mask )].data() );
+
+        return vreinterpretq_s32_u8( TableLookup( u8<16, SIMD>( vreinterpretq_u8_s32( a.native ) ), shuffle ).native );
+    }
 }
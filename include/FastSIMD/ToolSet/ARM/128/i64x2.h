@@ -0,0 +1,199 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int64_t, 2, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AARCH64>>
+    {
+        static constexpr size_t ElementCount = 2;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = int64x2_t;
+        using ElementType = std::int64_t;
+        using MaskType = m64<ElementCount, false, SIMD>;
+        using MaskTypeArg = m64<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int64_t v ) : native( vdupq_n_s64( v ) ) { }
+        
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = vaddq_s64( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = vsubq_s64( native, rhs.native );
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            /* no 64 bit multiply, build it from 32x32->64 widening multiplies */
+            uint64x2_t a = vreinterpretq_u64_s64( native );
+            uint64x2_t b = vreinterpretq_u64_s64( rhs.native );
+            uint32x2_t aLo = vmovn_u64( a );
+            uint32x2_t bLo = vmovn_u64( b );
+            uint64x2_t cross = vmull_u32( aLo, vshrn_n_u64( b, 32 ) );
+            cross = vmlal_u32( cross, vshrn_n_u64( a, 32 ), bLo );
+            native = vreinterpretq_s64_u64( vmlal_u32( vshlq_n_u64( cross, 32 ), aLo, bLo ) );
+            return *this;
+        }
+            
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = vandq_s64( native, rhs.native );
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = vorrq_s64( native, rhs.native );
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = veorq_s64( native, rhs.native );
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = vshlq_s64( native, vdupq_n_s64( -rhs ) );
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = vshlq_s64( native, vdupq_n_s64( rhs ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return vreinterpretq_s64_s32( vmvnq_s32( vreinterpretq_s32_s64( native ) ) );        
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return vnegq_s64( native );
+        }
+
+        
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return vceqq_s64( native, rhs.native );
+        }
+        
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+        
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return vcgeq_s64( native, rhs.native );
+        }
+        
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return vcleq_s64( native, rhs.native );
+        }
+        
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return vcgtq_s64( native, rhs.native );
+        }
+        
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return vcltq_s64( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+    
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Load( TypeWrapper<const std::int64_t*, 2, SIMD> ptr )
+    {
+        return vld1q_s64( ptr.value );
+    }
+    
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE void Store( typename i64<2, SIMD>::ElementType* ptr, const i64<2, SIMD>& a )
+    {
+        vst1q_s64( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE std::int64_t Extract0( const i64<2, SIMD>& a )
+    {
+        return vgetq_lane_s64( a.native, 0 );
+    }
+        
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Abs( const i64<2, SIMD>& a )
+    {
+        return vabsq_s64( a.native );
+    }
+        
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Min( const i64<2, SIMD>& a, const i64<2, SIMD>& b )
+    {
+        return vbslq_s64( vcltq_s64( a.native, b.native ), a.native, b.native );
+    }
+        
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Max( const i64<2, SIMD>& a, const i64<2, SIMD>& b )
+    {
+        return vbslq_s64( vcgtq_s64( a.native, b.native ), a.native, b.native );
+    }
+        
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Select( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& ifTrue, const i64<2, SIMD>& ifFalse )
+    {
+        return vbslq_s64( mask.native, ifTrue.native, ifFalse.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> BitShiftRightZeroExtend( const i64<2, SIMD>& a, int b )
+    {
+        return vreinterpretq_s64_u64( vshlq_u64( vreinterpretq_u64_s64( a.native ), vdupq_n_s64( -b ) ) );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Masked( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& a )
+    {
+        return vandq_s64( vreinterpretq_s64_u64( mask.native ), a.native );    
+    }
+        
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> InvMasked( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& a )
+    {
+        return vbicq_s64( a.native, vreinterpretq_s64_u64( mask.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MaskedIncrement( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& a )
+    {
+        return vsubq_s64( a.native, vreinterpretq_s64_u64( mask.native ) );
+    }
+        
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MaskedDecrement( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& a )
+    {
+        return vaddq_s64( a.native, vreinterpretq_s64_u64( mask.native ) );    
+    }
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int8_t, 16, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::NEON>>
+    {
+        static constexpr size_t ElementCount = 16;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = int8x16_t;
+        using ElementType = std::int8_t;
+        using MaskType = m8<ElementCount, false, SIMD>;
+        using MaskTypeArg = m8<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int8_t v ) : native( vdupq_n_s8( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = vaddq_s8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = vsubq_s8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = vandq_s8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = vorrq_s8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = veorq_s8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = vshlq_s8( native, vdupq_n_s8( -rhs ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = vshlq_s8( native, vdupq_n_s8( rhs ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return vmvnq_s8( native );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return vnegq_s8( native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return vceqq_s8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return vcgeq_s8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return vcleq_s8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return vcgtq_s8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return vcltq_s8( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Load( TypeWrapper<const std::int8_t*, 16, SIMD> ptr )
+    {
+        return vld1q_s8( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE void Store( typename i8<16, SIMD>::ElementType* ptr, const i8<16, SIMD>& a )
+    {
+        vst1q_s8( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE std::int8_t Extract0( const i8<16, SIMD>& a )
+    {
+        return vgetq_lane_s8( a.native, 0 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Abs( const i8<16, SIMD>& a )
+    {
+        return vabsq_s8( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Min( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        return vminq_s8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Max( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        return vmaxq_s8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Select( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& ifTrue, const i8<16, SIMD>& ifFalse )
+    {
+        return vbslq_s8( mask.native, ifTrue.native, ifFalse.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> BitShiftRightZeroExtend( const i8<16, SIMD>& a, int b )
+    {
+        return vreinterpretq_s8_u8( vshlq_u8( vreinterpretq_u8_s8( a.native ), vdupq_n_s8( -b ) ) );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Masked( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& a )
+    {
+        return vandq_s8( vreinterpretq_s8_u8( mask.native ), a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> MaskedIncrement( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& a )
+    {
+        return vsubq_s8( a.native, vreinterpretq_s8_u8( mask.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> MaskedDecrement( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& a )
+    {
+        return vaddq_s8( a.native, vreinterpretq_s8_u8( mask.native ) );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> AddSat( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        return vqaddq_s8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> SubSat( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        return vqsubq_s8( a.native, b.native );
+    }
+}
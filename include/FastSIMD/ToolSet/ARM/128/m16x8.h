@@ -0,0 +1,105 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    namespace impl
+    {
+        struct ArmMaskBase16x8
+        {
+            uint16x8_t native;
+        };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool OPTIMISE_FLOAT>
+    struct Register<Mask<16, OPTIMISE_FLOAT>, 8, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::ARM>>
+        : std::conditional_t<OPTIMISE_FLOAT, impl::ArmMaskBase16x8, Register<Mask<16, true>, 8, SIMD>>
+    {
+        static constexpr size_t ElementCount = 8;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = decltype(ArmMaskBase16x8::native);
+        using ElementType = Mask<16, OPTIMISE_FLOAT>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) { this->native = v; }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return this->native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = vandq_u16( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = vorrq_u16( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = veorq_u16( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return vmvnq_u16( this->native );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<16, B>, 8, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const Register<Mask<16, B>, 8, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vmaxvq_u16( a.native );
+        }
+        else
+        {
+            uint32x4_t a32 = vreinterpretq_u32_u16( a.native );
+            uint32x2_t tmp = vorr_u32( vget_low_u32( a32 ), vget_high_u32( a32 ) );
+            return (bool)vget_lane_u32( vpmax_u32( tmp, tmp ), 0 );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<16, B>, 8, SIMD>>>
+    FS_FORCEINLINE BitStorage<8> BitMask( const Register<Mask<16, B>, 8, SIMD>& a )
+    {
+        static const int16_t shift[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+        uint16x8_t tmp = vshlq_u16( vshrq_n_u16( a.native, 15 ), vld1q_s16( shift ) );
+
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return static_cast<BitStorage<8>>( vaddvq_u16( tmp ) );
+        }
+        else
+        {
+            uint64x2_t paired = vpaddlq_u32( vpaddlq_u16( tmp ) );
+            return static_cast<BitStorage<8>>( vgetq_lane_u64( paired, 0 ) | vgetq_lane_u64( paired, 1 ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<16, B>, 8, SIMD>>>
+    FS_FORCEINLINE bool AllMask( const Register<Mask<16, B>, 8, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vminvq_u16( a.native );
+        }
+        else
+        {
+            uint32x4_t a32 = vreinterpretq_u32_u16( a.native );
+            uint32x2_t tmp = vand_u32( vget_low_u32( a32 ), vget_high_u32( a32 ) );
+            return vget_lane_u32( vpmin_u32( tmp, tmp ), 0 ) == 0xFFFFFFFF;
+        }
+    }
+}
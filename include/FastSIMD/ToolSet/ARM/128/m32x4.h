@@ -92,4 +92,18 @@ namespace FS
         }
     }
     
-}
\ No newline at end of file
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<32, B>, 4, SIMD>>>
+    FS_FORCEINLINE bool AllMask( const Register<Mask<32, B>, 4, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vminvq_u32( a.native );
+        }
+        else
+        {
+            uint32x2_t tmp = vand_u32( vget_low_u32( a.native ), vget_high_u32( a.native ) );
+            return vget_lane_u32( vpmin_u32( tmp, tmp ), 0 ) == 0xFFFFFFFF;
+        }
+    }
+}
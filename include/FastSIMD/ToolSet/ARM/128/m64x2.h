@@ -0,0 +1,78 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    namespace impl
+    {
+        struct ArmMaskBase64x2
+        {
+            uint64x2_t native;
+        };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool OPTIMISE_FLOAT>
+    struct Register<Mask<64, OPTIMISE_FLOAT>, 2, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AARCH64>>
+        : std::conditional_t<OPTIMISE_FLOAT, impl::ArmMaskBase64x2, Register<Mask<64, true>, 2, SIMD>>
+    {
+        static constexpr size_t ElementCount = 2;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = decltype(ArmMaskBase64x2::native);
+        using ElementType = Mask<64, OPTIMISE_FLOAT>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) { this->native = v; }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return this->native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = vandq_u64( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = vorrq_u64( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = veorq_u64( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return vreinterpretq_u64_u32( vmvnq_u32( vreinterpretq_u32_u64( this->native ) ) );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<64, B>, 2, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const Register<Mask<64, B>, 2, SIMD>& a )
+    {
+        return vmaxvq_u32( vreinterpretq_u32_u64( a.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<64, B>, 2, SIMD>>>
+    FS_FORCEINLINE BitStorage<2> BitMask( const Register<Mask<64, B>, 2, SIMD>& a )
+    {
+        static const int64_t shift[2] = { 0, 1 };
+        uint64x2_t tmp = vshrq_n_u64( a.native, 63 );
+        return static_cast<BitStorage<2>>( vaddvq_u64( vshlq_u64( tmp, vld1q_s64( shift ) ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<64, B>, 2, SIMD>>>
+    FS_FORCEINLINE bool AllMask( const Register<Mask<64, B>, 2, SIMD>& a )
+    {
+        return vminvq_u32( vreinterpretq_u32_u64( a.native ) );
+    }
+}
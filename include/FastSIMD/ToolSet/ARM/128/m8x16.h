@@ -0,0 +1,107 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    namespace impl
+    {
+        struct ArmMaskBase8x16
+        {
+            uint8x16_t native;
+        };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool OPTIMISE_FLOAT>
+    struct Register<Mask<8, OPTIMISE_FLOAT>, 16, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::ARM>>
+        : std::conditional_t<OPTIMISE_FLOAT, impl::ArmMaskBase8x16, Register<Mask<8, true>, 16, SIMD>>
+    {
+        static constexpr size_t ElementCount = 16;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = decltype(ArmMaskBase8x16::native);
+        using ElementType = Mask<8, OPTIMISE_FLOAT>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) { this->native = v; }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return this->native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = vandq_u8( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = vorrq_u8( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = veorq_u8( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return vmvnq_u8( this->native );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<8, B>, 16, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const Register<Mask<8, B>, 16, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vmaxvq_u8( a.native );
+        }
+        else
+        {
+            uint32x4_t a32 = vreinterpretq_u32_u8( a.native );
+            uint32x2_t tmp = vorr_u32( vget_low_u32( a32 ), vget_high_u32( a32 ) );
+            return (bool)vget_lane_u32( vpmax_u32( tmp, tmp ), 0 );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<8, B>, 16, SIMD>>>
+    FS_FORCEINLINE BitStorage<16> BitMask( const Register<Mask<8, B>, 16, SIMD>& a )
+    {
+        // Isolate the top bit of each byte and move it to its bit index within the 8 byte half
+        static const int8_t shift[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7 };
+        uint8x16_t tmp = vshlq_u8( vshrq_n_u8( a.native, 7 ), vld1q_s8( shift ) );
+
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return static_cast<BitStorage<16>>( vaddv_u8( vget_low_u8( tmp ) ) | ( vaddv_u8( vget_high_u8( tmp ) ) << 8 ) );
+        }
+        else
+        {
+            // Horizontal add each half down to a single byte
+            uint64x2_t paired = vpaddlq_u32( vpaddlq_u16( vpaddlq_u8( tmp ) ) );
+            return static_cast<BitStorage<16>>( vgetq_lane_u64( paired, 0 ) | ( vgetq_lane_u64( paired, 1 ) << 8 ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<8, B>, 16, SIMD>>>
+    FS_FORCEINLINE bool AllMask( const Register<Mask<8, B>, 16, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vminvq_u8( a.native );
+        }
+        else
+        {
+            uint32x4_t a32 = vreinterpretq_u32_u8( a.native );
+            uint32x2_t tmp = vand_u32( vget_low_u32( a32 ), vget_high_u32( a32 ) );
+            return vget_lane_u32( vpmin_u32( tmp, tmp ), 0 ) == 0xFFFFFFFF;
+        }
+    }
+}
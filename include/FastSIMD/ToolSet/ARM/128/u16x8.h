@@ -0,0 +1,193 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::uint16_t, 8, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::NEON>>
+    {
+        static constexpr size_t ElementCount = 8;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = uint16x8_t;
+        using ElementType = std::uint16_t;
+        using MaskType = m16<ElementCount, false, SIMD>;
+        using MaskTypeArg = m16<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::uint16_t v ) : native( vdupq_n_u16( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = vaddq_u16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = vsubq_u16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = vmulq_u16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = vandq_u16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = vorrq_u16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = veorq_u16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = vshlq_u16( native, vdupq_n_s16( -rhs ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = vshlq_u16( native, vdupq_n_s16( rhs ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return vmvnq_u16( native );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return vreinterpretq_u16_s16( vnegq_s16( vreinterpretq_s16_u16( native ) ) );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return vceqq_u16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return vcgeq_u16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return vcleq_u16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return vcgtq_u16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return vcltq_u16( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Load( TypeWrapper<const std::uint16_t*, 8, SIMD> ptr )
+    {
+        return vld1q_u16( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE void Store( typename u16<8, SIMD>::ElementType* ptr, const u16<8, SIMD>& a )
+    {
+        vst1q_u16( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE std::uint16_t Extract0( const u16<8, SIMD>& a )
+    {
+        return vgetq_lane_u16( a.native, 0 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Min( const u16<8, SIMD>& a, const u16<8, SIMD>& b )
+    {
+        return vminq_u16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Max( const u16<8, SIMD>& a, const u16<8, SIMD>& b )
+    {
+        return vmaxq_u16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Select( const typename u16<8, SIMD>::MaskTypeArg& mask, const u16<8, SIMD>& ifTrue, const u16<8, SIMD>& ifFalse )
+    {
+        return vbslq_u16( mask.native, ifTrue.native, ifFalse.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Masked( const typename u16<8, SIMD>::MaskTypeArg& mask, const u16<8, SIMD>& a )
+    {
+        return vandq_u16( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> MaskedIncrement( const typename u16<8, SIMD>::MaskTypeArg& mask, const u16<8, SIMD>& a )
+    {
+        return vsubq_u16( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> MaskedDecrement( const typename u16<8, SIMD>::MaskTypeArg& mask, const u16<8, SIMD>& a )
+    {
+        return vaddq_u16( a.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> AddSat( const u16<8, SIMD>& a, const u16<8, SIMD>& b )
+    {
+        return vqaddq_u16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> SubSat( const u16<8, SIMD>& a, const u16<8, SIMD>& b )
+    {
+        return vqsubq_u16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Average( const u16<8, SIMD>& a, const u16<8, SIMD>& b )
+    {
+        return vrhaddq_u16( a.native, b.native );
+    }
+}
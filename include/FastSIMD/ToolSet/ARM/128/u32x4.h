@@ -0,0 +1,261 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::uint32_t, 4, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::NEON>>
+    {
+        static constexpr size_t ElementCount = 4;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = uint32x4_t;
+        using ElementType = std::uint32_t;
+        using MaskType = m32<ElementCount, false, SIMD>;
+        using MaskTypeArg = m32<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::uint32_t v ) : native( vdupq_n_u32( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = vaddq_u32( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = vsubq_u32( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = vmulq_u32( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = vandq_u32( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = vorrq_u32( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = veorq_u32( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = vshlq_u32( native, vdupq_n_s32( -rhs ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = vshlq_u32( native, vdupq_n_s32( rhs ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( const Register& rhs )
+        {
+            native = vshlq_u32( native, vnegq_s32( vreinterpretq_s32_u32( rhs.native ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( const Register& rhs )
+        {
+            native = vshlq_u32( native, vreinterpretq_s32_u32( rhs.native ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return vmvnq_u32( native );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return vsubq_u32( vdupq_n_u32( 0 ), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return vceqq_u32( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return vcgeq_u32( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return vcleq_u32( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return vcgtq_u32( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return vcltq_u32( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Load( TypeWrapper<const std::uint32_t*, 4, SIMD> ptr )
+    {
+        return vld1q_u32( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE void Store( typename u32<4, SIMD>::ElementType* ptr, const u32<4, SIMD>& a )
+    {
+        vst1q_u32( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE std::uint32_t Extract0( const u32<4, SIMD>& a )
+    {
+        return vgetq_lane_u32( a.native, 0 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Min( const u32<4, SIMD>& a, const u32<4, SIMD>& b )
+    {
+        return vminq_u32( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Max( const u32<4, SIMD>& a, const u32<4, SIMD>& b )
+    {
+        return vmaxq_u32( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Select( const typename u32<4, SIMD>::MaskTypeArg& mask, const u32<4, SIMD>& ifTrue, const u32<4, SIMD>& ifFalse )
+    {
+        return vbslq_u32( mask.native, ifTrue.native, ifFalse.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Masked( const typename u32<4, SIMD>::MaskTypeArg& mask, const u32<4, SIMD>& a )
+    {
+        return vandq_u32( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> MaskedIncrement( const typename u32<4, SIMD>::MaskTypeArg& mask, const u32<4, SIMD>& a )
+    {
+        return vsubq_u32( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> MaskedDecrement( const typename u32<4, SIMD>::MaskTypeArg& mask, const u32<4, SIMD>& a )
+    {
+        return vaddq_u32( a.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE std::uint32_t ReduceAdd( const u32<4, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vaddvq_u32( a.native );
+        }
+        else
+        {
+            uint32x2_t tmp = vadd_u32( vget_low_u32( a.native ), vget_high_u32( a.native ) );
+            return vget_lane_u32( vpadd_u32( tmp, tmp ), 0 );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE std::uint32_t ReduceMin( const u32<4, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vminvq_u32( a.native );
+        }
+        else
+        {
+            uint32x2_t tmp = vmin_u32( vget_low_u32( a.native ), vget_high_u32( a.native ) );
+            return vget_lane_u32( vpmin_u32( tmp, tmp ), 0 );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE std::uint32_t ReduceMax( const u32<4, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vmaxvq_u32( a.native );
+        }
+        else
+        {
+            uint32x2_t tmp = vmax_u32( vget_low_u32( a.native ), vget_high_u32( a.native ) );
+            return vget_lane_u32( vpmax_u32( tmp, tmp ), 0 );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> MulHi( const u32<4, SIMD>& a, const u32<4, SIMD>& b )
+    {
+        uint32x4_t low = vreinterpretq_u32_u64( vmull_u32( vget_low_u32( a.native ), vget_low_u32( b.native ) ) );
+        uint32x4_t high = vreinterpretq_u32_u64( vmull_u32( vget_high_u32( a.native ), vget_high_u32( b.native ) ) );
+        return vuzpq_u32( low, high ).val[1];
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MulWidenEven( const u32<4, SIMD>& a, const u32<4, SIMD>& b )
+    {
+        return vreinterpretq_s64_u64( vmull_u32( vmovn_u64( vreinterpretq_u64_u32( a.native ) ), vmovn_u64( vreinterpretq_u64_u32( b.native ) ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MulWidenOdd( const u32<4, SIMD>& a, const u32<4, SIMD>& b )
+    {
+        return vreinterpretq_s64_u64( vmull_u32( vshrn_n_u64( vreinterpretq_u64_u32( a.native ), 32 ), vshrn_n_u64( vreinterpretq_u64_u32( b.native ), 32 ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> AddSat( const u32<4, SIMD>& a, const u32<4, SIMD>& b )
+    {
+        return vqaddq_u32( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> SubSat( const u32<4, SIMD>& a, const u32<4, SIMD>& b )
+    {
+        return vqsubq_u32( a.native, b.native );
+    }
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::uint8_t, 16, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::NEON>>
+    {
+        static constexpr size_t ElementCount = 16;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = uint8x16_t;
+        using ElementType = std::uint8_t;
+        using MaskType = m8<ElementCount, false, SIMD>;
+        using MaskTypeArg = m8<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::uint8_t v ) : native( vdupq_n_u8( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = vaddq_u8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = vsubq_u8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = vandq_u8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = vorrq_u8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = veorq_u8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = vshlq_u8( native, vdupq_n_s8( -rhs ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = vshlq_u8( native, vdupq_n_s8( rhs ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return vmvnq_u8( native );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return vreinterpretq_u8_s8( vnegq_s8( vreinterpretq_s8_u8( native ) ) );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return vceqq_u8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return vcgeq_u8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return vcleq_u8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return vcgtq_u8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return vcltq_u8( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Load( TypeWrapper<const std::uint8_t*, 16, SIMD> ptr )
+    {
+        return vld1q_u8( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE void Store( typename u8<16, SIMD>::ElementType* ptr, const u8<16, SIMD>& a )
+    {
+        vst1q_u8( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE std::uint8_t Extract0( const u8<16, SIMD>& a )
+    {
+        return vgetq_lane_u8( a.native, 0 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Min( const u8<16, SIMD>& a, const u8<16, SIMD>& b )
+    {
+        return vminq_u8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Max( const u8<16, SIMD>& a, const u8<16, SIMD>& b )
+    {
+        return vmaxq_u8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Select( const typename u8<16, SIMD>::MaskTypeArg& mask, const u8<16, SIMD>& ifTrue, const u8<16, SIMD>& ifFalse )
+    {
+        return vbslq_u8( mask.native, ifTrue.native, ifFalse.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Masked( const typename u8<16, SIMD>::MaskTypeArg& mask, const u8<16, SIMD>& a )
+    {
+        return vandq_u8( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> MaskedIncrement( const typename u8<16, SIMD>::MaskTypeArg& mask, const u8<16, SIMD>& a )
+    {
+        return vsubq_u8( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> MaskedDecrement( const typename u8<16, SIMD>::MaskTypeArg& mask, const u8<16, SIMD>& a )
+    {
+        return vaddq_u8( a.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> AddSat( const u8<16, SIMD>& a, const u8<16, SIMD>& b )
+    {
+        return vqaddq_u8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> SubSat( const u8<16, SIMD>& a, const u8<16, SIMD>& b )
+    {
+        return vqsubq_u8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Average( const u8<16, SIMD>& a, const u8<16, SIMD>& b )
+    {
+        return vrhaddq_u8( a.native, b.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> TableLookup( const u8<16, SIMD>& table, const u8<16, SIMD>& idx )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AARCH64 )
+        {
+            return vqtbl1q_u8( table.native, idx.native );
+        }
+        else
+        {
+            uint8x8x2_t split = { { vget_low_u8( table.native ), vget_high_u8( table.native ) } };
+            return vcombine_u8( vtbl2_u8( split, vget_low_u8( idx.native ) ), vtbl2_u8( split, vget_high_u8( idx.native ) ) );
+        }
+    }
+}
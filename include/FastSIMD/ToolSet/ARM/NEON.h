@@ -3,7 +3,17 @@
 
 #include "128/f32x4.h"
 #include "128/i32x4.h"
+#include "128/u32x4.h"
 #include "128/m32x4.h"
+#include "128/i64x2.h"
+#include "128/f64x2.h"
+#include "128/m64x2.h"
+#include "128/i8x16.h"
+#include "128/u8x16.h"
+#include "128/m8x16.h"
+#include "128/i16x8.h"
+#include "128/u16x8.h"
+#include "128/m16x8.h"
 
 namespace FS
 {
@@ -19,24 +29,217 @@ namespace FS
         return vcvtq_f32_s32( a.native );
     }
 
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Convert( const f32<4, SIMD>& a, TypeDummy<uint32_t> )
+    {
+        return vcvtq_u32_f32( Round( a ).native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Convert( const u32<4, SIMD>& a, TypeDummy<float> )
+    {
+        return vcvtq_f32_u32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = EnableIfNotNative<f64<4, SIMD>>, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Convert( const f32<4, SIMD>& a, TypeDummy<double> )
+    {
+        return { vcvt_f64_f32( vget_low_f32( a.native ) ), vcvt_high_f64_f32( a.native ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = EnableIfNotNative<f64<4, SIMD>>, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Convert( const f64<4, SIMD>& a, TypeDummy<float> )
+    {
+        return vcvt_high_f32_f64( vcvt_f32_f64( a.v0.native ), a.v1.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = EnableIfNotNative<f64<4, SIMD>>, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Convert( const i32<4, SIMD>& a, TypeDummy<double> )
+    {
+        return { vcvtq_f64_s64( vmovl_s32( vget_low_s32( a.native ) ) ), vcvtq_f64_s64( vmovl_high_s32( a.native ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = EnableIfNotNative<f64<4, SIMD>>, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> Convert( const f64<4, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return vqmovn_high_s64( vqmovn_s64( vcvtnq_s64_f64( a.v0.native ) ), vcvtnq_s64_f64( a.v1.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>, typename = EnableIfNotNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> Convert( const i8<16, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return i16<16, SIMD>{ vmovl_s8( vget_low_s8( a.native ) ), vmovl_s8( vget_high_s8( a.native ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>, typename = EnableIfNotNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> Convert( const u8<16, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        return u16<16, SIMD>{ vmovl_u8( vget_low_u8( a.native ) ), vmovl_u8( vget_high_u8( a.native ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>, typename = EnableIfNotNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Convert( const i16<8, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return i32<8, SIMD>{ vmovl_s16( vget_low_s16( a.native ) ), vmovl_s16( vget_high_s16( a.native ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>, typename = EnableIfNotNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Convert( const u16<8, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return i32<8, SIMD>{ vreinterpretq_s32_u32( vmovl_u16( vget_low_u16( a.native ) ) ), vreinterpretq_s32_u32( vmovl_u16( vget_high_u16( a.native ) ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>, typename = EnableIfNotNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Convert( const i16<16, SIMD>& a, TypeDummy<int8_t> )
+    {
+        return vcombine_s8( vqmovn_s16( a.v0.native ), vqmovn_s16( a.v1.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>, typename = EnableIfNotNative<i16<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Convert( const i16<16, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        return vcombine_u8( vqmovun_s16( a.v0.native ), vqmovun_s16( a.v1.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>, typename = EnableIfNotNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Convert( const u16<16, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        return vcombine_u8( vqmovn_u16( a.v0.native ), vqmovn_u16( a.v1.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>, typename = EnableIfNotNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Convert( const i32<8, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return vcombine_s16( vqmovn_s32( a.v0.native ), vqmovn_s32( a.v1.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>, typename = EnableIfNotNative<i32<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Convert( const i32<8, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        return vcombine_u16( vqmovun_s32( a.v0.native ), vqmovun_s32( a.v1.native ) );
+    }
+
+    template<typename U, typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 2, SIMD>>>
+    FS_FORCEINLINE Register<U, 2, SIMD> Cast( const Register<T, 2, SIMD>& a, TypeDummy<U> )
+    {
+        using NativeT = typename Register<T, 2, SIMD>::NativeType;
+        using NativeU = typename Register<U, 2, SIMD>::NativeType;
+
+        if constexpr( std::is_same_v<NativeT, NativeU> )
+        {
+            return a.GetNative();
+        }
+        else if constexpr( std::is_same_v<NativeU, float64x2_t> )
+        {
+            if constexpr( std::is_same_v<NativeT, int64x2_t> )
+            {
+                return vreinterpretq_f64_s64( a.GetNative() );
+            }
+            else
+            {
+                return vreinterpretq_f64_u64( a.GetNative() );
+            }
+        }
+        else if constexpr( std::is_same_v<NativeU, int64x2_t> )
+        {
+            if constexpr( std::is_same_v<NativeT, float64x2_t> )
+            {
+                return vreinterpretq_s64_f64( a.GetNative() );
+            }
+            else
+            {
+                return vreinterpretq_s64_u64( a.GetNative() );
+            }
+        }
+        else
+        {
+            if constexpr( std::is_same_v<NativeT, float64x2_t> )
+            {
+                return vreinterpretq_u64_f64( a.GetNative() );
+            }
+            else
+            {
+                return vreinterpretq_u64_s64( a.GetNative() );
+            }
+        }
+    }
+
     template<typename U, typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 4, SIMD>>>
     FS_FORCEINLINE Register<U, 4, SIMD> Cast( const Register<T, 4, SIMD>& a, TypeDummy<U> )
     {
-        if constexpr( 
-            std::is_same_v<typename Register<T, 4, SIMD>::NativeType, float32x4_t> &&
-            std::is_same_v<typename Register<U, 4, SIMD>::NativeType, int32x4_t> )
+        using NativeT = typename Register<T, 4, SIMD>::NativeType;
+        using NativeU = typename Register<U, 4, SIMD>::NativeType;
+
+        if constexpr( std::is_same_v<NativeT, NativeU> )
+        {
+            return a.GetNative();
+        }
+        else if constexpr( std::is_same_v<NativeU, float32x4_t> )
+        {
+            if constexpr( std::is_same_v<NativeT, int32x4_t> )
+            {
+                return vreinterpretq_f32_s32( a.GetNative() );
+            }
+            else
+            {
+                return vreinterpretq_f32_u32( a.GetNative() );
+            }
+        }
+        else if constexpr( std::is_same_v<NativeU, int32x4_t> )
+        {
+            if constexpr( std::is_same_v<NativeT, float32x4_t> )
+            {
+                return vreinterpretq_s32_f32( a.GetNative() );
+            }
+            else
+            {
+                return vreinterpretq_s32_u32( a.GetNative() );
+            }
+        }
+        else
+        {
+            if constexpr( std::is_same_v<NativeT, float32x4_t> )
+            {
+                return vreinterpretq_u32_f32( a.GetNative() );
+            }
+            else
+            {
+                return vreinterpretq_u32_s32( a.GetNative() );
+            }
+        }
+    }
+
+    template<typename U, typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 8, SIMD>>>
+    FS_FORCEINLINE Register<U, 8, SIMD> Cast( const Register<T, 8, SIMD>& a, TypeDummy<U> )
+    {
+        if constexpr( std::is_same_v<typename Register<T, 8, SIMD>::NativeType, typename Register<U, 8, SIMD>::NativeType> )
         {
-            return vreinterpretq_s32_f32( a.GetNative() );
+            return a.GetNative();
         }
-        else if constexpr( 
-            std::is_same_v<typename Register<T, 4, SIMD>::NativeType, int32x4_t> &&
-            std::is_same_v<typename Register<U, 4, SIMD>::NativeType, float32x4_t> )
+        else if constexpr( std::is_same_v<typename Register<U, 8, SIMD>::NativeType, int16x8_t> )
         {
-            return vreinterpretq_f32_s32( a.GetNative() );
+            return vreinterpretq_s16_u16( a.GetNative() );
         }
         else
+        {
+            return vreinterpretq_u16_s16( a.GetNative() );
+        }
+    }
+
+    template<typename U, typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 16, SIMD>>>
+    FS_FORCEINLINE Register<U, 16, SIMD> Cast( const Register<T, 16, SIMD>& a, TypeDummy<U> )
+    {
+        if constexpr( std::is_same_v<typename Register<T, 16, SIMD>::NativeType, typename Register<U, 16, SIMD>::NativeType> )
         {
             return a.GetNative();
         }
+        else if constexpr( std::is_same_v<typename Register<U, 16, SIMD>::NativeType, int8x16_t> )
+        {
+            return vreinterpretq_s8_u8( a.GetNative() );
+        }
+        else
+        {
+            return vreinterpretq_u8_s8( a.GetNative() );
+        }
     }
 }
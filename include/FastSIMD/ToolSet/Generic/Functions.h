@@ -1,10 +1,17 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 
 #include "Register.h"
 
+#if FASTSIMD_CURRENT_ARCH_IS( X86 )
+#include <xmmintrin.h>
+#elif defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
 #define FS_BIND_INTRINSIC( FUNC ) []( auto... ARGS ){ return FUNC( ARGS... ); }
 
 namespace FS
@@ -50,280 +57,1502 @@ namespace FS
         Store( ptr, a.v0 );
         Store( ptr + N / 2, a.v1 );
     }
-    
-    // Convert a mask into a uint bitmask of appropriate size for register element count
-    template<std::size_t S, bool F, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE BitStorage<N> BitMask( const Register<Mask<S, F>, N, SIMD>& a )
-    {
-        static_assert( !IsNativeV<Register<Mask<S, F>, N, SIMD>>, "FastSIMD: FS::BitMask not supported with provided types" );
-        return static_cast<BitStorage<N>>( BitMask( a.v0 ) ) | static_cast<BitStorage<N>>( BitMask( a.v1 ) << ( N / 2 ) );
-    }
-    
-    // Load constant set of values into register
-    template<typename T, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault(), typename... Ts>
-    FS_FORCEINLINE Register<T, sizeof...( Ts ) + 1, SIMD> Constant( T value, Ts... values )
-    {
-        alignas( std::alignment_of_v<Register<T, sizeof...( Ts ) + 1, SIMD>> ) const T constArray[] = { value, T( values )... };
 
-        return Load<sizeof...( Ts ) + 1, SIMD>( constArray );
-    }
-    
-    template<typename T, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault(), std::int64_t... VALUEs>
-    FS_FORCEINLINE Register<T, sizeof...( VALUEs ), SIMD> Constant( std::integer_sequence<std::int64_t, VALUEs...> )
+    // impl
+    namespace impl { template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> LoadPartial( TypeWrapper<const T*, N, SIMD> ptr, std::size_t count )
     {
-        alignas( std::alignment_of_v<Register<T, sizeof...( VALUEs ), SIMD>> ) const T constArray[] = { T( VALUEs )... };
+        if( count >= N )
+        {
+            return Load( ptr );
+        }
 
-        return Load<sizeof...( VALUEs ), SIMD>( constArray );
-    }
-    
-    // Extract first element
-    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE T Extract0( const Register<T, N, SIMD>& a )
-    {
-        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Extract0 not supported with provided types" );
-        return Extract0( a.v0 );
-    }
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N] = {};
 
-    // Incremented elements in a register { 0, 1, 2, ..., N - 1 }
-    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
-    FS_FORCEINLINE Register<T, N, SIMD> LoadIncremented()
+            for( std::size_t i = 0; i < count; i++ )
+            {
+                values[i] = ptr.value[i];
+            }
+            return Load( TypeWrapper<const T*, N, SIMD>( values ) );
+        }
+        else if( count <= N / 2 )
+        {
+            return Register<T, N, SIMD>{ LoadPartial( ptr.AsHalf(), count ), Register<T, N / 2, SIMD>( T( 0 ) ) };
+        }
+        else
+        {
+            return Register<T, N, SIMD>{ Load( ptr.AsHalf() ), LoadPartial( ptr.AsHalf( N / 2 ), count - N / 2 ) };
+        }
+    } }
+
+    // Load first count values, remaining elements are zero and their addresses are not accessed
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault(), typename T>
+    FS_FORCEINLINE Register<T, N, SIMD> LoadPartial( const T* ptr, std::size_t count )
     {
-        return Constant<T, SIMD>( std::make_integer_sequence<std::int64_t, N>{} );
+        return LoadPartial( TypeWrapper<const T*, N, SIMD>( ptr ), count );
     }
 
     template<typename R>
-    FS_FORCEINLINE R LoadIncremented()
+    FS_FORCEINLINE R LoadPartial( const typename R::ElementType* ptr, std::size_t count )
     {
-        return Constant<typename R::ElementType, R::FeatureFlags>( std::make_integer_sequence<std::int64_t, R::ElementCount>{} );
+        return LoadPartial( TypeWrapper<const typename R::ElementType*, R::ElementCount, R::FeatureFlags>( ptr ), count );
     }
 
-    // impl
-    namespace impl { template<typename U, typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<U, N, SIMD> Convert( const Register<T, N, SIMD>& a, TypeDummy<U> )
-    {
-        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS:Convert not supported with provided types" );
-        return Register<U, N, SIMD>{ Convert( a.v0, TypeDummy<U>{} ), Convert( a.v1, TypeDummy<U>{} ) };
-    } }
 
-    // Convert values
-    template<typename U, typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<U, N, SIMD> Convert( const Register<T, N, SIMD>& a )
+    // Store first count values, memory past count is not accessed
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE void StorePartial( typename Register<T, N, SIMD>::ElementType* ptr, const Register<T, N, SIMD>& a, std::size_t count )
     {
-        return Convert( a, TypeDummy<U>{} );
+        if( count >= N )
+        {
+            Store( ptr, a );
+        }
+        else if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+
+            Store( values, a );
+
+            for( std::size_t i = 0; i < count; i++ )
+            {
+                ptr[i] = values[i];
+            }
+        }
+        else if( count <= N / 2 )
+        {
+            StorePartial( ptr, a.v0, count );
+        }
+        else
+        {
+            Store( ptr, a.v0 );
+            StorePartial( ptr + N / 2, a.v1, count - N / 2 );
+        }
     }
 
 
     // impl
-    namespace impl { template<typename U, typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<U, N, SIMD> Cast( const Register<T, N, SIMD>& a, TypeDummy<U> )
+    namespace impl { template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> MaskedLoad( const typename Register<T, N, SIMD>::MaskTypeArg& mask, TypeWrapper<const T*, N, SIMD> ptr )
     {
-        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS:Cast not supported with provided types" );
-        return Register<U, N, SIMD>{ Cast( a.v0, TypeDummy<U>{} ), Cast( a.v1, TypeDummy<U>{} ) };
+        if constexpr( IsNativeV<Register<T, N, SIMD>> || IsNativeV<typename Register<T, N, SIMD>::MaskTypeArg> )
+        {
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+
+            BitStorage<N> active = BitMask( mask );
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                values[i] = ( active >> i ) & 1 ? ptr.value[i] : T( 0 );
+            }
+            return Load( TypeWrapper<const T*, N, SIMD>( values ) );
+        }
+        else
+        {
+            return Register<T, N, SIMD>{ MaskedLoad( mask.v0, ptr.AsHalf() ), MaskedLoad( mask.v1, ptr.AsHalf( N / 2 ) ) };
+        }
     } }
 
-    // Cast values
-    template<typename U, typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<U, N, SIMD> Cast( const Register<T, N, SIMD>& a )
+    // Load active elements, inactive elements are zero and their addresses are not accessed
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault(), typename T>
+    FS_FORCEINLINE Register<T, N, SIMD> MaskedLoad( const typename Register<T, N, SIMD>::MaskTypeArg& mask, const T* ptr )
     {
-        return Cast( a, TypeDummy<U>{} );
+        return MaskedLoad( mask, TypeWrapper<const T*, N, SIMD>( ptr ) );
     }
 
-
-    // Abs value
-    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> Abs( const Register<T, N, SIMD>& a )
+    template<typename R>
+    FS_FORCEINLINE R MaskedLoad( const typename R::MaskTypeArg& mask, const typename R::ElementType* ptr )
     {
-        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS:Abs not supported with provided types" );
-        return Register<T, N, SIMD>{ Abs( a.v0 ), Abs( a.v1 ) };
+        return MaskedLoad( mask, TypeWrapper<const typename R::ElementType*, R::ElementCount, R::FeatureFlags>( ptr ) );
     }
 
-    
-    // Round value, banker's rounding
+
+    // Store active elements, memory for inactive elements is not accessed
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> Round( const Register<T, N, SIMD>& a )
+    FS_FORCEINLINE void MaskedStore( const typename Register<T, N, SIMD>::MaskTypeArg& mask, typename Register<T, N, SIMD>::ElementType* ptr, const Register<T, N, SIMD>& a )
     {
-        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Round not supported with provided types" );
-        return Register<T, N, SIMD>{ Round( a.v0 ), Round( a.v1 ) };
+        if constexpr( IsNativeV<Register<T, N, SIMD>> || IsNativeV<typename Register<T, N, SIMD>::MaskTypeArg> )
+        {
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+
+            Store( values, a );
+            BitStorage<N> active = BitMask( mask );
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                if( ( active >> i ) & 1 )
+                {
+                    ptr[i] = values[i];
+                }
+            }
+        }
+        else
+        {
+            MaskedStore( mask.v0, ptr, a.v0 );
+            MaskedStore( mask.v1, ptr + N / 2, a.v1 );
+        }
     }
 
 
-    // Floor value, round towards -infinity
-    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> Floor( const Register<T, N, SIMD>& a )
+    // impl
+    namespace impl
     {
-        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Floor not supported with provided types" );
-        return Register<T, N, SIMD>{ Floor( a.v0 ), Floor( a.v1 ) };
-    }
+        // Byte indices moving the active 32 bit elements of a 4 bit mask {to the front | from the front into their lanes}
+        // unused bytes are out of range so TableLookup style shuffles zero them
+        template<bool EXPAND>
+        constexpr std::array<std::array<std::uint8_t, 16>, 16> MakeCompressByteTable4x32()
+        {
+            std::array<std::array<std::uint8_t, 16>, 16> table = {};
 
+            for( std::size_t mask = 0; mask < 16; mask++ )
+            {
+                std::size_t count = 0;
+
+                for( std::size_t i = 0; i < 16; i++ )
+                {
+                    table[mask][i] = 0x80;
+                }
+
+                for( std::size_t lane = 0; lane < 4; lane++ )
+                {
+                    if( ( mask >> lane ) & 1 )
+                    {
+                        std::size_t dst = EXPAND ? lane : count;
+                        std::size_t src = EXPAND ? count : lane;
+
+                        for( std::size_t i = 0; i < 4; i++ )
+                        {
+                            table[mask][dst * 4 + i] = static_cast<std::uint8_t>( src * 4 + i );
+                        }
+                        count++;
+                    }
+                }
+            }
+            return table;
+        }
 
-    // Ceil value, round towards +infinity
+        // Element indices packed in nibbles for 8 x 32 bit permutes, same layout as above
+        template<bool EXPAND>
+        constexpr std::array<std::uint32_t, 256> MakeCompressNibbleTable8x32()
+        {
+            std::array<std::uint32_t, 256> table = {};
+
+            for( std::size_t mask = 0; mask < 256; mask++ )
+            {
+                std::size_t count = 0;
+
+                for( std::size_t lane = 0; lane < 8; lane++ )
+                {
+                    if( ( mask >> lane ) & 1 )
+                    {
+                        std::size_t dst = EXPAND ? lane : count;
+                        std::size_t src = EXPAND ? count : lane;
+
+                        table[mask] |= static_cast<std::uint32_t>( src << ( dst * 4 ) );
+                        count++;
+                    }
+                }
+            }
+            return table;
+        }
+
+        inline constexpr auto CompressByteTable4x32 = MakeCompressByteTable4x32<false>();
+        inline constexpr auto ExpandByteTable4x32 = MakeCompressByteTable4x32<true>();
+        inline constexpr auto CompressNibbleTable8x32 = MakeCompressNibbleTable8x32<false>();
+        inline constexpr auto ExpandNibbleTable8x32 = MakeCompressNibbleTable8x32<true>();
+
+        template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<T, N, SIMD> CompressElements( const typename Register<T, N, SIMD>::MaskTypeArg& mask, const Register<T, N, SIMD>& a )
+        {
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T result[N] = {};
+
+            Store( values, a );
+            BitStorage<N> active = BitMask( mask );
+            std::size_t count = 0;
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                if( ( active >> i ) & 1 )
+                {
+                    result[count++] = values[i];
+                }
+            }
+            return Load( TypeWrapper<const T*, N, SIMD>( result ) );
+        }
+
+        template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<T, N, SIMD> ExpandElements( const typename Register<T, N, SIMD>::MaskTypeArg& mask, const Register<T, N, SIMD>& a )
+        {
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T result[N] = {};
+
+            Store( values, a );
+            BitStorage<N> active = BitMask( mask );
+            std::size_t count = 0;
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                if( ( active >> i ) & 1 )
+                {
+                    result[i] = values[count++];
+                }
+            }
+            return Load( TypeWrapper<const T*, N, SIMD>( result ) );
+        }
+    }
+
+    // Move active elements to the front keeping their order, remaining elements are zero
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> Ceil( const Register<T, N, SIMD>& a )
+    FS_FORCEINLINE Register<T, N, SIMD> Compress( const typename Register<T, N, SIMD>::MaskTypeArg& mask, const Register<T, N, SIMD>& a )
     {
-        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Ceil not supported with provided types" );
-        return Register<T, N, SIMD>{ Ceil( a.v0 ), Ceil( a.v1 ) };
+        return impl::CompressElements( mask, a );
     }
 
-    // Truncate value, round towards 0
+    // Move elements from the front into the active lanes keeping their order, inactive elements are zero
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> Trunc( const Register<T, N, SIMD>& a )
+    FS_FORCEINLINE Register<T, N, SIMD> Expand( const typename Register<T, N, SIMD>::MaskTypeArg& mask, const Register<T, N, SIMD>& a )
     {
-        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Trunc not supported with provided types" );
-        return Register<T, N, SIMD>{ Trunc( a.v0 ), Trunc( a.v1 ) };
+        return impl::ExpandElements( mask, a );
     }
 
-
-    // Min of 2 elements
+    // Store active elements contiguously, returns the number of elements written. Memory past that count is not accessed
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> Min( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    FS_FORCEINLINE std::size_t CompressStore( const typename Register<T, N, SIMD>::MaskTypeArg& mask, typename Register<T, N, SIMD>::ElementType* ptr, const Register<T, N, SIMD>& a )
     {
-        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Min not supported with provided types" );
-        return Register<T, N, SIMD>{ Min( a.v0, b.v0 ), Min( a.v1, b.v1 ) };
+        if constexpr( IsNativeV<Register<T, N, SIMD>> || IsNativeV<typename Register<T, N, SIMD>::MaskTypeArg> )
+        {
+            std::size_t count = static_cast<std::size_t>( CountTrue( mask ) );
+
+            StorePartial( ptr, Compress( mask, a ), count );
+            return count;
+        }
+        else
+        {
+            std::size_t count = CompressStore( mask.v0, ptr, a.v0 );
+            return count + CompressStore( mask.v1, ptr + count, a.v1 );
+        }
     }
 
+    // impl
+    namespace impl { template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> ExpandLoad( const typename Register<T, N, SIMD>::MaskTypeArg& mask, TypeWrapper<const T*, N, SIMD> ptr )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> || IsNativeV<typename Register<T, N, SIMD>::MaskTypeArg> )
+        {
+            return Expand( mask, LoadPartial( ptr, static_cast<std::size_t>( CountTrue( mask ) ) ) );
+        }
+        else
+        {
+            return Register<T, N, SIMD>{ ExpandLoad( mask.v0, ptr.AsHalf() ), ExpandLoad( mask.v1, ptr.AsHalf( CountTrue( mask.v0 ) ) ) };
+        }
+    } }
 
-    // Max of 2 elements
-    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> Max( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    // Load contiguous elements into the active lanes, inactive elements are zero. Memory past the active count is not accessed
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault(), typename T>
+    FS_FORCEINLINE Register<T, N, SIMD> ExpandLoad( const typename Register<T, N, SIMD>::MaskTypeArg& mask, const T* ptr )
     {
-        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Max not supported with provided types" );
-        return Register<T, N, SIMD>{ Max( a.v0, b.v0 ), Max( a.v1, b.v1 ) };
+        return ExpandLoad( mask, TypeWrapper<const T*, N, SIMD>( ptr ) );
     }
 
-
-    // Select element from 2 registers using Mask
-    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> Select( const typename Register<T, N, SIMD>::MaskTypeArg& mask, const Register<T, N, SIMD>& ifTrue, const Register<T, N, SIMD>& ifFalse )
+    template<typename R>
+    FS_FORCEINLINE R ExpandLoad( const typename R::MaskTypeArg& mask, const typename R::ElementType* ptr )
     {
-        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Select not supported with provided types" );
-        return Register<T, N, SIMD>{ Select( mask.v0, ifTrue.v0, ifFalse.v0 ), Select( mask.v1, ifTrue.v1, ifFalse.v1 ) };
+        return ExpandLoad( mask, TypeWrapper<const typename R::ElementType*, R::ElementCount, R::FeatureFlags>( ptr ) );
     }
 
-    // Select element from 2 registers using most significant bit from int or float
-    template<typename T, typename U, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> SelectHighBit( const Register<U, N, SIMD>& mask, const Register<T, N, SIMD>& ifTrue, const Register<T, N, SIMD>& ifFalse )
+
+    // Store values bypassing the cache, ptr must be aligned to the register size
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE void StoreStream( typename Register<T, N, SIMD>::ElementType* ptr, const Register<T, N, SIMD>& a )
     {
         if constexpr( IsNativeV<Register<T, N, SIMD>> )
         {
-            if constexpr( std::is_same_v<typename Register<U, N, SIMD>::NativeType, typename Register<U, N, SIMD>::MaskType::NativeType> )
+            // No non-temporal stores for this ToolSet, fall back to a normal store
+            Store( ptr, a );
+        }
+        else
         {
-                return Select( FS::Cast<typename Register<U, N, SIMD>::MaskType::ElementType>( FS::Cast<std::int32_t>( mask ) >> 31 ), ifTrue, ifFalse );                
-            }
-            else
-            {
-                return Select( FS::Cast<std::int32_t>( mask ) < Register<std::int32_t, N, SIMD>( 0 ), ifTrue, ifFalse );
-            }
+            StoreStream( ptr, a.v0 );
+            StoreStream( ptr + N / 2, a.v1 );
+        }
+    }
+
+    // Order preceding streaming stores before any following stores, use after a run of StoreStream
+    template<FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
+    FS_FORCEINLINE void StreamFence()
+    {
+#if FASTSIMD_CURRENT_ARCH_IS( X86 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE )
+        {
+            _mm_sfence();
         }
         else
+#endif
         {
-            return Register<T, N, SIMD>{ SelectHighBit( mask.v0, ifTrue.v0, ifFalse.v0 ), SelectHighBit( mask.v1, ifTrue.v1, ifFalse.v1 ) };
+            std::atomic_thread_fence( std::memory_order_release );
         }
     }
 
-    // Increment value
-    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> Increment( const Register<T, N, SIMD>& a )
+    // Hint that memory at ptr will be read soon
+    // LOCALITY 0 = no temporal locality (avoid cache pollution) ... 3 = keep in all cache levels
+    template<int LOCALITY = 3>
+    FS_FORCEINLINE void Prefetch( const void* ptr )
+    {
+        static_assert( LOCALITY >= 0 && LOCALITY <= 3, "FastSIMD: FS::Prefetch locality must be in range 0-3" );
+
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#if FASTSIMD_CURRENT_ARCH_IS( X86 )
+        _mm_prefetch( static_cast<const char*>( ptr ), LOCALITY == 3 ? _MM_HINT_T0 : LOCALITY == 2 ? _MM_HINT_T1 : LOCALITY == 1 ? _MM_HINT_T2 : _MM_HINT_NTA );
+#else
+        __prefetch( ptr );
+#endif
+#else
+        __builtin_prefetch( ptr, 0, LOCALITY );
+#endif
+    }
+
+
+    // impl
+    namespace impl { template<std::size_t C, typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE std::array<Register<T, N, SIMD>, C> LoadInterleaved( TypeWrapper<const T*, N, SIMD> ptr )
     {
+        std::array<Register<T, N, SIMD>, C> out;
+
         if constexpr( IsNativeV<Register<T, N, SIMD>> )
         {
-            return a - Register<T, N, SIMD>( -1 );
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[C][N];
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                for( std::size_t c = 0; c < C; c++ )
+                {
+                    values[c][i] = ptr.value[i * C + c];
+                }
+            }
+
+            for( std::size_t c = 0; c < C; c++ )
+            {
+                out[c] = Load( TypeWrapper<const T*, N, SIMD>( values[c] ) );
+            }
         }
         else
         {
-            return Register<T, N, SIMD>{ Increment( a.v0 ), Increment( a.v1 ) };
+            auto lo = LoadInterleaved<C>( ptr.AsHalf() );
+            auto hi = LoadInterleaved<C>( ptr.AsHalf( C * N / 2 ) );
+
+            for( std::size_t c = 0; c < C; c++ )
+            {
+                out[c] = Register<T, N, SIMD>{ lo[c], hi[c] };
+            }
         }
+        return out;
+    } }
+
+    // Load array of structures with 2/3/4 members, de-interleaving each member into its own register
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault(), typename T>
+    FS_FORCEINLINE std::array<Register<T, N, SIMD>, 2> LoadInterleaved2( const T* ptr )
+    {
+        return LoadInterleaved<2>( TypeWrapper<const T*, N, SIMD>( ptr ) );
+    }
+
+    template<typename R>
+    FS_FORCEINLINE std::array<R, 2> LoadInterleaved2( const typename R::ElementType* ptr )
+    {
+        return LoadInterleaved<2>( TypeWrapper<const typename R::ElementType*, R::ElementCount, R::FeatureFlags>( ptr ) );
+    }
+
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault(), typename T>
+    FS_FORCEINLINE std::array<Register<T, N, SIMD>, 3> LoadInterleaved3( const T* ptr )
+    {
+        return LoadInterleaved<3>( TypeWrapper<const T*, N, SIMD>( ptr ) );
+    }
+
+    template<typename R>
+    FS_FORCEINLINE std::array<R, 3> LoadInterleaved3( const typename R::ElementType* ptr )
+    {
+        return LoadInterleaved<3>( TypeWrapper<const typename R::ElementType*, R::ElementCount, R::FeatureFlags>( ptr ) );
+    }
+
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault(), typename T>
+    FS_FORCEINLINE std::array<Register<T, N, SIMD>, 4> LoadInterleaved4( const T* ptr )
+    {
+        return LoadInterleaved<4>( TypeWrapper<const T*, N, SIMD>( ptr ) );
+    }
+
+    template<typename R>
+    FS_FORCEINLINE std::array<R, 4> LoadInterleaved4( const typename R::ElementType* ptr )
+    {
+        return LoadInterleaved<4>( TypeWrapper<const typename R::ElementType*, R::ElementCount, R::FeatureFlags>( ptr ) );
+    }
+
+
+    // impl
+    namespace impl { template<std::size_t C, typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE void StoreInterleaved( typename Register<T, N, SIMD>::ElementType* ptr, const std::array<Register<T, N, SIMD>, C>& a )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[C][N];
+
+            for( std::size_t c = 0; c < C; c++ )
+            {
+                Store( values[c], a[c] );
+            }
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                for( std::size_t c = 0; c < C; c++ )
+                {
+                    ptr[i * C + c] = values[c][i];
+                }
+            }
+        }
+        else
+        {
+            std::array<Register<T, N / 2, SIMD>, C> lo, hi;
+
+            for( std::size_t c = 0; c < C; c++ )
+            {
+                lo[c] = a[c].v0;
+                hi[c] = a[c].v1;
+            }
+
+            StoreInterleaved( ptr, lo );
+            StoreInterleaved( ptr + C * N / 2, hi );
+        }
+    } }
+
+    // Store registers as an array of structures with 2/3/4 members, interleaving one element from each register
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE void StoreInterleaved2( typename Register<T, N, SIMD>::ElementType* ptr, const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    {
+        StoreInterleaved( ptr, std::array<Register<T, N, SIMD>, 2>{ a, b } );
+    }
+
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE void StoreInterleaved3( typename Register<T, N, SIMD>::ElementType* ptr, const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b, const Register<T, N, SIMD>& c )
+    {
+        StoreInterleaved( ptr, std::array<Register<T, N, SIMD>, 3>{ a, b, c } );
+    }
+
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE void StoreInterleaved4( typename Register<T, N, SIMD>::ElementType* ptr, const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b, const Register<T, N, SIMD>& c, const Register<T, N, SIMD>& d )
+    {
+        StoreInterleaved( ptr, std::array<Register<T, N, SIMD>, 4>{ a, b, c, d } );
+    }
+    
+    // Convert a mask into a uint bitmask of appropriate size for register element count
+    template<std::size_t S, bool F, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE BitStorage<N> BitMask( const Register<Mask<S, F>, N, SIMD>& a )
+    {
+        static_assert( !IsNativeV<Register<Mask<S, F>, N, SIMD>>, "FastSIMD: FS::BitMask not supported with provided types" );
+        return static_cast<BitStorage<N>>( BitMask( a.v0 ) ) | static_cast<BitStorage<N>>( static_cast<BitStorage<N>>( BitMask( a.v1 ) ) << ( N / 2 ) );
+    }
+    
+    // Load constant set of values into register
+    template<typename T, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault(), typename... Ts>
+    FS_FORCEINLINE Register<T, sizeof...( Ts ) + 1, SIMD> Constant( T value, Ts... values )
+    {
+        alignas( std::alignment_of_v<Register<T, sizeof...( Ts ) + 1, SIMD>> ) const T constArray[] = { value, T( values )... };
+
+        return Load<sizeof...( Ts ) + 1, SIMD>( constArray );
+    }
+    
+    template<typename T, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault(), std::int64_t... VALUEs>
+    FS_FORCEINLINE Register<T, sizeof...( VALUEs ), SIMD> Constant( std::integer_sequence<std::int64_t, VALUEs...> )
+    {
+        alignas( std::alignment_of_v<Register<T, sizeof...( VALUEs ), SIMD>> ) const T constArray[] = { T( VALUEs )... };
+
+        return Load<sizeof...( VALUEs ), SIMD>( constArray );
+    }
+    
+    // Extract first element
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE T Extract0( const Register<T, N, SIMD>& a )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Extract0 not supported with provided types" );
+        return Extract0( a.v0 );
+    }
+
+    // Reduce all elements to a single value using a binary operation
+    // op must be associative and is applied to registers of each width down to a single element
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD, typename OP>
+    FS_FORCEINLINE T Reduce( const Register<T, N, SIMD>& a, OP op )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            // No horizontal ops for this ToolSet, reduce upper half into lower half until one element remains
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+            Store( values, a );
+
+            Register<T, 1, SIMD> reduce[N];
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                reduce[i] = values[i];
+            }
+
+            for( std::size_t n = N / 2; n > 0; n /= 2 )
+            {
+                for( std::size_t i = 0; i < n; i++ )
+                {
+                    reduce[i] = op( reduce[i], reduce[i + n] );
+                }
+            }
+            return Extract0( reduce[0] );
+        }
+        else
+        {
+            return Reduce( op( a.v0, a.v1 ), op );
+        }
+    }
+
+    // Horizontal sum of all elements
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE T ReduceAdd( const Register<T, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return Reduce( a, []( const auto& x, const auto& y ) { return x + y; } );
+        }
+        else
+        {
+            return ReduceAdd( a.v0 + a.v1 );
+        }
+    }
+
+    // Minimum of all elements
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE T ReduceMin( const Register<T, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return Reduce( a, []( const auto& x, const auto& y ) { return Min( x, y ); } );
+        }
+        else
+        {
+            return ReduceMin( Min( a.v0, a.v1 ) );
+        }
+    }
+
+    // Maximum of all elements
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE T ReduceMax( const Register<T, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return Reduce( a, []( const auto& x, const auto& y ) { return Max( x, y ); } );
+        }
+        else
+        {
+            return ReduceMax( Max( a.v0, a.v1 ) );
+        }
+    }
+
+    // Bitwise and of all elements
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE T ReduceAnd( const Register<T, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return Reduce( a, []( const auto& x, const auto& y ) { return x & y; } );
+        }
+        else
+        {
+            return ReduceAnd( a.v0 & a.v1 );
+        }
+    }
+
+    // Bitwise or of all elements
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE T ReduceOr( const Register<T, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return Reduce( a, []( const auto& x, const auto& y ) { return x | y; } );
+        }
+        else
+        {
+            return ReduceOr( a.v0 | a.v1 );
+        }
+    }
+
+    // Incremented elements in a register { 0, 1, 2, ..., N - 1 }
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
+    FS_FORCEINLINE Register<T, N, SIMD> LoadIncremented()
+    {
+        return Constant<T, SIMD>( std::make_integer_sequence<std::int64_t, N>{} );
+    }
+
+    template<typename R>
+    FS_FORCEINLINE R LoadIncremented()
+    {
+        return Constant<typename R::ElementType, R::FeatureFlags>( std::make_integer_sequence<std::int64_t, R::ElementCount>{} );
+    }
+
+
+    // Load elements from base[idx[i]], element wise fallback when there is no native gather
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Gather( const T* base, const Register<std::int32_t, N, SIMD>& idx )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> || IsNativeV<Register<std::int32_t, N, SIMD>> )
+        {
+            alignas( std::alignment_of_v<Register<std::int32_t, N, SIMD>> ) std::int32_t indices[N];
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+
+            Store( indices, idx );
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                values[i] = base[indices[i]];
+            }
+            return Load<N, SIMD>( values );
+        }
+        else
+        {
+            return Register<T, N, SIMD>{ Gather( base, idx.v0 ), Gather( base, idx.v1 ) };
+        }
+    }
+
+    // Gather only active elements, inactive elements are zero and their addresses are not accessed
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> MaskedGather( const typename Register<T, N, SIMD>::MaskTypeArg& mask, const T* base, const Register<std::int32_t, N, SIMD>& idx )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> || IsNativeV<Register<std::int32_t, N, SIMD>> ||
+                      IsNativeV<typename Register<T, N, SIMD>::MaskTypeArg> )
+        {
+            alignas( std::alignment_of_v<Register<std::int32_t, N, SIMD>> ) std::int32_t indices[N];
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+
+            Store( indices, idx );
+            BitStorage<N> active = BitMask( mask );
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                values[i] = ( active >> i ) & 1 ? base[indices[i]] : T( 0 );
+            }
+            return Load<N, SIMD>( values );
+        }
+        else
+        {
+            return Register<T, N, SIMD>{ MaskedGather( mask.v0, base, idx.v0 ), MaskedGather( mask.v1, base, idx.v1 ) };
+        }
+    }
+
+    // Store elements to base[idx[i]], with duplicate indices the highest element wins
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE void Scatter( T* base, const Register<std::int32_t, N, SIMD>& idx, const Register<T, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> || IsNativeV<Register<std::int32_t, N, SIMD>> )
+        {
+            alignas( std::alignment_of_v<Register<std::int32_t, N, SIMD>> ) std::int32_t indices[N];
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+
+            Store( indices, idx );
+            Store( values, a );
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                base[indices[i]] = values[i];
+            }
+        }
+        else
+        {
+            Scatter( base, idx.v0, a.v0 );
+            Scatter( base, idx.v1, a.v1 );
+        }
+    }
+
+    // Scatter only active elements
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE void MaskedScatter( const typename Register<T, N, SIMD>::MaskTypeArg& mask, T* base, const Register<std::int32_t, N, SIMD>& idx, const Register<T, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> || IsNativeV<Register<std::int32_t, N, SIMD>> ||
+                      IsNativeV<typename Register<T, N, SIMD>::MaskTypeArg> )
+        {
+            alignas( std::alignment_of_v<Register<std::int32_t, N, SIMD>> ) std::int32_t indices[N];
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+
+            Store( indices, idx );
+            Store( values, a );
+            BitStorage<N> active = BitMask( mask );
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                if( ( active >> i ) & 1 )
+                {
+                    base[indices[i]] = values[i];
+                }
+            }
+        }
+        else
+        {
+            MaskedScatter( mask.v0, base, idx.v0, a.v0 );
+            MaskedScatter( mask.v1, base, idx.v1, a.v1 );
+        }
+    }
+
+    // impl
+    namespace impl { template<typename U, typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<U, N, SIMD> Convert( const Register<T, N, SIMD>& a, TypeDummy<U> )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS:Convert not supported with provided types" );
+        return Register<U, N, SIMD>{ Convert( a.v0, TypeDummy<U>{} ), Convert( a.v1, TypeDummy<U>{} ) };
+    } }
+
+    // Convert values
+    template<typename U, typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<U, N, SIMD> Convert( const Register<T, N, SIMD>& a )
+    {
+        return Convert( a, TypeDummy<U>{} );
+    }
+
+
+    // impl
+    namespace impl { template<typename U, typename T, std::size_t N, FastSIMD::FeatureSet SIMD, typename = EnableIfNotNative<Register<T, N, SIMD>>>
+    FS_FORCEINLINE Register<U, N, SIMD> Cast( const Register<T, N, SIMD>& a, TypeDummy<U> )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS:Cast not supported with provided types" );
+        return Register<U, N, SIMD>{ Cast( a.v0, TypeDummy<U>{} ), Cast( a.v1, TypeDummy<U>{} ) };
+    } }
+
+    // Cast values
+    template<typename U, typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<U, N, SIMD> Cast( const Register<T, N, SIMD>& a )
+    {
+        return Cast( a, TypeDummy<U>{} );
+    }
+
+
+    // Abs value
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Abs( const Register<T, N, SIMD>& a )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS:Abs not supported with provided types" );
+        return Register<T, N, SIMD>{ Abs( a.v0 ), Abs( a.v1 ) };
+    }
+
+    
+    // Round value, banker's rounding
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Round( const Register<T, N, SIMD>& a )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Round not supported with provided types" );
+        return Register<T, N, SIMD>{ Round( a.v0 ), Round( a.v1 ) };
+    }
+
+
+    // Floor value, round towards -infinity
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Floor( const Register<T, N, SIMD>& a )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Floor not supported with provided types" );
+        return Register<T, N, SIMD>{ Floor( a.v0 ), Floor( a.v1 ) };
+    }
+
+
+    // Ceil value, round towards +infinity
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Ceil( const Register<T, N, SIMD>& a )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Ceil not supported with provided types" );
+        return Register<T, N, SIMD>{ Ceil( a.v0 ), Ceil( a.v1 ) };
+    }
+
+    // Truncate value, round towards 0
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Trunc( const Register<T, N, SIMD>& a )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Trunc not supported with provided types" );
+        return Register<T, N, SIMD>{ Trunc( a.v0 ), Trunc( a.v1 ) };
+    }
+
+
+    // Min of 2 elements
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Min( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Min not supported with provided types" );
+        return Register<T, N, SIMD>{ Min( a.v0, b.v0 ), Min( a.v1, b.v1 ) };
+    }
+
+
+    // Max of 2 elements
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Max( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Max not supported with provided types" );
+        return Register<T, N, SIMD>{ Max( a.v0, b.v0 ), Max( a.v1, b.v1 ) };
+    }
+
+
+    // Saturating add, clamps to element type range instead of wrapping
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> AddSat( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    {
+        using RegisterT = Register<T, N, SIMD>;
+
+        if constexpr( std::is_same_v<T, std::int32_t> && IsNativeV<RegisterT> )
+        {
+            RegisterT sum = a + b;
+
+            // Overflow when both inputs have the same sign and the result does not
+            auto overflow = ( ( a ^ sum ) & ( b ^ sum ) ) < RegisterT( 0 );
+            return Select( overflow, ( a >> 31 ) ^ RegisterT( 0x7FFFFFFF ), sum );
+        }
+        else if constexpr( std::is_same_v<T, std::uint32_t> && IsNativeV<RegisterT> )
+        {
+            return a + Min( b, ~a );
+        }
+        else
+        {
+            static_assert( !IsNativeV<RegisterT>, "FastSIMD: FS::AddSat not supported with provided types" );
+            return RegisterT{ AddSat( a.v0, b.v0 ), AddSat( a.v1, b.v1 ) };
+        }
+    }
+
+
+    // Saturating sub, clamps to element type range instead of wrapping
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> SubSat( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    {
+        using RegisterT = Register<T, N, SIMD>;
+
+        if constexpr( std::is_same_v<T, std::int32_t> && IsNativeV<RegisterT> )
+        {
+            RegisterT diff = a - b;
+
+            // Overflow when the inputs have different signs and the result sign differs from a
+            auto overflow = ( ( a ^ b ) & ( a ^ diff ) ) < RegisterT( 0 );
+            return Select( overflow, ( a >> 31 ) ^ RegisterT( 0x7FFFFFFF ), diff );
+        }
+        else if constexpr( std::is_same_v<T, std::uint32_t> && IsNativeV<RegisterT> )
+        {
+            return Max( a, b ) - b;
+        }
+        else
+        {
+            static_assert( !IsNativeV<RegisterT>, "FastSIMD: FS::SubSat not supported with provided types" );
+            return RegisterT{ SubSat( a.v0, b.v0 ), SubSat( a.v1, b.v1 ) };
+        }
+    }
+
+
+    // Rounding average of unsigned elements: ( a + b + 1 ) >> 1
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Average( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Average not supported with provided types" );
+        return Register<T, N, SIMD>{ Average( a.v0, b.v0 ), Average( a.v1, b.v1 ) };
+    }
+
+
+    // Multiply high: upper half of the double width product a * b
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> MulHi( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::MulHi not supported with provided types" );
+        return Register<T, N, SIMD>{ MulHi( a.v0, b.v0 ), MulHi( a.v1, b.v1 ) };
+    }
+
+    // Widening multiply of the {Even|Odd} 32 bit lanes into 64 bit lanes, unsigned products are returned as their 64 bit pattern
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD, typename = std::enable_if_t<std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::uint32_t>>>
+    FS_FORCEINLINE Register<std::int64_t, N / 2, SIMD> MulWidenEven( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    {
+        if constexpr( N == 2 )
+        {
+            using WideT = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+
+            return static_cast<std::int64_t>( static_cast<WideT>( Extract0( a.v0 ) ) * static_cast<WideT>( Extract0( b.v0 ) ) );
+        }
+        else
+        {
+            static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::MulWidenEven not supported with provided types" );
+            return Register<std::int64_t, N / 2, SIMD>{ MulWidenEven( a.v0, b.v0 ), MulWidenEven( a.v1, b.v1 ) };
+        }
+    }
+
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD, typename = std::enable_if_t<std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::uint32_t>>>
+    FS_FORCEINLINE Register<std::int64_t, N / 2, SIMD> MulWidenOdd( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    {
+        if constexpr( N == 2 )
+        {
+            using WideT = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+
+            return static_cast<std::int64_t>( static_cast<WideT>( Extract0( a.v1 ) ) * static_cast<WideT>( Extract0( b.v1 ) ) );
+        }
+        else
+        {
+            static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::MulWidenOdd not supported with provided types" );
+            return Register<std::int64_t, N / 2, SIMD>{ MulWidenOdd( a.v0, b.v0 ), MulWidenOdd( a.v1, b.v1 ) };
+        }
+    }
+
+
+    // Select element from 2 registers using Mask
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Select( const typename Register<T, N, SIMD>::MaskTypeArg& mask, const Register<T, N, SIMD>& ifTrue, const Register<T, N, SIMD>& ifFalse )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::Select not supported with provided types" );
+        return Register<T, N, SIMD>{ Select( mask.v0, ifTrue.v0, ifFalse.v0 ), Select( mask.v1, ifTrue.v1, ifFalse.v1 ) };
+    }
+
+    // Select element from 2 registers using most significant bit from int or float
+    template<typename T, typename U, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> SelectHighBit( const Register<U, N, SIMD>& mask, const Register<T, N, SIMD>& ifTrue, const Register<T, N, SIMD>& ifFalse )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            if constexpr( std::is_same_v<typename Register<U, N, SIMD>::NativeType, typename Register<U, N, SIMD>::MaskType::NativeType> )
+        {
+                return Select( FS::Cast<typename Register<U, N, SIMD>::MaskType::ElementType>( FS::Cast<std::int32_t>( mask ) >> 31 ), ifTrue, ifFalse );                
+            }
+            else
+            {
+                return Select( FS::Cast<std::int32_t>( mask ) < Register<std::int32_t, N, SIMD>( 0 ), ifTrue, ifFalse );
+            }
+        }
+        else
+        {
+            return Register<T, N, SIMD>{ SelectHighBit( mask.v0, ifTrue.v0, ifFalse.v0 ), SelectHighBit( mask.v1, ifTrue.v1, ifFalse.v1 ) };
+        }
+    }
+
+    namespace impl
+    {
+        // True if every group of LANE elements is shuffled using the same pattern within the group
+        template<std::size_t LANE, std::size_t... I>
+        constexpr bool IsLaneRepeatedShuffle()
+        {
+            constexpr std::size_t idx[] = { I... };
+
+            for( std::size_t i = 0; i < sizeof...( I ); i++ )
+            {
+                if( idx[i % LANE] >= LANE || idx[i] != idx[i % LANE] + i / LANE * LANE )
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // True if R is split into halves that are natively supported
+        template<typename R, typename = void>
+        constexpr bool IsSplitIntoNative = false;
+
+        template<typename R>
+        constexpr bool IsSplitIntoNative<R, std::void_t<decltype( R::v0 )>> = IsNativeV<decltype( R::v0 )>;
+
+        // True if a 32 bit integer register can be cast to a float register with the same layout
+        template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+        constexpr bool IsCastableToFloat = sizeof( T ) == 4 && !std::is_same_v<T, float> &&
+            IsNativeV<Register<T, N, SIMD>> == IsNativeV<Register<std::conditional_t<sizeof( T ) == 4, float, T>, N, SIMD>>;
+    }
+
+    // Rearrange elements using compile time indices, element i of the result is a[I[i]]
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD, std::size_t... I>
+    FS_FORCEINLINE Register<T, N, SIMD> Shuffle( const Register<T, N, SIMD>& a, std::index_sequence<I...> )
+    {
+        static_assert( sizeof...( I ) == N, "FastSIMD: FS::Shuffle requires one index per element" );
+        static_assert( ( ( I < N ) && ... ), "FastSIMD: FS::Shuffle index out of range" );
+
+        if constexpr( impl::IsCastableToFloat<T, N, SIMD> )
+        {
+            return Cast<T>( Shuffle( Cast<float>( a ), std::index_sequence<I...>{} ) );
+        }
+        else
+        {
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+            Store( values, a );
+
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) const T shuffled[] = { values[I]... };
+
+            return Load<N, SIMD>( shuffled );
+        }
+    }
+
+    template<std::size_t... I, typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Shuffle( const Register<T, N, SIMD>& a )
+    {
+        return Shuffle( a, std::index_sequence<I...>{} );
+    }
+
+    // Rearrange elements using runtime indices, element i of the result is a[idx[i] % N]
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Permute( const Register<T, N, SIMD>& a, const Register<std::int32_t, N, SIMD>& idx )
+    {
+        static_assert( sizeof( T ) == 4, "FastSIMD: FS::Permute only supports 32 bit element types" );
+
+        if constexpr( impl::IsCastableToFloat<T, N, SIMD> )
+        {
+            return Cast<T>( Permute( Cast<float>( a ), idx ) );
+        }
+        else if constexpr( impl::IsSplitIntoNative<Register<T, N, SIMD>> )
+        {
+            return Register<T, N, SIMD>{ Permute2( a.v0, a.v1, idx.v0 ), Permute2( a.v0, a.v1, idx.v1 ) };
+        }
+        else
+        {
+            // No variable permute for this ToolSet, or splitting further would multiply the work
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+            alignas( std::alignment_of_v<Register<std::int32_t, N, SIMD>> ) std::int32_t indices[N];
+            Store( values, a );
+            Store( indices, idx );
+
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T permuted[N];
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                permuted[i] = values[indices[i] & ( N - 1 )];
+            }
+
+            return Load<N, SIMD>( permuted );
+        }
+    }
+
+    // Rearrange elements from 2 registers using runtime indices, element i of the result is ( a : b )[idx[i] % ( N * 2 )]
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Permute2( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b, const Register<std::int32_t, N, SIMD>& idx )
+    {
+        static_assert( sizeof( T ) == 4, "FastSIMD: FS::Permute2 only supports 32 bit element types" );
+
+        if constexpr( impl::IsCastableToFloat<T, N, SIMD> )
+        {
+            return Cast<T>( Permute2( Cast<float>( a ), Cast<float>( b ), idx ) );
+        }
+        else
+        {
+            using RegisterI = Register<std::int32_t, N, SIMD>;
+
+            return Select( ( idx & RegisterI( static_cast<std::int32_t>( N ) ) ) != RegisterI( 0 ), Permute( b, idx ), Permute( a, idx ) );
+        }
+    }
+
+    // Look up bytes from a table register, element i of the result is table[idx[i]] or 0 if idx[i] >= N
+    template<typename T, typename U, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> TableLookup( const Register<T, N, SIMD>& table, const Register<U, N, SIMD>& idx )
+    {
+        static_assert( sizeof( T ) == 1 && sizeof( U ) == 1, "FastSIMD: FS::TableLookup only supports 8 bit element types" );
+
+        if constexpr( !std::is_same_v<T, std::uint8_t> || !std::is_same_v<U, std::uint8_t> )
+        {
+            return Cast<T>( TableLookup( Cast<std::uint8_t>( table ), Cast<std::uint8_t>( idx ) ) );
+        }
+        else if constexpr( impl::IsSplitIntoNative<Register<T, N, SIMD>> )
+        {
+            // Indices for the upper half wrap past the end of the lower half table and vice versa, so the results can be combined
+            using RegisterHalf = Register<T, N / 2, SIMD>;
+            const RegisterHalf halfCount( static_cast<T>( N / 2 ) );
+
+            return Register<T, N, SIMD>{ TableLookup( table.v0, idx.v0 ) | TableLookup( table.v1, idx.v0 - halfCount ),
+                                         TableLookup( table.v0, idx.v1 ) | TableLookup( table.v1, idx.v1 - halfCount ) };
+        }
+        else
+        {
+            // No byte shuffle for this ToolSet, or splitting further would multiply the work
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T indices[N];
+            Store( values, table );
+            Store( indices, idx );
+
+            for( std::size_t i = 0; i < N; i++ )
+            {
+                indices[i] = indices[i] < N ? values[indices[i]] : T( 0 );
+            }
+
+            return Load<N, SIMD>( indices );
+        }
+    }
+
+    namespace impl
+    {
+        template<std::size_t V, std::size_t... I>
+        constexpr std::index_sequence<( static_cast<void>( I ), V )...> RepeatIndex( std::index_sequence<I...> )
+        {
+            return {};
+        }
+
+        // Broadcast the last element to all elements
+        template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<T, N, SIMD> BroadcastLast( const Register<T, N, SIMD>& a )
+        {
+            if constexpr( IsNativeV<Register<T, N, SIMD>> )
+            {
+                return Shuffle( a, RepeatIndex<N - 1>( std::make_index_sequence<N>{} ) );
+            }
+            else
+            {
+                const Register<T, N / 2, SIMD> last = BroadcastLast( a.v1 );
+                return Register<T, N, SIMD>{ last, last };
+            }
+        }
+    }
+
+    // Inclusive prefix sum, element i of the result is a[0] + ... + a[i]
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> PrefixSum( const Register<T, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            // No native scan for this ToolSet
+            alignas( std::alignment_of_v<Register<T, N, SIMD>> ) T values[N];
+            Store( values, a );
+
+            for( std::size_t i = 1; i < N; i++ )
+            {
+                values[i] += values[i - 1];
+            }
+
+            return Load<N, SIMD>( values );
+        }
+        else
+        {
+            const Register<T, N / 2, SIMD> low = PrefixSum( a.v0 );
+
+            return Register<T, N, SIMD>{ low, PrefixSum( a.v1 ) + impl::BroadcastLast( low ) };
+        }
+    }
+
+    // Inclusive prefix sum of count elements from src into dst, running total is carried between registers. dst may equal src
+    template<typename R>
+    FS_FORCEINLINE void PrefixSum( typename R::ElementType* dst, const typename R::ElementType* src, std::size_t count )
+    {
+        constexpr std::size_t N = R::ElementCount;
+
+        R carry( typename R::ElementType( 0 ) );
+        std::size_t i = 0;
+
+        for( ; i + N <= count; i += N )
+        {
+            const R sum = PrefixSum( Load<R>( src + i ) ) + carry;
+            Store( dst + i, sum );
+            carry = impl::BroadcastLast( sum );
+        }
+
+        if( i < count )
+        {
+            StorePartial( dst + i, PrefixSum( LoadPartial<R>( src + i, count - i ) ) + carry, count - i );
+        }
+    }
+
+    // Increment value
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Increment( const Register<T, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return a - Register<T, N, SIMD>( -1 );
+        }
+        else
+        {
+            return Register<T, N, SIMD>{ Increment( a.v0 ), Increment( a.v1 ) };
+        }
+    }
+
+    // Decrement value
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Decrement( const Register<T, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return a + Register<T, N, SIMD>( -1 );
+        }
+        else
+        {
+            return Register<T, N, SIMD>{ Decrement( a.v0 ), Decrement( a.v1 ) };
+        }
+    }
+    
+    // FMulAdd: (a * b) + c
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> FMulAdd( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b, const Register<T, N, SIMD>& c )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return (a * b) + c;
+        }
+        else
+        {        
+            return Register<T, N, SIMD>{ FMulAdd( a.v0, b.v0, c.v0 ), FMulAdd( a.v1, b.v1, c.v1 ) };
+        }
+    }
+    
+    // FMulSub: (a * b) - c
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> FMulSub( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b, const Register<T, N, SIMD>& c )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return (a * b) - c;
+        }
+        else
+        {        
+            return Register<T, N, SIMD>{ FMulSub( a.v0, b.v0, c.v0 ), FMulSub( a.v1, b.v1, c.v1 ) };
+        }
+    }
+    
+    // FNMulAdd: -(a * b) + c
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> FNMulAdd( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b, const Register<T, N, SIMD>& c )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return c - (a * b);
+        }
+        else
+        {        
+            return Register<T, N, SIMD>{ FNMulAdd( a.v0, b.v0, c.v0 ), FNMulAdd( a.v1, b.v1, c.v1 ) };
+        }
+    }
+    
+    // FNMulSub: -(a * b) - c
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> FNMulSub( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b, const Register<T, N, SIMD>& c )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return -c - (a * b);
+        }
+        else
+        {        
+            return Register<T, N, SIMD>{ FNMulSub( a.v0, b.v0, c.v0 ), FNMulSub( a.v1, b.v1, c.v1 ) };
+        }
+    }
+
+    namespace impl
+    {
+        // Largest power of 2 below count, Estrin splits coefficients here
+        constexpr std::size_t PolyEstrinSplit( std::size_t count )
+        {
+            std::size_t split = 1;
+            while( split * 2 < count )
+            {
+                split *= 2;
+            }
+            return split;
+        }
+
+        constexpr std::size_t PolyEstrinLevel( std::size_t split )
+        {
+            std::size_t level = 0;
+            while( ( std::size_t( 1 ) << level ) < split )
+            {
+                level++;
+            }
+            return level;
+        }
+
+        // Estrin over coeffs[BEGIN, BEGIN + COUNT), xPow[i] = x^(2^i)
+        template<std::size_t BEGIN, std::size_t COUNT, typename T, std::size_t N, FastSIMD::FeatureSet SIMD, std::size_t K>
+        FS_FORCEINLINE Register<T, N, SIMD> PolyEstrinRange( const Register<T, N, SIMD>* xPow, const T ( &coeffs )[K] )
+        {
+            if constexpr( COUNT == 1 )
+            {
+                return Register<T, N, SIMD>( coeffs[BEGIN] );
+            }
+            else
+            {
+                constexpr std::size_t split = PolyEstrinSplit( COUNT );
+
+                return FMulAdd( PolyEstrinRange<BEGIN + split, COUNT - split>( xPow, coeffs ), xPow[PolyEstrinLevel( split )],
+                                PolyEstrinRange<BEGIN, split>( xPow, coeffs ) );
+            }
+        }
+    }
+
+    // PolyHorner: coeffs[0] + coeffs[1] * x + coeffs[2] * x^2 ...
+    // One FMulAdd per coefficient, all in series
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD, std::size_t K>
+    FS_FORCEINLINE Register<T, N, SIMD> PolyHorner( const Register<T, N, SIMD>& x, const T ( &coeffs )[K] )
+    {
+        Register<T, N, SIMD> poly( coeffs[K - 1] );
+
+        for( std::size_t i = K - 1; i-- > 0; )
+        {
+            poly = FMulAdd( poly, x, Register<T, N, SIMD>( coeffs[i] ) );
+        }
+        return poly;
+    }
+
+    // PolyEstrin: coeffs[0] + coeffs[1] * x + coeffs[2] * x^2 ...
+    // Evaluates coefficient pairs in parallel and combines them with x^2, x^4...
+    // Critical path is ~log2(K) FMulAdds instead of K - 1, rounding differs from PolyHorner
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD, std::size_t K>
+    FS_FORCEINLINE Register<T, N, SIMD> PolyEstrin( const Register<T, N, SIMD>& x, const T ( &coeffs )[K] )
+    {
+        constexpr std::size_t kLevels = impl::PolyEstrinLevel( impl::PolyEstrinSplit( K ) ) + 1;
+
+        Register<T, N, SIMD> xPow[kLevels];
+        xPow[0] = x;
+
+        for( std::size_t i = 1; i < kLevels; i++ )
+        {
+            xPow[i] = xPow[i - 1] * xPow[i - 1];
+        }
+        return impl::PolyEstrinRange<0, K>( xPow, coeffs );
+    }
+
+    // Poly: c0 + c1 * x + c2 * x^2 ..., Horner below degree 4, Estrin from degree 4
+    // FMulAdd fuses when FASTSIMD_IS_RELAXED and the FeatureSet has FMA, otherwise it is a separate mul and add
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD, typename... COEFFS>
+    FS_FORCEINLINE Register<T, N, SIMD> Poly( const Register<T, N, SIMD>& x, const COEFFS&... coeffs )
+    {
+        const T coeffArray[] = { static_cast<T>( coeffs )... };
+
+        if constexpr( sizeof...( COEFFS ) < 5 )
+        {
+            return PolyHorner( x, coeffArray );
+        }
+        else
+        {
+            return PolyEstrin( x, coeffArray );
+        }
+    }
+    
+    // Bitwise AndNot
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> BitwiseAndNot( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return a & (~b);
+        }
+        else
+        {
+            return Register<T, N, SIMD>{ BitwiseAndNot( a.v0, b.v0 ), BitwiseAndNot( a.v1, b.v1 ) };
+        }
+    }    
+
+    // BitShift Right Zero Extend
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> BitShiftRightZeroExtend( const Register<T, N, SIMD>& a, int b )
+    {
+        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::BitShiftRightZeroExtend not supported with provided types" );
+        return Register<T, N, SIMD>{ BitShiftRightZeroExtend( a.v0, b ), BitShiftRightZeroExtend( a.v1, b ) };
     }
 
-    // Decrement value
+    // BitShift Right Zero Extend, per element shift count
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> Decrement( const Register<T, N, SIMD>& a )
+    FS_FORCEINLINE Register<T, N, SIMD> BitShiftRightZeroExtend( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
     {
         if constexpr( IsNativeV<Register<T, N, SIMD>> )
         {
-            return a + Register<T, N, SIMD>( -1 );
+            using U = std::make_unsigned_t<T>;
+            return Cast<T>( Cast<U>( a ) >> Cast<U>( b ) );
         }
         else
         {
-            return Register<T, N, SIMD>{ Decrement( a.v0 ), Decrement( a.v1 ) };
+            return Register<T, N, SIMD>{ BitShiftRightZeroExtend( a.v0, b.v0 ), BitShiftRightZeroExtend( a.v1, b.v1 ) };
         }
     }
-    
-    // FMulAdd: (a * b) + c
-    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> FMulAdd( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b, const Register<T, N, SIMD>& c )
+
+    namespace impl
     {
-        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        // Parallel bit sums of 32 bit elements, for ToolSets without a bit count instruction
+        template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<T, N, SIMD> PopCountSwar( const Register<T, N, SIMD>& a )
         {
-            return (a * b) + c;
+            using RegisterU = Register<std::uint32_t, N, SIMD>;
+
+            RegisterU v = Cast<std::uint32_t>( a );
+            v -= ( v >> 1 ) & RegisterU( 0x55555555 );
+            v = ( v & RegisterU( 0x33333333 ) ) + ( ( v >> 2 ) & RegisterU( 0x33333333 ) );
+            v = ( v + ( v >> 4 ) ) & RegisterU( 0x0F0F0F0F );
+            return Cast<T>( ( v * RegisterU( 0x01010101 ) ) >> 24 );
         }
-        else
-        {        
-            return Register<T, N, SIMD>{ FMulAdd( a.v0, b.v0, c.v0 ), FMulAdd( a.v1, b.v1, c.v1 ) };
+
+        // Leading zero count of 32 bit elements from the float exponent of the highest set bit
+        template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<T, N, SIMD> CountLeadingZerosFloat( const Register<T, N, SIMD>& a )
+        {
+            using RegisterI = Register<std::int32_t, N, SIMD>;
+
+            // Clearing the bit below each set bit stops the conversion rounding up to the next power of 2
+            RegisterI v = Cast<std::int32_t>( a );
+            v = BitwiseAndNot( v, BitShiftRightZeroExtend( v, 1 ) );
+
+            RegisterI exponent = ( Cast<std::int32_t>( Convert<float>( v ) ) >> 23 ) & RegisterI( 0xFF );
+            return Cast<T>( InvMasked( v < RegisterI( 0 ), Min( RegisterI( 127 + 31 ) - exponent, RegisterI( 32 ) ) ) );
+        }
+
+        template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<T, N, SIMD> RotateLeftShift( const Register<T, N, SIMD>& a, int b )
+        {
+            b &= 31;
+            return ( a << b ) | BitShiftRightZeroExtend( a, ( 32 - b ) & 31 );
         }
     }
-    
-    // FMulSub: (a * b) - c
+
+    // Count set bits in each 32 bit element
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> FMulSub( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b, const Register<T, N, SIMD>& c )
+    FS_FORCEINLINE Register<T, N, SIMD> PopCount( const Register<T, N, SIMD>& a )
     {
-        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        static_assert( std::is_integral_v<T> && sizeof( T ) == 4, "FastSIMD: FS::PopCount only supports 32 bit integer elements" );
+
+        if constexpr( std::is_unsigned_v<T> )
         {
-            return (a * b) - c;
+            return Cast<T>( PopCount( Cast<std::make_signed_t<T>>( a ) ) );
+        }
+        else if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return impl::PopCountSwar( a );
         }
         else
-        {        
-            return Register<T, N, SIMD>{ FMulSub( a.v0, b.v0, c.v0 ), FMulSub( a.v1, b.v1, c.v1 ) };
+        {
+            return Register<T, N, SIMD>{ PopCount( a.v0 ), PopCount( a.v1 ) };
         }
     }
-    
-    // FNMulAdd: -(a * b) + c
+
+    // Count zero bits above the highest set bit in each 32 bit element, 32 for 0
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> FNMulAdd( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b, const Register<T, N, SIMD>& c )
+    FS_FORCEINLINE Register<T, N, SIMD> CountLeadingZeros( const Register<T, N, SIMD>& a )
     {
-        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        static_assert( std::is_integral_v<T> && sizeof( T ) == 4, "FastSIMD: FS::CountLeadingZeros only supports 32 bit integer elements" );
+
+        if constexpr( std::is_unsigned_v<T> )
         {
-            return c - (a * b);
+            return Cast<T>( CountLeadingZeros( Cast<std::make_signed_t<T>>( a ) ) );
+        }
+        else if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return impl::CountLeadingZerosFloat( a );
         }
         else
-        {        
-            return Register<T, N, SIMD>{ FNMulAdd( a.v0, b.v0, c.v0 ), FNMulAdd( a.v1, b.v1, c.v1 ) };
+        {
+            return Register<T, N, SIMD>{ CountLeadingZeros( a.v0 ), CountLeadingZeros( a.v1 ) };
         }
     }
-    
-    // FNMulSub: -(a * b) - c
+
+    // Count zero bits below the lowest set bit in each 32 bit element, 32 for 0
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> FNMulSub( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b, const Register<T, N, SIMD>& c )
+    FS_FORCEINLINE Register<T, N, SIMD> CountTrailingZeros( const Register<T, N, SIMD>& a )
     {
-        if constexpr( IsNativeV<Register<T, N, SIMD>> )
-        {
-            return -c - (a * b);
-        }
-        else
-        {        
-            return Register<T, N, SIMD>{ FNMulSub( a.v0, b.v0, c.v0 ), FNMulSub( a.v1, b.v1, c.v1 ) };
-        }
+        static_assert( std::is_integral_v<T> && sizeof( T ) == 4, "FastSIMD: FS::CountTrailingZeros only supports 32 bit integer elements" );
+
+        // Bits below the lowest set bit: ( a - 1 ) & ~a
+        return PopCount( BitwiseAndNot( a - Register<T, N, SIMD>( 1 ), a ) );
     }
-    
-    // Bitwise AndNot
+
+    // Rotate bits of each 32 bit element left by b, bits shifted out the top wrap around to the bottom
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> BitwiseAndNot( const Register<T, N, SIMD>& a, const Register<T, N, SIMD>& b )
+    FS_FORCEINLINE Register<T, N, SIMD> RotateLeft( const Register<T, N, SIMD>& a, int b )
     {
-        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        static_assert( std::is_integral_v<T> && sizeof( T ) == 4, "FastSIMD: FS::RotateLeft only supports 32 bit integer elements" );
+
+        if constexpr( std::is_unsigned_v<T> )
         {
-            return a & (~b);
+            return Cast<T>( RotateLeft( Cast<std::make_signed_t<T>>( a ), b ) );
+        }
+        else if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            return impl::RotateLeftShift( a, b );
         }
         else
         {
-            return Register<T, N, SIMD>{ BitwiseAndNot( a.v0, b.v0 ), BitwiseAndNot( a.v1, b.v1 ) };
+            return Register<T, N, SIMD>{ RotateLeft( a.v0, b ), RotateLeft( a.v1, b ) };
         }
-    }    
-
-    // BitShift Right Zero Extend
-    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
-    FS_FORCEINLINE Register<T, N, SIMD> BitShiftRightZeroExtend( const Register<T, N, SIMD>& a, int b )
-    {
-        static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::BitShiftRightZeroExtend not supported with provided types" );
-        return Register<T, N, SIMD>{ BitShiftRightZeroExtend( a.v0, b ), BitShiftRightZeroExtend( a.v1, b ) };
     }
     
     // Mask elements
@@ -496,6 +1725,87 @@ namespace FS
         }
     }
 
+    // Precomputed divisor for integer division by a runtime invariant value, divisor must not be 0
+    // Division becomes a multiply high and shifts, from "Division by Invariant Integers using Multiplication" (Granlund, Montgomery)
+    template<typename T>
+    struct IntDivider;
+
+    template<>
+    struct IntDivider<std::int32_t>
+    {
+        explicit IntDivider( std::int32_t d ) : divisor( d )
+        {
+            std::uint32_t absDivisor = d < 0 ? 0u - static_cast<std::uint32_t>( d ) : static_cast<std::uint32_t>( d );
+
+            // ceil( log2( |d| ) ), minimum 1
+            int log2 = 1;
+            while( ( std::uint64_t( 1 ) << log2 ) < absDivisor )
+            {
+                log2++;
+            }
+
+            multiplier = static_cast<std::int32_t>( 1 + static_cast<std::int64_t>( ( std::uint64_t( 1 ) << ( 31 + log2 ) ) / absDivisor ) - ( std::int64_t( 1 ) << 32 ) );
+            shift = log2 - 1;
+            sign = d < 0 ? -1 : 0;
+        }
+
+        std::int32_t divisor;
+        std::int32_t multiplier;
+        int shift;
+        std::int32_t sign;
+    };
+
+    template<>
+    struct IntDivider<std::uint32_t>
+    {
+        explicit IntDivider( std::uint32_t d ) : divisor( d )
+        {
+            // ceil( log2( d ) )
+            int log2 = 0;
+            while( ( std::uint64_t( 1 ) << log2 ) < d )
+            {
+                log2++;
+            }
+
+            multiplier = static_cast<std::uint32_t>( ( ( ( std::uint64_t( 1 ) << log2 ) - d ) << 32 ) / d + 1 );
+            shift1 = log2 < 1 ? log2 : 1;
+            shift2 = log2 < 1 ? 0 : log2 - 1;
+        }
+
+        std::uint32_t divisor;
+        std::uint32_t multiplier;
+        int shift1;
+        int shift2;
+    };
+
+    // Integer division by a precomputed divisor, rounds towards 0
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Div( const Register<T, N, SIMD>& a, const IntDivider<T>& divider )
+    {
+        using RegisterT = Register<T, N, SIMD>;
+
+        if constexpr( std::is_signed_v<T> )
+        {
+            RegisterT quotient = ( ( a + MulHi( a, RegisterT( divider.multiplier ) ) ) >> divider.shift ) - ( a >> ( sizeof( T ) * 8 - 1 ) );
+
+            RegisterT sign( divider.sign );
+            return ( quotient ^ sign ) - sign;
+        }
+        else
+        {
+            RegisterT high = MulHi( a, RegisterT( divider.multiplier ) );
+
+            return ( high + ( ( a - high ) >> divider.shift1 ) ) >> divider.shift2;
+        }
+    }
+
+    // Integer modulus by a precomputed divisor, result has the sign of a
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Mod( const Register<T, N, SIMD>& a, const IntDivider<T>& divider )
+    {
+        return a - Div( a, divider ) * Register<T, N, SIMD>( divider.divisor );
+    }
+
     // Reciprocal: 1 / a
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
     FS_FORCEINLINE Register<T, N, SIMD> Reciprocal( const Register<T, N, SIMD>& a )
@@ -524,6 +1834,71 @@ namespace FS
         }   
     }
 
+    // Precision tiers for Reciprocal<P> and InvSqrt<P>, float only
+    // Only exact float ops are used so results are bit identical across FeatureSets at every tier
+    // This does not hold when FASTSIMD_IS_RELAXED since the compiler may contract into FMA
+    enum class Precision
+    {
+        Estimate,   // Bit trick seed plus one tuned Newton step, relative error below 1.2e-3 (~9.7 bits)
+        NewtonStep, // Estimate plus one Newton-Raphson step, relative error below 1.5e-6 (~19 bits)
+        Full        // Correctly rounded division and square root
+    };
+
+    // Reciprocal: 1 / a with a compile time precision, eg: Reciprocal<Precision::NewtonStep>( a )
+    // Estimate and NewtonStep are valid for |a| in FLT_MIN:2^125
+    template<Precision P, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<float, N, SIMD> Reciprocal( const Register<float, N, SIMD>& a )
+    {
+        using RegisterF = Register<float, N, SIMD>;
+
+        if constexpr( P == Precision::Full )
+        {
+            return RegisterF( 1.0f ) / a;
+        }
+        else
+        {
+            using RegisterI = Register<std::int32_t, N, SIMD>;
+
+            // Magic constant and step scale minimise max error of the first step
+            RegisterF absA = Abs( a );
+            RegisterF y = Cast<float>( RegisterI( 0x7EEE3DC3 ) - Cast<std::int32_t>( absA ) );
+            y *= RegisterF( 2.04939127f ) - RegisterF( 1.04881835f ) * absA * y;
+
+            if constexpr( P == Precision::NewtonStep )
+            {
+                y *= RegisterF( 2.0f ) - absA * y;
+            }
+            return y ^ ( a ^ absA );
+        }
+    }
+
+    // Inv Sqrt: 1 / sqrt( a ) with a compile time precision, eg: InvSqrt<Precision::NewtonStep>( a )
+    // Estimate and NewtonStep are valid for a in FLT_MIN:FLT_MAX
+    template<Precision P, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<float, N, SIMD> InvSqrt( const Register<float, N, SIMD>& a )
+    {
+        using RegisterF = Register<float, N, SIMD>;
+
+        if constexpr( P == Precision::Full )
+        {
+            return RegisterF( 1.0f ) / Sqrt( a );
+        }
+        else
+        {
+            using RegisterI = Register<std::int32_t, N, SIMD>;
+
+            // Magic constant and step scale minimise max error of the first step
+            RegisterF y = Cast<float>( RegisterI( 0x5F30EE86 ) - ( Cast<std::int32_t>( a ) >> 1 ) );
+            y *= RegisterF( 1.54720140f ) - RegisterF( 0.547875822f ) * a * y * y;
+
+            if constexpr( P == Precision::NewtonStep )
+            {
+                y *= RegisterF( 1.5f ) - RegisterF( 0.5f ) * a * y * y;
+            }
+            return y;
+        }
+    }
+
     // Sqrt
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
     FS_FORCEINLINE Register<T, N, SIMD> Sqrt( const Register<T, N, SIMD>& a )
@@ -634,7 +2009,7 @@ namespace FS
 
             RegisterF xx = value * value;
             y *= xx;
-            y *= e * RegisterF( -2.12194440e-4f );
+            y += e * RegisterF( -2.12194440e-4f );
             y -= xx * RegisterF( 0.5f );
 
             value += y;
@@ -660,6 +2035,97 @@ namespace FS
             return Register<T, N, SIMD>{ Pow( value.v0, pow.v0 ), Pow( value.v1, pow.v1 ) };
         }
     }
+
+    // Pow Int: value^pow with a per lane integer exponent, exponentiation by squaring
+    // Rounding error grows with |pow|, loops until the largest |pow| in the register is consumed
+    template<std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<float, N, SIMD> PowInt( const Register<float, N, SIMD>& value, const Register<std::int32_t, N, SIMD>& pow )
+    {
+        if constexpr( IsNativeV<Register<float, N, SIMD>> )
+        {
+            using RegisterF = Register<float, N, SIMD>;
+            using RegisterI = Register<std::int32_t, N, SIMD>;
+
+            // Abs( INT_MIN ) stays INT_MIN, which is 2^31 when shifted as unsigned
+            RegisterI bits = Abs( pow );
+            RegisterF base = value;
+            RegisterF result( 1.0f );
+
+            while( AnyMask( bits != RegisterI( 0 ) ) )
+            {
+                result = SelectHighBit( bits << 31, result * base, result );
+                base *= base;
+                bits = BitShiftRightZeroExtend( bits, 1 );
+            }
+
+            return SelectHighBit( pow, RegisterF( 1.0f ) / result, result );
+        }
+        else
+        {
+            return Register<float, N, SIMD>{ PowInt( value.v0, pow.v0 ), PowInt( value.v1, pow.v1 ) };
+        }
+    }
+
+    namespace impl
+    {
+        template<unsigned int POW, typename T>
+        FS_FORCEINLINE T PowUnsigned( const T& value )
+        {
+            if constexpr( POW == 0 )
+            {
+                return T( 1 );
+            }
+            else if constexpr( POW == 1 )
+            {
+                return value;
+            }
+            else
+            {
+                T half = PowUnsigned<POW / 2>( value );
+
+                if constexpr( POW % 2 )
+                {
+                    return half * half * value;
+                }
+                else
+                {
+                    return half * half;
+                }
+            }
+        }
+    }
+
+    // Pow: value^(NUM / DEN) for a compile time exponent, DEN must be 1 or 2
+    // Reduces to multiplies plus Reciprocal, Sqrt or InvSqrt, eg: Pow<3>( v ) or Pow<-1, 2>( v )
+    // Reciprocal and InvSqrt are estimates on some FeatureSets when FASTSIMD_IS_RELAXED
+    template<int NUM, int DEN = 1, typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> Pow( const Register<T, N, SIMD>& value )
+    {
+        static_assert( DEN == 1 || DEN == 2, "FastSIMD: FS::Pow compile time exponent denominator must be 1 or 2" );
+
+        constexpr unsigned int absNum = NUM < 0 ? 0u - static_cast<unsigned int>( NUM ) : static_cast<unsigned int>( NUM );
+
+        if constexpr( DEN == 2 && absNum % 2 == 0 )
+        {
+            return Pow<NUM / 2>( value );
+        }
+        else if constexpr( DEN == 2 && NUM < 0 )
+        {
+            return impl::PowUnsigned<absNum>( InvSqrt( value ) );
+        }
+        else if constexpr( DEN == 2 )
+        {
+            return impl::PowUnsigned<absNum / 2>( value ) * Sqrt( value );
+        }
+        else if constexpr( NUM < 0 )
+        {
+            return Reciprocal( impl::PowUnsigned<absNum>( value ) );
+        }
+        else
+        {
+            return impl::PowUnsigned<absNum>( value );
+        }
+    }
     
     // Any Mask
     // returns true if any mask bits are set
@@ -670,6 +2136,134 @@ namespace FS
         return AnyMask( a.v0 ) || AnyMask( a.v1 );
     }
 
+    // impl
+    namespace impl
+    {
+        template<typename T>
+        FS_FORCEINLINE int CountBits( T bits )
+        {
+#if defined( _MSC_VER ) && !defined( __clang__ )
+            int count = 0;
+            for( ; bits; bits &= bits - 1 )
+            {
+                count++;
+            }
+            return count;
+#else
+            return __builtin_popcountll( bits );
+#endif
+        }
+
+        // bits must not be 0
+        template<typename T>
+        FS_FORCEINLINE int LowestBitIndex( T bits )
+        {
+#if defined( _MSC_VER ) && !defined( __clang__ )
+            int index = 0;
+            for( ; !( bits & 1 ); bits >>= 1 )
+            {
+                index++;
+            }
+            return index;
+#else
+            return __builtin_ctzll( bits );
+#endif
+        }
+
+        // bits must not be 0
+        template<typename T>
+        FS_FORCEINLINE int HighestBitIndex( T bits )
+        {
+#if defined( _MSC_VER ) && !defined( __clang__ )
+            int index = 0;
+            for( ; bits >>= 1; )
+            {
+                index++;
+            }
+            return index;
+#else
+            return 63 - __builtin_clzll( bits );
+#endif
+        }
+    }
+
+    // All Mask
+    // returns true if all mask bits are set
+    template<std::size_t S, bool F, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE bool AllMask( const Register<Mask<S, F>, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<Mask<S, F>, N, SIMD>> )
+        {
+            return BitMask( a ) == static_cast<BitStorage<N>>( ~std::uint64_t( 0 ) >> ( 64 - N ) );
+        }
+        else
+        {
+            return AllMask( a.v0 ) && AllMask( a.v1 );
+        }
+    }
+
+    // None Mask
+    // returns true if no mask bits are set
+    template<std::size_t S, bool F, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE bool NoneMask( const Register<Mask<S, F>, N, SIMD>& a )
+    {
+        return !AnyMask( a );
+    }
+
+    // Count True
+    // returns the number of set mask bits
+    template<std::size_t S, bool F, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE int CountTrue( const Register<Mask<S, F>, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<Mask<S, F>, N, SIMD>> )
+        {
+            return impl::CountBits( BitMask( a ) );
+        }
+        else
+        {
+            return CountTrue( a.v0 ) + CountTrue( a.v1 );
+        }
+    }
+
+    // First True Index
+    // returns the index of the lowest set mask bit, -1 if none are set
+    template<std::size_t S, bool F, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE int FirstTrueIndex( const Register<Mask<S, F>, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<Mask<S, F>, N, SIMD>> )
+        {
+            BitStorage<N> bits = BitMask( a );
+            return bits ? impl::LowestBitIndex( bits ) : -1;
+        }
+        else
+        {
+            int index = FirstTrueIndex( a.v0 );
+            if( index < 0 )
+            {
+                index = FirstTrueIndex( a.v1 );
+                index += index < 0 ? 0 : (int)( N / 2 );
+            }
+            return index;
+        }
+    }
+
+    // Last True Index
+    // returns the index of the highest set mask bit, -1 if none are set
+    template<std::size_t S, bool F, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE int LastTrueIndex( const Register<Mask<S, F>, N, SIMD>& a )
+    {
+        if constexpr( IsNativeV<Register<Mask<S, F>, N, SIMD>> )
+        {
+            BitStorage<N> bits = BitMask( a );
+            return bits ? impl::HighestBitIndex( bits ) : -1;
+        }
+        else
+        {
+            int index = LastTrueIndex( a.v1 );
+            return index < 0 ? LastTrueIndex( a.v0 ) : index + (int)( N / 2 );
+        }
+    }
+
     namespace impl
     {
         template<bool ZERO, typename T>
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <utility>
 #include <tuple>
+#include <array>
 
 #include <FastSIMD/Utility/ArchDetect.h>
 #include <FastSIMD/Utility/FeatureEnums.h>
@@ -297,15 +298,45 @@ namespace FS
     using EnableIfNotRelaxed = std::enable_if_t<!FastSIMD::IsRelaxed<SIMD>()>;
 
 
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
+    using i8 = Register<std::int8_t, N, SIMD>;
+
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
+    using u8 = Register<std::uint8_t, N, SIMD>;
+
+    template<std::size_t N, bool OPTIMISE_FLOAT = true, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
+    using m8 = Register<Mask<8, OPTIMISE_FLOAT>, N, SIMD>;
+
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
+    using i16 = Register<std::int16_t, N, SIMD>;
+
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
+    using u16 = Register<std::uint16_t, N, SIMD>;
+
+    template<std::size_t N, bool OPTIMISE_FLOAT = true, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
+    using m16 = Register<Mask<16, OPTIMISE_FLOAT>, N, SIMD>;
+
     template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
     using i32 = Register<std::int32_t, N, SIMD>;
 
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
+    using u32 = Register<std::uint32_t, N, SIMD>;
+
     template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
     using f32 = Register<float, N, SIMD>;
 
     template<std::size_t N, bool OPTIMISE_FLOAT = true, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
     using m32 = Register<Mask<32, OPTIMISE_FLOAT>, N, SIMD>;
 
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
+    using i64 = Register<std::int64_t, N, SIMD>;
+
+    template<std::size_t N, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
+    using f64 = Register<double, N, SIMD>;
+
+    template<std::size_t N, bool OPTIMISE_FLOAT = true, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
+    using m64 = Register<Mask<64, OPTIMISE_FLOAT>, N, SIMD>;
+
     template<std::size_t N>
     using BitStorage = std::tuple_element_t<( N > 8 ) + ( N > 16 ) + ( N > 32 ),
                                             std::tuple<std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t>>;
@@ -313,6 +344,70 @@ namespace FS
     template<typename T>
     static constexpr std::size_t NativeRegisterCount( FastSIMD::FeatureSet featureSet = FastSIMD::FeatureSetDefault() );
 
+    template<>
+    constexpr std::size_t NativeRegisterCount<std::int8_t>( FastSIMD::FeatureSet featureSet )
+    {
+        if( featureSet & FastSIMD::FeatureFlag::AVX512_BW )
+        {
+            return 64;
+        }
+        if( featureSet & FastSIMD::FeatureFlag::AVX2 )
+        {
+            return 32;
+        }
+        if( featureSet & (FastSIMD::FeatureFlag::SSE2 |
+            FastSIMD::FeatureFlag::NEON | FastSIMD::FeatureFlag::WASM) )
+        {
+            return 16;
+        }
+
+        return 1;
+    }
+
+    template<>
+    constexpr std::size_t NativeRegisterCount<std::uint8_t>( FastSIMD::FeatureSet featureSet )
+    {
+        return NativeRegisterCount<std::int8_t>( featureSet );
+    }
+
+    template<>
+    constexpr std::size_t NativeRegisterCount<Mask<8>>( FastSIMD::FeatureSet featureSet )
+    {
+        return NativeRegisterCount<std::int8_t>( featureSet );
+    }
+
+    template<>
+    constexpr std::size_t NativeRegisterCount<std::int16_t>( FastSIMD::FeatureSet featureSet )
+    {
+        if( featureSet & FastSIMD::FeatureFlag::AVX512_BW )
+        {
+            return 32;
+        }
+        if( featureSet & FastSIMD::FeatureFlag::AVX2 )
+        {
+            return 16;
+        }
+        if( featureSet & (FastSIMD::FeatureFlag::SSE2 |
+            FastSIMD::FeatureFlag::NEON | FastSIMD::FeatureFlag::WASM) )
+        {
+            return 8;
+        }
+
+        return 1;
+    }
+
+    template<>
+    constexpr std::size_t NativeRegisterCount<std::uint16_t>( FastSIMD::FeatureSet featureSet )
+    {
+        return NativeRegisterCount<std::int16_t>( featureSet );
+    }
+
+    template<>
+    constexpr std::size_t NativeRegisterCount<Mask<16>>( FastSIMD::FeatureSet featureSet )
+    {
+        return NativeRegisterCount<std::int16_t>( featureSet );
+    }
+
     template<>
     constexpr std::size_t NativeRegisterCount<float>( FastSIMD::FeatureSet featureSet )
     {
@@ -353,6 +448,12 @@ namespace FS
         return 1;
     }
 
+    template<>
+    constexpr std::size_t NativeRegisterCount<std::uint32_t>( FastSIMD::FeatureSet featureSet )
+    {
+        return NativeRegisterCount<std::int32_t>( featureSet );
+    }
+
     template<>
     constexpr std::size_t NativeRegisterCount<Mask<32>>( FastSIMD::FeatureSet featureSet )
     {
@@ -373,6 +474,52 @@ namespace FS
         return 1;
     }
 
+    template<>
+    constexpr std::size_t NativeRegisterCount<double>( FastSIMD::FeatureSet featureSet )
+    {
+        if( featureSet & FastSIMD::FeatureFlag::AVX512_F )
+        {
+            return 8;
+        }
+        if( featureSet & FastSIMD::FeatureFlag::AVX )
+        {
+            return 4;
+        }
+        if( featureSet & (FastSIMD::FeatureFlag::SSE2 |
+            FastSIMD::FeatureFlag::AARCH64 | FastSIMD::FeatureFlag::WASM) )
+        {
+            return 2;
+        }
+
+        return 1;
+    }
+
+    template<>
+    constexpr std::size_t NativeRegisterCount<std::int64_t>( FastSIMD::FeatureSet featureSet )
+    {
+        if( featureSet & FastSIMD::FeatureFlag::AVX512_F )
+        {
+            return 8;
+        }
+        if( featureSet & FastSIMD::FeatureFlag::AVX2 )
+        {
+            return 4;
+        }
+        if( featureSet & (FastSIMD::FeatureFlag::SSE2 |
+            FastSIMD::FeatureFlag::AARCH64 | FastSIMD::FeatureFlag::WASM) )
+        {
+            return 2;
+        }
+
+        return 1;
+    }
+
+    template<>
+    constexpr std::size_t NativeRegisterCount<Mask<64>>( FastSIMD::FeatureSet featureSet )
+    {
+        return NativeRegisterCount<double>( featureSet );
+    }
+
     template<typename T, FastSIMD::FeatureSet SIMD = FastSIMD::FeatureSetDefault()>
     using NativeRegister = Register<T, NativeRegisterCount<T>( SIMD ), SIMD>;
 
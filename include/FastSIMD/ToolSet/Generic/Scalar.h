@@ -1,6 +1,10 @@
 #pragma once
 #include "Scalar/i32x1.h"
+#include "Scalar/u32x1.h"
 #include "Scalar/f32x1.h"
+#include "Scalar/i64x1.h"
+#include "Scalar/iNx1.h"
+#include "Scalar/f64x1.h"
 #include "Scalar/mNx1.h"
 
 namespace FS
@@ -17,6 +21,96 @@ namespace FS
         return static_cast<float>( a.GetNative() );
     }
 
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<1, SIMD>>>
+    FS_FORCEINLINE u32<1, SIMD> Convert( const f32<1, SIMD>& a, TypeDummy<uint32_t> )
+    {
+        return static_cast<std::uint32_t>( std::rintf( a.GetNative() ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<1, SIMD>>>
+    FS_FORCEINLINE f32<1, SIMD> Convert( const u32<1, SIMD>& a, TypeDummy<float> )
+    {
+        return static_cast<float>( a.GetNative() );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<1, SIMD>>>
+    FS_FORCEINLINE f64<1, SIMD> Convert( const f32<1, SIMD>& a, TypeDummy<double> )
+    {
+        return static_cast<double>( a.GetNative() );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<1, SIMD>>>
+    FS_FORCEINLINE f32<1, SIMD> Convert( const f64<1, SIMD>& a, TypeDummy<float> )
+    {
+        return static_cast<float>( a.GetNative() );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<1, SIMD>>>
+    FS_FORCEINLINE f64<1, SIMD> Convert( const i32<1, SIMD>& a, TypeDummy<double> )
+    {
+        return static_cast<double>( a.GetNative() );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<1, SIMD>>>
+    FS_FORCEINLINE i32<1, SIMD> Convert( const f64<1, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return static_cast<std::int32_t>( std::rint( a.GetNative() ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<1, SIMD>>>
+    FS_FORCEINLINE i16<1, SIMD> Convert( const i8<1, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return static_cast<std::int16_t>( a.GetNative() );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<1, SIMD>>>
+    FS_FORCEINLINE u16<1, SIMD> Convert( const u8<1, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        return static_cast<std::uint16_t>( a.GetNative() );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<1, SIMD>>>
+    FS_FORCEINLINE i32<1, SIMD> Convert( const i16<1, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return static_cast<std::int32_t>( a.GetNative() );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<1, SIMD>>>
+    FS_FORCEINLINE i32<1, SIMD> Convert( const u16<1, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return static_cast<std::int32_t>( a.GetNative() );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<1, SIMD>>>
+    FS_FORCEINLINE i8<1, SIMD> Convert( const i16<1, SIMD>& a, TypeDummy<int8_t> )
+    {
+        return impl::SaturateCast<std::int8_t>( a.GetNative() );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<1, SIMD>>>
+    FS_FORCEINLINE u8<1, SIMD> Convert( const i16<1, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        return impl::SaturateCast<std::uint8_t>( a.GetNative() );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<1, SIMD>>>
+    FS_FORCEINLINE u8<1, SIMD> Convert( const u16<1, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        return impl::SaturateCast<std::uint8_t>( a.GetNative() );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<1, SIMD>>>
+    FS_FORCEINLINE i16<1, SIMD> Convert( const i32<1, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return impl::SaturateCast<std::int16_t>( a.GetNative() );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<1, SIMD>>>
+    FS_FORCEINLINE u16<1, SIMD> Convert( const i32<1, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        return impl::SaturateCast<std::uint16_t>( a.GetNative() );
+    }
+
     template<typename U, typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 1, SIMD>>>
     FS_FORCEINLINE Register<U, 1, SIMD> Cast( const Register<T, 1, SIMD>& a, TypeDummy<U> )
     {
@@ -88,9 +182,18 @@ namespace FS
     }
 
     template<typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 1, SIMD>>, typename = EnableIfNotRelaxed<SIMD>>
-    FS_FORCEINLINE f32<1, SIMD> Modulus( const Register<T, 1, SIMD>& a, const Register<T, 1, SIMD>& b )
+    FS_FORCEINLINE Register<T, 1, SIMD> Modulus( const Register<T, 1, SIMD>& a, const Register<T, 1, SIMD>& b )
     {
-        return std::fmod( a.GetNative(), b.GetNative() );
+        if constexpr( FastSIMD::IsDeterministic<SIMD>() )
+        {
+            // Match the generic implementation used by every other ToolSet
+            T ab = a.GetNative() / b.GetNative();
+            return ( ab - std::trunc( ab ) ) * b.GetNative();
+        }
+        else
+        {
+            return std::fmod( a.GetNative(), b.GetNative() );
+        }
     }
 
     template<typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 1, SIMD>>>
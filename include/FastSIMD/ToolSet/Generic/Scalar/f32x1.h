@@ -140,6 +140,13 @@ namespace FS
         return std::cos( a.native.f );
     }
 
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<1, SIMD>>, typename = EnableIfRelaxed<SIMD>>
+    FS_FORCEINLINE void SinCos( const f32<1, SIMD>& a, f32<1, SIMD>& outSin, f32<1, SIMD>& outCos )
+    {
+        outSin = std::sin( a.native.f );
+        outCos = std::cos( a.native.f );
+    }
+
     template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<1, SIMD>>, typename = EnableIfRelaxed<SIMD>>
     FS_FORCEINLINE f32<1, SIMD> Log( const f32<1, SIMD>& a )
     {
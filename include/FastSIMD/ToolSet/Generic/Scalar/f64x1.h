@@ -0,0 +1,130 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<double, 1, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::Scalar>>
+    {
+        static constexpr size_t ElementCount = 1;
+        static constexpr auto FeatureFlags = SIMD;
+        
+        using NativeType = double;
+        using ElementType = double;
+        using MaskType = m64<ElementCount, true, SIMD>;
+        using MaskTypeArg = m64<ElementCount, true, SIMD>;
+
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native{ v } { }
+        
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native.f;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native.f = native.f + rhs.native.f;
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native.f = native.f - rhs.native.f;
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native.f = native.f * rhs.native.f;
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator /=( const Register& rhs )
+        {
+            native.f = native.f / rhs.native.f;
+            return *this;
+        }
+        
+            
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native.i = native.i & rhs.native.i;
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native.i = native.i | rhs.native.i;
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native.i = native.i ^ rhs.native.i;    
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            Register reg;
+            reg.native.i = ~native.i;
+            return reg;        
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return -native.f;
+        }
+
+        
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return native.f == rhs.native.f;
+        }
+        
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return native.f != rhs.native.f;
+        }
+        
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return native.f >= rhs.native.f;
+        }
+        
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return native.f <= rhs.native.f;
+        }
+        
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return native.f > rhs.native.f;
+        }
+        
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return native.f < rhs.native.f;
+        }
+
+        union
+        {
+            double f;
+            std::int64_t i;
+        }
+        native;
+    };    
+    
+    
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<1, SIMD>>>
+    FS_FORCEINLINE f64<1, SIMD> Sqrt( const f64<1, SIMD>& a )
+    {
+        return std::sqrt( a.native.f );
+    }
+}
@@ -75,6 +75,18 @@ namespace FS
             return *this;
         }
 
+        FS_FORCEINLINE Register& operator >>=( const Register& rhs )
+        {
+            native = native >> rhs.native;
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( const Register& rhs )
+        {
+            native = native << rhs.native;
+            return *this;
+        }
+
         FS_FORCEINLINE Register operator ~() const
         {
             return ~native;        
@@ -125,4 +137,40 @@ namespace FS
     {
         return static_cast<std::int32_t>( static_cast<std::uint32_t>( a.native ) >> b );
     }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<1, SIMD>>>
+    FS_FORCEINLINE i32<1, SIMD> MulHi( const i32<1, SIMD>& a, const i32<1, SIMD>& b )
+    {
+        return static_cast<std::int32_t>( ( static_cast<std::int64_t>( a.native ) * b.native ) >> 32 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<1, SIMD>>>
+    FS_FORCEINLINE i32<1, SIMD> PopCount( const i32<1, SIMD>& a )
+    {
+        std::int32_t count = 0;
+        for( std::uint32_t v = static_cast<std::uint32_t>( a.native ); v; v &= v - 1 )
+        {
+            count++;
+        }
+        return count;
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<1, SIMD>>>
+    FS_FORCEINLINE i32<1, SIMD> CountLeadingZeros( const i32<1, SIMD>& a )
+    {
+        std::int32_t count = 0;
+        for( std::uint32_t v = static_cast<std::uint32_t>( a.native ); count < 32 && !( v & 0x80000000u ); v <<= 1 )
+        {
+            count++;
+        }
+        return count;
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<1, SIMD>>>
+    FS_FORCEINLINE i32<1, SIMD> RotateLeft( const i32<1, SIMD>& a, int b )
+    {
+        std::uint32_t v = static_cast<std::uint32_t>( a.native );
+        b &= 31;
+        return static_cast<std::int32_t>( b ? ( v << b ) | ( v >> ( 32 - b ) ) : v );
+    }
 }
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace FS
+{
+    namespace impl
+    {
+        // 8 and 16 bit integer element types sharing the scalar implementation below
+        template<typename T>
+        static constexpr bool IsSmallIntV = std::is_same_v<T, std::int8_t> || std::is_same_v<T, std::uint8_t> ||
+                                            std::is_same_v<T, std::int16_t> || std::is_same_v<T, std::uint16_t>;
+
+        // Clamp to the range of T before narrowing, scalar equivalent of the SIMD saturating packs
+        template<typename T, typename U>
+        FS_FORCEINLINE T SaturateCast( U v )
+        {
+            return static_cast<T>( std::clamp<U>( v, static_cast<U>( std::numeric_limits<T>::min() ), static_cast<U>( std::numeric_limits<T>::max() ) ) );
+        }
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD>
+    struct Register<T, 1, SIMD, std::enable_if_t<( SIMD & FastSIMD::FeatureFlag::Scalar ) && impl::IsSmallIntV<T>>>
+    {
+        static constexpr size_t ElementCount = 1;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = T;
+        using ElementType = T;
+        using MaskType = Register<Mask<sizeof( T ) * 8, false>, ElementCount, SIMD>;
+        using MaskTypeArg = Register<Mask<sizeof( T ) * 8, true>, ElementCount, SIMD>;
+
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = static_cast<T>( native + rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = static_cast<T>( native - rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = static_cast<T>( static_cast<std::uint32_t>( native ) * static_cast<std::uint32_t>( rhs.native ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = native & rhs.native;
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = native | rhs.native;
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = native ^ rhs.native;
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = static_cast<T>( native >> rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = static_cast<T>( static_cast<std::uint32_t>( native ) << rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return static_cast<T>( ~native );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return static_cast<T>( -native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return native == rhs.native;
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return native != rhs.native;
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return native >= rhs.native;
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return native <= rhs.native;
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return native > rhs.native;
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return native < rhs.native;
+        }
+
+        NativeType native;
+    };
+
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 1, SIMD>>, typename = std::enable_if_t<impl::IsSmallIntV<T> && std::is_signed_v<T>>>
+    FS_FORCEINLINE Register<T, 1, SIMD> BitShiftRightZeroExtend( const Register<T, 1, SIMD>& a, int b )
+    {
+        return static_cast<T>( static_cast<std::make_unsigned_t<T>>( a.native ) >> b );
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 1, SIMD>>, typename = std::enable_if_t<impl::IsSmallIntV<T>>>
+    FS_FORCEINLINE Register<T, 1, SIMD> AddSat( const Register<T, 1, SIMD>& a, const Register<T, 1, SIMD>& b )
+    {
+        return impl::SaturateCast<T>( static_cast<std::int32_t>( a.native ) + static_cast<std::int32_t>( b.native ) );
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 1, SIMD>>, typename = std::enable_if_t<impl::IsSmallIntV<T>>>
+    FS_FORCEINLINE Register<T, 1, SIMD> SubSat( const Register<T, 1, SIMD>& a, const Register<T, 1, SIMD>& b )
+    {
+        return impl::SaturateCast<T>( static_cast<std::int32_t>( a.native ) - static_cast<std::int32_t>( b.native ) );
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 1, SIMD>>, typename = std::enable_if_t<impl::IsSmallIntV<T> && std::is_unsigned_v<T>>>
+    FS_FORCEINLINE Register<T, 1, SIMD> Average( const Register<T, 1, SIMD>& a, const Register<T, 1, SIMD>& b )
+    {
+        return static_cast<T>( ( static_cast<std::uint32_t>( a.native ) + static_cast<std::uint32_t>( b.native ) + 1 ) >> 1 );
+    }
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::uint32_t, 1, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::Scalar>>
+    {
+        static constexpr size_t ElementCount = 1;
+        static constexpr auto FeatureFlags = SIMD;
+        
+        using NativeType = std::uint32_t;
+        using ElementType = std::uint32_t;
+        using MaskType = m32<ElementCount, false, SIMD>;
+        using MaskTypeArg = m32<ElementCount, true, SIMD>;
+
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = native + rhs.native;
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = native - rhs.native;
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = native * rhs.native;
+            return *this;
+        }
+            
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = native & rhs.native;
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = native | rhs.native;
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = native ^ rhs.native;
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = native >> rhs;
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = native << rhs;
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( const Register& rhs )
+        {
+            native = native >> rhs.native;
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( const Register& rhs )
+        {
+            native = native << rhs.native;
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return ~native;        
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return 0u - native;
+        }
+
+        
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return native == rhs.native;
+        }
+        
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return native != rhs.native;
+        }
+        
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return native >= rhs.native;
+        }
+        
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return native <= rhs.native;
+        }
+        
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return native > rhs.native;
+        }
+        
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return native < rhs.native;
+        }
+
+        NativeType native;
+    };
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<1, SIMD>>>
+    FS_FORCEINLINE u32<1, SIMD> MulHi( const u32<1, SIMD>& a, const u32<1, SIMD>& b )
+    {
+        return static_cast<std::uint32_t>( ( static_cast<std::uint64_t>( a.native ) * b.native ) >> 32 );
+    }
+}
@@ -95,15 +95,8 @@ namespace FS
         FS_FORCEINLINE Register<T, N, SIMD> ACos_0_1( const Register<T, N, SIMD>& x )
         {
             using C = TrigConstants<T>;
-            Register<T, N, SIMD> poly( C::ACOS_DEG8_C8 );
-            poly = FMulAdd( poly, x, Register<T, N, SIMD>( C::ACOS_DEG8_C7 ) );
-            poly = FMulAdd( poly, x, Register<T, N, SIMD>( C::ACOS_DEG8_C6 ) );
-            poly = FMulAdd( poly, x, Register<T, N, SIMD>( C::ACOS_DEG8_C5 ) );
-            poly = FMulAdd( poly, x, Register<T, N, SIMD>( C::ACOS_DEG8_C4 ) );
-            poly = FMulAdd( poly, x, Register<T, N, SIMD>( C::ACOS_DEG8_C3 ) );
-            poly = FMulAdd( poly, x, Register<T, N, SIMD>( C::ACOS_DEG8_C2 ) );
-            poly = FMulAdd( poly, x, Register<T, N, SIMD>( C::ACOS_DEG8_C1 ) );
-            poly = FMulAdd( poly, x, Register<T, N, SIMD>( C::ACOS_DEG8_C0 ) );
+            Register<T, N, SIMD> poly = Poly( x, C::ACOS_DEG8_C0, C::ACOS_DEG8_C1, C::ACOS_DEG8_C2, C::ACOS_DEG8_C3, C::ACOS_DEG8_C4,
+                                                 C::ACOS_DEG8_C5, C::ACOS_DEG8_C6, C::ACOS_DEG8_C7, C::ACOS_DEG8_C8 );
             return poly * Sqrt( Register<T, N, SIMD>( (T)1.0 ) - x );
         }
 
@@ -113,13 +106,8 @@ namespace FS
         {
             using C = TrigConstants<T>;
             Register<T, N, SIMD> xsqr = x * x;
-            Register<T, N, SIMD> poly( C::ATAN_DEG13_C6 );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::ATAN_DEG13_C5 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::ATAN_DEG13_C4 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::ATAN_DEG13_C3 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::ATAN_DEG13_C2 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::ATAN_DEG13_C1 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::ATAN_DEG13_C0 ) );
+            Register<T, N, SIMD> poly = Poly( xsqr, C::ATAN_DEG13_C0, C::ATAN_DEG13_C1, C::ATAN_DEG13_C2, C::ATAN_DEG13_C3, C::ATAN_DEG13_C4,
+                                                    C::ATAN_DEG13_C5, C::ATAN_DEG13_C6 );
             return poly * x;
         }
 
@@ -129,12 +117,8 @@ namespace FS
         {
             using C = TrigConstants<T>;
             Register<T, N, SIMD> xsqr = x * x;
-            Register<T, N, SIMD> poly( C::COS_DEG10_C5 );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::COS_DEG10_C4 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::COS_DEG10_C3 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::COS_DEG10_C2 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::COS_DEG10_C1 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::COS_DEG10_C0 ) );
+            Register<T, N, SIMD> poly = Poly( xsqr, C::COS_DEG10_C0, C::COS_DEG10_C1, C::COS_DEG10_C2, C::COS_DEG10_C3, C::COS_DEG10_C4,
+                                                    C::COS_DEG10_C5 );
             return poly;
         }
 
@@ -166,12 +150,8 @@ namespace FS
         {
             using C = TrigConstants<T>;
             Register<T, N, SIMD> xsqr = x * x;
-            Register<T, N, SIMD> poly( C::SIN_DEG11_C5 );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::SIN_DEG11_C4 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::SIN_DEG11_C3 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::SIN_DEG11_C2 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::SIN_DEG11_C1 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::SIN_DEG11_C0 ) );
+            Register<T, N, SIMD> poly = Poly( xsqr, C::SIN_DEG11_C0, C::SIN_DEG11_C1, C::SIN_DEG11_C2, C::SIN_DEG11_C3, C::SIN_DEG11_C4,
+                                                    C::SIN_DEG11_C5 );
             return poly * x;
         }
 
@@ -198,19 +178,28 @@ namespace FS
             return y;
         }
 
+        // Sine and cosine approximations for range -pi/2:pi/2, sharing x^2
+        template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE void SinCos_NegHalfPi_HalfPi( const Register<T, N, SIMD>& x, Register<T, N, SIMD>& outSin, Register<T, N, SIMD>& outCos )
+        {
+            using C = TrigConstants<T>;
+            Register<T, N, SIMD> xsqr = x * x;
+            Register<T, N, SIMD> polySin = Poly( xsqr, C::SIN_DEG11_C0, C::SIN_DEG11_C1, C::SIN_DEG11_C2, C::SIN_DEG11_C3, C::SIN_DEG11_C4,
+                                                       C::SIN_DEG11_C5 );
+            Register<T, N, SIMD> polyCos = Poly( xsqr, C::COS_DEG10_C0, C::COS_DEG10_C1, C::COS_DEG10_C2, C::COS_DEG10_C3, C::COS_DEG10_C4,
+                                                       C::COS_DEG10_C5 );
+            outSin = polySin * x;
+            outCos = polyCos;
+        }
+
         // Tangent approximation for range -pi/4:pi/4
         template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
         FS_FORCEINLINE Register<T, N, SIMD> Tan_NegQuartPi_QuartPi( const Register<T, N, SIMD>& x )
         {
             using C = TrigConstants<T>;
             Register<T, N, SIMD> xsqr = x * x;
-            Register<T, N, SIMD> poly( C::TAN_DEG13_C6 );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::TAN_DEG13_C5 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::TAN_DEG13_C4 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::TAN_DEG13_C3 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::TAN_DEG13_C2 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::TAN_DEG13_C1 ) );
-            poly = FMulAdd( poly, xsqr, Register<T, N, SIMD>( C::TAN_DEG13_C0 ) );
+            Register<T, N, SIMD> poly = Poly( xsqr, C::TAN_DEG13_C0, C::TAN_DEG13_C1, C::TAN_DEG13_C2, C::TAN_DEG13_C3, C::TAN_DEG13_C4,
+                                                    C::TAN_DEG13_C5, C::TAN_DEG13_C6 );
             return poly * x;
         }
 
@@ -245,14 +234,8 @@ namespace FS
         FS_FORCEINLINE Register<T, N, SIMD> Log2_T_0_1( const Register<T, N, SIMD>& t )
         {
             using C = TrigConstants<T>;
-            Register<T, N, SIMD> poly( C::LOG2_DEG8_C8 );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::LOG2_DEG8_C7 ) );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::LOG2_DEG8_C6 ) );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::LOG2_DEG8_C5 ) );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::LOG2_DEG8_C4 ) );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::LOG2_DEG8_C3 ) );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::LOG2_DEG8_C2 ) );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::LOG2_DEG8_C1 ) );
+            Register<T, N, SIMD> poly = Poly( t, C::LOG2_DEG8_C1, C::LOG2_DEG8_C2, C::LOG2_DEG8_C3, C::LOG2_DEG8_C4, C::LOG2_DEG8_C5,
+                                                 C::LOG2_DEG8_C6, C::LOG2_DEG8_C7, C::LOG2_DEG8_C8 );
             return poly * t;
         }
 
@@ -269,14 +252,8 @@ namespace FS
         FS_FORCEINLINE Register<T, N, SIMD> Exp2_0_1( const Register<T, N, SIMD>& t )
         {
             using C = TrigConstants<T>;
-            Register<T, N, SIMD> poly( C::EXP2_DEG7_C7 );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::EXP2_DEG7_C6 ) );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::EXP2_DEG7_C5 ) );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::EXP2_DEG7_C4 ) );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::EXP2_DEG7_C3 ) );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::EXP2_DEG7_C2 ) );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::EXP2_DEG7_C1 ) );
-            poly = FMulAdd( poly, t, Register<T, N, SIMD>( C::EXP2_DEG7_C0 ) );
+            Register<T, N, SIMD> poly = Poly( t, C::EXP2_DEG7_C0, C::EXP2_DEG7_C1, C::EXP2_DEG7_C2, C::EXP2_DEG7_C3, C::EXP2_DEG7_C4,
+                                                 C::EXP2_DEG7_C5, C::EXP2_DEG7_C6, C::EXP2_DEG7_C7 );
             return poly;
         }
 
@@ -461,6 +438,27 @@ namespace FS
         }
     }
 
+    // SinCos: range -inf:inf, shares range reduction between sin and cos
+    // Results match Sin and Cos
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE void SinCos( const Register<T, N, SIMD>& x, Register<T, N, SIMD>& outSin, Register<T, N, SIMD>& outCos )
+    {
+        if constexpr( IsNativeV<Register<T, N, SIMD>> )
+        {
+            // Cos_Reduce maps to the same y as Sin_Reduce
+            Register<T, N, SIMD> y, sign;
+            impl::Cos_Reduce( x, y, sign );
+            impl::SinCos_NegHalfPi_HalfPi( y, outSin, outCos );
+            outCos = sign * outCos;
+        }
+        else
+        {
+            static_assert( !IsNativeV<Register<T, N, SIMD>>, "FastSIMD: FS::SinCos not supported with provided types" );
+            SinCos( x.v0, outSin.v0, outCos.v0 );
+            SinCos( x.v1, outSin.v1, outCos.v1 );
+        }
+    }
+
     // Tan: range -inf:inf
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
     FS_FORCEINLINE Register<T, N, SIMD> Tan( const Register<T, N, SIMD>& x )
@@ -494,6 +492,16 @@ namespace FS
         }
     }
 
+    // TanFromSinCos: range -inf:inf, sin / cos from a single SinCos
+    // Cheaper than Tan which evaluates its polynomial twice
+    template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<T, N, SIMD> TanFromSinCos( const Register<T, N, SIMD>& x )
+    {
+        Register<T, N, SIMD> sin, cos;
+        SinCos( x, sin, cos );
+        return sin / cos;
+    }
+
     // Log2: log2(x) for x>0
     template<typename T, std::size_t N, FastSIMD::FeatureSet SIMD>
     FS_FORCEINLINE Register<T, N, SIMD> Log2( const Register<T, N, SIMD>& x )
@@ -568,4 +576,678 @@ namespace FS
             return Register<T, N, SIMD>{ Exp( x.v0 ), Exp( x.v1 ) };
         }
     }
+
+    namespace impl
+    {
+        // Float constants for the FS::Precise and FS::Fast accuracy tiers
+        struct TierConstants
+        {
+            static constexpr float K_INV_PI      = 0.318309886183790672f;
+            static constexpr float K_INV_HALF_PI = 0.636619772367581343f;
+            static constexpr float K_LOG2E       = 1.44269504088896341f;
+            static constexpr float K_LOG2E_M1    = 0.44269504088896341f;
+            static constexpr float K_LN2         = 0.693147180559945309f;
+            static constexpr float K_SQRT_HALF   = 0.707106781186547524f;
+
+            // pi/2 and pi split into 12 bit parts, q * part is exact for |q| < 2^12
+            static constexpr float HALF_PI_P1 = +1.57080078125f;
+            static constexpr float HALF_PI_P2 = -4.453584551811218e-06f;
+            static constexpr float HALF_PI_P3 = -8.706138032721356e-10f;
+            static constexpr float HALF_PI_P4 = +6.223371969669989e-14f;
+            static constexpr float PI_P1      = +3.1416015625f;
+            static constexpr float PI_P2      = -8.907169103622437e-06f;
+            static constexpr float PI_P3      = -1.7411031505432106e-09f;
+
+            // Precise SIN/COS polynomial coefficients, range -pi/4:pi/4
+            static constexpr float SIN_DEG7_C1 = -1.6666654611e-01f;
+            static constexpr float SIN_DEG7_C2 = +8.3321608736e-03f;
+            static constexpr float SIN_DEG7_C3 = -1.9515295891e-04f;
+            static constexpr float COS_DEG8_C2 = +4.166664568298827e-02f;
+            static constexpr float COS_DEG8_C3 = -1.388731625493765e-03f;
+            static constexpr float COS_DEG8_C4 = +2.443315711809948e-05f;
+
+            // Precise EXP2 polynomial coefficients, range -0.5:0.5
+            static constexpr float EXP2_DEG6_C1 = 6.931472028550421e-01f;
+            static constexpr float EXP2_DEG6_C2 = 2.402264791363012e-01f;
+            static constexpr float EXP2_DEG6_C3 = 5.550332471162809e-02f;
+            static constexpr float EXP2_DEG6_C4 = 9.618437357674640e-03f;
+            static constexpr float EXP2_DEG6_C5 = 1.339887440266574e-03f;
+            static constexpr float EXP2_DEG6_C6 = 1.535336188319500e-04f;
+
+            // Precise LOG polynomial coefficients, range sqrt(0.5)-1:sqrt(2)-1
+            static constexpr float LOG_DEG11_C3  = +3.3333331174e-01f;
+            static constexpr float LOG_DEG11_C4  = -2.4999993993e-01f;
+            static constexpr float LOG_DEG11_C5  = +2.0000714765e-01f;
+            static constexpr float LOG_DEG11_C6  = -1.6668057665e-01f;
+            static constexpr float LOG_DEG11_C7  = +1.4249322787e-01f;
+            static constexpr float LOG_DEG11_C8  = -1.2420140846e-01f;
+            static constexpr float LOG_DEG11_C9  = +1.1676998740e-01f;
+            static constexpr float LOG_DEG11_C10 = -1.1514610310e-01f;
+            static constexpr float LOG_DEG11_C11 = +7.0376836292e-02f;
+
+            // Fast SIN polynomial coefficients, range -pi/2:pi/2
+            static constexpr float FAST_SIN_DEG5_C1 = -1.6612919138547722e-01f;
+            static constexpr float FAST_SIN_DEG5_C2 = +7.656545114504995e-03f;
+
+            // Fast EXP2 polynomial coefficients, range -0.5:0.5
+            static constexpr float FAST_EXP2_DEG4_C1 = 6.931136044039327e-01f;
+            static constexpr float FAST_EXP2_DEG4_C2 = 2.4020711078990037e-01f;
+            static constexpr float FAST_EXP2_DEG4_C3 = 5.5976883626508815e-02f;
+            static constexpr float FAST_EXP2_DEG4_C4 = 9.782912546658487e-03f;
+
+            // Fast LOG2 polynomial coefficients, range sqrt(0.5)-1:sqrt(2)-1
+            static constexpr float FAST_LOG2_DEG5_C1 = +1.4425300371590133f;
+            static constexpr float FAST_LOG2_DEG5_C2 = -7.212643514829524e-01f;
+            static constexpr float FAST_LOG2_DEG5_C3 = +4.931379407415779e-01f;
+            static constexpr float FAST_LOG2_DEG5_C4 = -3.7713997701822055e-01f;
+            static constexpr float FAST_LOG2_DEG5_C5 = +1.8308706382051546e-01f;
+
+            static constexpr float K_LOG2_10   = 3.32192809488736235f;
+            static constexpr float K_LOG10_2   = 0.301029995663981195f;
+            static constexpr float K_LOG10_E   = 0.434294481903251828f;
+            static constexpr float K_LN2_P1    = +0.693359375f;
+            static constexpr float K_LN2_P2    = -2.12194440e-4f;
+            static constexpr float K_LOG10_2_P1 = +0.30102539f;
+            static constexpr float K_LOG10_2_P2 = +4.60503898e-6f;
+
+            // EXPM1 polynomial coefficients (Taylor), range -ln2/2:ln2/2
+            static constexpr float EXPM1_DEG9_C2 = 1.0f / 2;
+            static constexpr float EXPM1_DEG9_C3 = 1.0f / 6;
+            static constexpr float EXPM1_DEG9_C4 = 1.0f / 24;
+            static constexpr float EXPM1_DEG9_C5 = 1.0f / 120;
+            static constexpr float EXPM1_DEG9_C6 = 1.0f / 720;
+            static constexpr float EXPM1_DEG9_C7 = 1.0f / 5040;
+            static constexpr float EXPM1_DEG9_C8 = 1.0f / 40320;
+            static constexpr float EXPM1_DEG9_C9 = 1.0f / 362880;
+
+            // ERF polynomial coefficients, erf(x) / x in x^2, range 0:1
+            static constexpr float ERF_DEG13_C0 = +1.1283791659137685f;
+            static constexpr float ERF_DEG13_C1 = -3.7612627136091137e-01f;
+            static constexpr float ERF_DEG13_C2 = +1.1283600177725961e-01f;
+            static constexpr float ERF_DEG13_C3 = -2.685444465481046e-02f;
+            static constexpr float ERF_DEG13_C4 = +5.189535461048269e-03f;
+            static constexpr float ERF_DEG13_C5 = -8.020842364581274e-04f;
+            static constexpr float ERF_DEG13_C6 = +7.889123156242566e-05f;
+
+            // ERFC polynomial coefficients, log(erfc(x)) + x^2 in x - ERFC_CENTER, range 1:3.92
+            static constexpr float ERFC_CENTER  = 2.46f;
+            static constexpr float ERFC_DEG8_C0 = -1.5426175773442785f;
+            static constexpr float ERFC_DEG8_C1 = -3.57221889092317e-01f;
+            static constexpr float ERFC_DEG8_C2 = +5.743040804896045e-02f;
+            static constexpr float ERFC_DEG8_C3 = -1.1211683367346464e-02f;
+            static constexpr float ERFC_DEG8_C4 = +2.251160208456352e-03f;
+            static constexpr float ERFC_DEG8_C5 = -4.39258594316106e-04f;
+            static constexpr float ERFC_DEG8_C6 = +8.112359871855439e-05f;
+            static constexpr float ERFC_DEG8_C7 = -1.3800533878208718e-05f;
+            static constexpr float ERFC_DEG8_C8 = +1.6319642894625524e-06f;
+
+            // CBRT initial estimate coefficients, range 0.25:2
+            static constexpr float CBRT_DEG3_C0 = +0.4294338846844961f;
+            static constexpr float CBRT_DEG3_C1 = +0.9185537206235596f;
+            static constexpr float CBRT_DEG3_C2 = -0.436539098307125f;
+            static constexpr float CBRT_DEG3_C3 = +0.09326334866688826f;
+        };
+
+        // Reduce x to hi + lo in -pi/4:pi/4 with x = quadrant * pi/2 + hi + lo, valid for |x| <= 4096
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<std::int32_t, N, SIMD> Precise_SinCos_Reduce( const Register<float, N, SIMD>& x, Register<float, N, SIMD>& hi, Register<float, N, SIMD>& lo )
+        {
+            using C = TierConstants;
+            using RegisterF = Register<float, N, SIMD>;
+
+            RegisterF q = Round( x * RegisterF( C::K_INV_HALF_PI ) );
+
+            // Products with the first 3 parts are exact, keep the rounding error of each subtraction in lo
+            RegisterF t = x - q * RegisterF( C::HALF_PI_P1 );
+            RegisterF p2 = q * RegisterF( C::HALF_PI_P2 );
+            RegisterF y = t - p2;
+            lo = ( t - y ) - p2;
+
+            // |y| may be below |p3|, full TwoSum
+            RegisterF p3 = q * RegisterF( C::HALF_PI_P3 );
+            RegisterF z = y - p3;
+            RegisterF zy = z - y;
+            lo += ( y - ( z - zy ) ) - ( p3 + zy );
+            lo -= q * RegisterF( C::HALF_PI_P4 );
+
+            hi = z + lo;
+            lo -= hi - z;
+
+            return Convert<std::int32_t>( q );
+        }
+
+        // Sine of hi + lo for range -pi/4:pi/4
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Precise_Sin_Kernel( const Register<float, N, SIMD>& hi, const Register<float, N, SIMD>& lo )
+        {
+            using C = TierConstants;
+            using RegisterF = Register<float, N, SIMD>;
+
+            RegisterF z = hi * hi;
+            RegisterF poly = Poly( z, C::SIN_DEG7_C1, C::SIN_DEG7_C2, C::SIN_DEG7_C3 );
+            return hi + ( lo + hi * z * poly );
+        }
+
+        // Cosine of hi + lo for range -pi/4:pi/4
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Precise_Cos_Kernel( const Register<float, N, SIMD>& hi, const Register<float, N, SIMD>& lo )
+        {
+            using C = TierConstants;
+            using RegisterF = Register<float, N, SIMD>;
+
+            RegisterF z = hi * hi;
+            RegisterF poly = Poly( z, C::COS_DEG8_C2, C::COS_DEG8_C3, C::COS_DEG8_C4 );
+
+            // 1 - z/2 rounds, add back its error before the tail
+            RegisterF halfZ = z * RegisterF( 0.5f );
+            RegisterF w = RegisterF( 1.0f ) - halfZ;
+            return w + ( ( ( RegisterF( 1.0f ) - w ) - halfZ ) + ( z * z * poly - hi * lo ) );
+        }
+
+        // Select sin or cos kernel and sign from quadrant
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Precise_SinCos_Quadrant( const Register<std::int32_t, N, SIMD>& quadrant, const Register<float, N, SIMD>& sin, const Register<float, N, SIMD>& cos )
+        {
+            using RegisterI = Register<std::int32_t, N, SIMD>;
+
+            Register<float, N, SIMD> result = SelectHighBit( quadrant << 31, cos, sin );
+            return result ^ Cast<float>( ( quadrant >> 1 ) << 31 );
+        }
+
+        // 2^f for range -0.5:0.5
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Precise_Exp2_Kernel( const Register<float, N, SIMD>& f )
+        {
+            using C = TierConstants;
+            using RegisterF = Register<float, N, SIMD>;
+
+            // Horner, Estrin's extra rounding breaks the 1 ULP bound
+            const float coeffs[] = { 1.0f, C::EXP2_DEG6_C1, C::EXP2_DEG6_C2, C::EXP2_DEG6_C3, C::EXP2_DEG6_C4, C::EXP2_DEG6_C5, C::EXP2_DEG6_C6 };
+            return PolyHorner( f, coeffs );
+        }
+
+        // Split x > 0 into exponent and mantissa - 1 in sqrt(0.5)-1:sqrt(2)-1
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Log_Reduce( const Register<float, N, SIMD>& x, Register<float, N, SIMD>& exponent )
+        {
+            using C = TierConstants;
+            using RegisterF = Register<float, N, SIMD>;
+
+            RegisterF mantissa;
+            Register<std::int32_t, N, SIMD> exponentI;
+            Frexp( x, mantissa, exponentI );
+
+            auto ltSqrtHalf = mantissa < RegisterF( C::K_SQRT_HALF );
+            exponent = MaskedDecrement( ltSqrtHalf, Convert<float>( exponentI ) );
+            mantissa = MaskedAdd( ltSqrtHalf, mantissa, mantissa );
+            return mantissa - RegisterF( 1.0f );
+        }
+
+        // log(1 + t) - t for range sqrt(0.5)-1:sqrt(2)-1
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Precise_Log_Tail( const Register<float, N, SIMD>& t )
+        {
+            using C = TierConstants;
+            using RegisterF = Register<float, N, SIMD>;
+
+            RegisterF poly = Poly( t, C::LOG_DEG11_C3, C::LOG_DEG11_C4, C::LOG_DEG11_C5, C::LOG_DEG11_C6, C::LOG_DEG11_C7,
+                                      C::LOG_DEG11_C8, C::LOG_DEG11_C9, C::LOG_DEG11_C10, C::LOG_DEG11_C11 );
+
+            RegisterF tsqr = t * t;
+            return t * tsqr * poly - tsqr * RegisterF( 0.5f );
+        }
+
+        // Reduce x to y in -pi/2:pi/2 with x = quotient * pi + y, valid for |x| <= 4096
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Fast_Sin_Reduce( const Register<float, N, SIMD>& x, const Register<float, N, SIMD>& quotient )
+        {
+            using C = TierConstants;
+            using RegisterF = Register<float, N, SIMD>;
+
+            RegisterF y = x - quotient * RegisterF( C::PI_P1 );
+            y -= quotient * RegisterF( C::PI_P2 );
+            y -= quotient * RegisterF( C::PI_P3 );
+            return y;
+        }
+
+        // Sine approximation for range -pi/2:pi/2
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Fast_Sin_NegHalfPi_HalfPi( const Register<float, N, SIMD>& x )
+        {
+            using C = TierConstants;
+            using RegisterF = Register<float, N, SIMD>;
+
+            RegisterF xsqr = x * x;
+            RegisterF poly = FMulAdd( RegisterF( C::FAST_SIN_DEG5_C2 ), xsqr, RegisterF( C::FAST_SIN_DEG5_C1 ) );
+            return FMulAdd( x * xsqr, poly, x );
+        }
+    }
+
+    // Accuracy tiers, float only
+    //
+    // FS::Precise: within 1 ULP of the correctly rounded result over the stated range
+    // FS::Fast:    lower degree polynomials, relative error below 2^-12 (~2.4e-4) over the stated range
+    //
+    // The untiered FS functions above are unchanged, both tiers are checked against a
+    // double precision reference in tests/test.inl
+    namespace Precise
+    {
+        // Sin: range -4096:4096
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Sin( const Register<float, N, SIMD>& x )
+        {
+            if constexpr( IsNativeV<Register<float, N, SIMD>> )
+            {
+                Register<float, N, SIMD> hi, lo;
+                Register<std::int32_t, N, SIMD> quadrant = impl::Precise_SinCos_Reduce( x, hi, lo );
+
+                return impl::Precise_SinCos_Quadrant( quadrant, impl::Precise_Sin_Kernel( hi, lo ), impl::Precise_Cos_Kernel( hi, lo ) );
+            }
+            else
+            {
+                return Register<float, N, SIMD>{ Precise::Sin( x.v0 ), Precise::Sin( x.v1 ) };
+            }
+        }
+
+        // Cos: range -4096:4096
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Cos( const Register<float, N, SIMD>& x )
+        {
+            if constexpr( IsNativeV<Register<float, N, SIMD>> )
+            {
+                Register<float, N, SIMD> hi, lo;
+                Register<std::int32_t, N, SIMD> quadrant = impl::Precise_SinCos_Reduce( x, hi, lo );
+
+                // cos(x) = sin(x + pi/2)
+                return impl::Precise_SinCos_Quadrant( quadrant + Register<std::int32_t, N, SIMD>( 1 ), impl::Precise_Sin_Kernel( hi, lo ), impl::Precise_Cos_Kernel( hi, lo ) );
+            }
+            else
+            {
+                return Register<float, N, SIMD>{ Precise::Cos( x.v0 ), Precise::Cos( x.v1 ) };
+            }
+        }
+
+        // SinCos: range -4096:4096, shares range reduction and kernels between sin and cos
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE void SinCos( const Register<float, N, SIMD>& x, Register<float, N, SIMD>& outSin, Register<float, N, SIMD>& outCos )
+        {
+            if constexpr( IsNativeV<Register<float, N, SIMD>> )
+            {
+                Register<float, N, SIMD> hi, lo;
+                Register<std::int32_t, N, SIMD> quadrant = impl::Precise_SinCos_Reduce( x, hi, lo );
+                Register<float, N, SIMD> sin = impl::Precise_Sin_Kernel( hi, lo );
+                Register<float, N, SIMD> cos = impl::Precise_Cos_Kernel( hi, lo );
+
+                outSin = impl::Precise_SinCos_Quadrant( quadrant, sin, cos );
+                outCos = impl::Precise_SinCos_Quadrant( quadrant + Register<std::int32_t, N, SIMD>( 1 ), sin, cos );
+            }
+            else
+            {
+                Precise::SinCos( x.v0, outSin.v0, outCos.v0 );
+                Precise::SinCos( x.v1, outSin.v1, outCos.v1 );
+            }
+        }
+
+        // Exp2: range -126:127
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Exp2( const Register<float, N, SIMD>& x )
+        {
+            if constexpr( IsNativeV<Register<float, N, SIMD>> )
+            {
+                using RegisterF = Register<float, N, SIMD>;
+
+                RegisterF n = Round( x );
+
+                return impl::Ldexp( impl::Precise_Exp2_Kernel( x - n ), Convert<std::int32_t>( n ) );
+            }
+            else
+            {
+                return Register<float, N, SIMD>{ Precise::Exp2( x.v0 ), Precise::Exp2( x.v1 ) };
+            }
+        }
+
+        // Exp: range -87:88
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Exp( const Register<float, N, SIMD>& x )
+        {
+            // Cody-Waite reduction in FS::Exp already meets the bound
+            return FS::Exp( x );
+        }
+
+        // Log2: range FLT_MIN:FLT_MAX
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Log2( const Register<float, N, SIMD>& x )
+        {
+            if constexpr( IsNativeV<Register<float, N, SIMD>> )
+            {
+                using C = impl::TierConstants;
+                using RegisterF = Register<float, N, SIMD>;
+
+                RegisterF e;
+                RegisterF t = impl::Log_Reduce( x, e );
+                RegisterF tail = impl::Precise_Log_Tail( t );
+
+                // log2e split as 1 + K_LOG2E_M1 keeps t and tail exact in the sum
+                RegisterF result = tail * RegisterF( C::K_LOG2E_M1 );
+                result += t * RegisterF( C::K_LOG2E_M1 );
+                result += tail;
+                result += t;
+                return result + e;
+            }
+            else
+            {
+                return Register<float, N, SIMD>{ Precise::Log2( x.v0 ), Precise::Log2( x.v1 ) };
+            }
+        }
+
+        // Log: range FLT_MIN:FLT_MAX
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Log( const Register<float, N, SIMD>& x )
+        {
+            if constexpr( IsNativeV<Register<float, N, SIMD>> )
+            {
+                using RegisterF = Register<float, N, SIMD>;
+
+                RegisterF e;
+                RegisterF t = impl::Log_Reduce( x, e );
+                RegisterF tail = impl::Precise_Log_Tail( t );
+
+                // ln2 split as 0.693359375 - 2.12194440e-4, first product is exact
+                tail += e * RegisterF( -2.12194440e-4f );
+                return ( t + tail ) + e * RegisterF( 0.693359375f );
+            }
+            else
+            {
+                return Register<float, N, SIMD>{ Precise::Log( x.v0 ), Precise::Log( x.v1 ) };
+            }
+        }
+    }
+
+    namespace Fast
+    {
+        // Sin: range -4096:4096
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Sin( const Register<float, N, SIMD>& x )
+        {
+            if constexpr( IsNativeV<Register<float, N, SIMD>> )
+            {
+                using C = impl::TierConstants;
+                using RegisterF = Register<float, N, SIMD>;
+
+                RegisterF q = Round( x * RegisterF( C::K_INV_PI ) );
+                RegisterF result = impl::Fast_Sin_NegHalfPi_HalfPi( impl::Fast_Sin_Reduce( x, q ) );
+
+                // sin(y + q*pi) = (-1)^q * sin(y)
+                return result ^ Cast<float>( Convert<std::int32_t>( q ) << 31 );
+            }
+            else
+            {
+                return Register<float, N, SIMD>{ Fast::Sin( x.v0 ), Fast::Sin( x.v1 ) };
+            }
+        }
+
+        // Cos: range -4096:4096
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Cos( const Register<float, N, SIMD>& x )
+        {
+            if constexpr( IsNativeV<Register<float, N, SIMD>> )
+            {
+                using C = impl::TierConstants;
+                using RegisterF = Register<float, N, SIMD>;
+                using RegisterI = Register<std::int32_t, N, SIMD>;
+
+                RegisterF k = Round( FMulSub( x, RegisterF( C::K_INV_PI ), RegisterF( 0.5f ) ) );
+                RegisterF result = impl::Fast_Sin_NegHalfPi_HalfPi( impl::Fast_Sin_Reduce( x, k + RegisterF( 0.5f ) ) );
+
+                // cos(y + (k + 0.5)*pi) = (-1)^(k + 1) * sin(y)
+                return result ^ Cast<float>( ( Convert<std::int32_t>( k ) + RegisterI( 1 ) ) << 31 );
+            }
+            else
+            {
+                return Register<float, N, SIMD>{ Fast::Cos( x.v0 ), Fast::Cos( x.v1 ) };
+            }
+        }
+
+        // Exp2: range -126:127
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Exp2( const Register<float, N, SIMD>& x )
+        {
+            if constexpr( IsNativeV<Register<float, N, SIMD>> )
+            {
+                using C = impl::TierConstants;
+                using RegisterF = Register<float, N, SIMD>;
+
+                RegisterF n = Round( x );
+                RegisterF f = x - n;
+
+                RegisterF poly = Poly( f, 1.0f, C::FAST_EXP2_DEG4_C1, C::FAST_EXP2_DEG4_C2, C::FAST_EXP2_DEG4_C3, C::FAST_EXP2_DEG4_C4 );
+
+                return impl::Ldexp( poly, Convert<std::int32_t>( n ) );
+            }
+            else
+            {
+                return Register<float, N, SIMD>{ Fast::Exp2( x.v0 ), Fast::Exp2( x.v1 ) };
+            }
+        }
+
+        // Exp: range -87:88
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Exp( const Register<float, N, SIMD>& x )
+        {
+            return Fast::Exp2( x * Register<float, N, SIMD>( impl::TierConstants::K_LOG2E ) );
+        }
+
+        // Log2: range FLT_MIN:FLT_MAX
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Log2( const Register<float, N, SIMD>& x )
+        {
+            if constexpr( IsNativeV<Register<float, N, SIMD>> )
+            {
+                using C = impl::TierConstants;
+                using RegisterF = Register<float, N, SIMD>;
+
+                RegisterF e;
+                RegisterF t = impl::Log_Reduce( x, e );
+
+                RegisterF poly = Poly( t, C::FAST_LOG2_DEG5_C1, C::FAST_LOG2_DEG5_C2, C::FAST_LOG2_DEG5_C3, C::FAST_LOG2_DEG5_C4, C::FAST_LOG2_DEG5_C5 );
+
+                return FMulAdd( poly, t, e );
+            }
+            else
+            {
+                return Register<float, N, SIMD>{ Fast::Log2( x.v0 ), Fast::Log2( x.v1 ) };
+            }
+        }
+
+        // Log: range FLT_MIN:FLT_MAX
+        template<std::size_t N, FastSIMD::FeatureSet SIMD>
+        FS_FORCEINLINE Register<float, N, SIMD> Log( const Register<float, N, SIMD>& x )
+        {
+            return Fast::Log2( x ) * Register<float, N, SIMD>( impl::TierConstants::K_LN2 );
+        }
+    }
+
+    // Extended transcendentals, float only
+    // ULP bounds are against the correctly rounded result over the stated range
+
+    // Exp10: 10^x, range -37:38, 2 ULP
+    template<std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<float, N, SIMD> Exp10( const Register<float, N, SIMD>& x )
+    {
+        if constexpr( IsNativeV<Register<float, N, SIMD>> )
+        {
+            using C = impl::TierConstants;
+            using RegisterF = Register<float, N, SIMD>;
+
+            // x = n * log10(2) + r, 10^x = 2^n * 2^(r * log2(10))
+            RegisterF n = Round( x * RegisterF( C::K_LOG2_10 ) );
+            RegisterF r = x - n * RegisterF( C::K_LOG10_2_P1 );
+            r -= n * RegisterF( C::K_LOG10_2_P2 );
+
+            return impl::Ldexp( impl::Precise_Exp2_Kernel( r * RegisterF( C::K_LOG2_10 ) ), Convert<std::int32_t>( n ) );
+        }
+        else
+        {
+            return Register<float, N, SIMD>{ Exp10( x.v0 ), Exp10( x.v1 ) };
+        }
+    }
+
+    // Log10: range FLT_MIN:FLT_MAX, 3 ULP
+    template<std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<float, N, SIMD> Log10( const Register<float, N, SIMD>& x )
+    {
+        return Precise::Log2( x ) * Register<float, N, SIMD>( impl::TierConstants::K_LOG10_2 );
+    }
+
+    // Expm1: e^x - 1, range -87:88, 1 ULP
+    template<std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<float, N, SIMD> Expm1( const Register<float, N, SIMD>& x )
+    {
+        if constexpr( IsNativeV<Register<float, N, SIMD>> )
+        {
+            using C = impl::TierConstants;
+            using RegisterF = Register<float, N, SIMD>;
+
+            RegisterF n = Round( x * RegisterF( C::K_LOG2E ) );
+            RegisterF r = x - n * RegisterF( C::K_LN2_P1 );
+            r -= n * RegisterF( C::K_LN2_P2 );
+
+            // Horner, Estrin's extra rounding breaks the 1 ULP bound
+            const float coeffs[] = { C::EXPM1_DEG9_C2, C::EXPM1_DEG9_C3, C::EXPM1_DEG9_C4, C::EXPM1_DEG9_C5, C::EXPM1_DEG9_C6,
+                                     C::EXPM1_DEG9_C7, C::EXPM1_DEG9_C8, C::EXPM1_DEG9_C9 };
+            RegisterF poly = PolyHorner( r, coeffs );
+            RegisterF expm1R = FMulAdd( poly, r * r, r );
+
+            // e^x - 1 = 2^n * expm1(r) + (2^n - 1), 2^n - 1 is exact for small n
+            RegisterF scale = impl::Ldexp( RegisterF( 1.0f ), Convert<std::int32_t>( n ) );
+            return FMulAdd( scale, expm1R, scale - RegisterF( 1.0f ) );
+        }
+        else
+        {
+            return Register<float, N, SIMD>{ Expm1( x.v0 ), Expm1( x.v1 ) };
+        }
+    }
+
+    // Log1p: log(1 + x), range -1:FLT_MAX, 2 ULP
+    template<std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<float, N, SIMD> Log1p( const Register<float, N, SIMD>& x )
+    {
+        if constexpr( IsNativeV<Register<float, N, SIMD>> )
+        {
+            using RegisterF = Register<float, N, SIMD>;
+
+            // Correct for the rounding of 1 + x, log(u + d) ~= log(u) + d / u
+            RegisterF u = RegisterF( 1.0f ) + x;
+            RegisterF d = x - ( u - RegisterF( 1.0f ) );
+            return Precise::Log( u ) + d / u;
+        }
+        else
+        {
+            return Register<float, N, SIMD>{ Log1p( x.v0 ), Log1p( x.v1 ) };
+        }
+    }
+
+    // Tanh: range -inf:inf, 3 ULP
+    template<std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<float, N, SIMD> Tanh( const Register<float, N, SIMD>& x )
+    {
+        if constexpr( IsNativeV<Register<float, N, SIMD>> )
+        {
+            using RegisterF = Register<float, N, SIMD>;
+
+            // tanh(|x|) = expm1(2|x|) / (expm1(2|x|) + 2), rounds to 1 beyond 10
+            RegisterF absX = Abs( x );
+            RegisterF e = Expm1( Min( absX, RegisterF( 10.0f ) ) * RegisterF( 2.0f ) );
+            RegisterF result = e / ( e + RegisterF( 2.0f ) );
+
+            return result | ( x ^ absX );
+        }
+        else
+        {
+            return Register<float, N, SIMD>{ Tanh( x.v0 ), Tanh( x.v1 ) };
+        }
+    }
+
+    // Sigmoid: 1 / (1 + e^-x), range -87:inf, 3 ULP
+    template<std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<float, N, SIMD> Sigmoid( const Register<float, N, SIMD>& x )
+    {
+        using RegisterF = Register<float, N, SIMD>;
+
+        return RegisterF( 1.0f ) / ( RegisterF( 1.0f ) + Precise::Exp( -x ) );
+    }
+
+    // Erf: range -inf:inf, 2 ULP
+    template<std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<float, N, SIMD> Erf( const Register<float, N, SIMD>& x )
+    {
+        if constexpr( IsNativeV<Register<float, N, SIMD>> )
+        {
+            using C = impl::TierConstants;
+            using RegisterF = Register<float, N, SIMD>;
+
+            RegisterF absX = Abs( x );
+
+            // |x| < 1: erf(x) = x * P(x^2)
+            RegisterF xsqr = x * x;
+            // Horner, Estrin's extra rounding breaks the 2 ULP bound
+            const float erfCoeffs[] = { C::ERF_DEG13_C0, C::ERF_DEG13_C1, C::ERF_DEG13_C2, C::ERF_DEG13_C3, C::ERF_DEG13_C4, C::ERF_DEG13_C5, C::ERF_DEG13_C6 };
+            RegisterF small = PolyHorner( xsqr, erfCoeffs ) * absX;
+
+            // |x| >= 1: erf(x) = 1 - e^(Q(x) - x^2), rounds to 1 beyond 3.92
+            RegisterF u = Min( absX, RegisterF( 3.92f ) ) - RegisterF( C::ERFC_CENTER );
+            RegisterF polyC = Poly( u, C::ERFC_DEG8_C0, C::ERFC_DEG8_C1, C::ERFC_DEG8_C2, C::ERFC_DEG8_C3, C::ERFC_DEG8_C4,
+                                       C::ERFC_DEG8_C5, C::ERFC_DEG8_C6, C::ERFC_DEG8_C7, C::ERFC_DEG8_C8 );
+            RegisterF large = RegisterF( 1.0f ) - Precise::Exp( polyC - Min( xsqr, RegisterF( 3.92f * 3.92f ) ) );
+            large = Select( absX < RegisterF( 3.92f ), large, RegisterF( 1.0f ) );
+
+            RegisterF result = Select( absX < RegisterF( 1.0f ), small, large );
+            return result | ( x ^ absX );
+        }
+        else
+        {
+            return Register<float, N, SIMD>{ Erf( x.v0 ), Erf( x.v1 ) };
+        }
+    }
+
+    // Cbrt: cube root, range -FLT_MAX:FLT_MAX, 1 ULP
+    template<std::size_t N, FastSIMD::FeatureSet SIMD>
+    FS_FORCEINLINE Register<float, N, SIMD> Cbrt( const Register<float, N, SIMD>& x )
+    {
+        if constexpr( IsNativeV<Register<float, N, SIMD>> )
+        {
+            using C = impl::TierConstants;
+            using RegisterF = Register<float, N, SIMD>;
+            using RegisterI = Register<std::int32_t, N, SIMD>;
+
+            RegisterF absX = Abs( x );
+
+            // Scale denormals into the normal range
+            auto isDenormal = absX < RegisterF( 1.17549435e-38f );
+            RegisterF mantissa;
+            RegisterI exponent;
+            impl::Frexp( Select( isDenormal, absX * RegisterF( 16777216.0f ), absX ), mantissa, exponent );
+
+            // |x| = a * 2^(3q), a in 0.25:2
+            RegisterF exponentF = Convert<float>( exponent ) - Masked( isDenormal, RegisterF( 24.0f ) );
+            RegisterF q = Round( exponentF * RegisterF( 1.0f / 3 ) );
+            RegisterF a = impl::Ldexp( mantissa, Convert<std::int32_t>( exponentF - q * RegisterF( 3.0f ) ) );
+
+            RegisterF y = Poly( a, C::CBRT_DEG3_C0, C::CBRT_DEG3_C1, C::CBRT_DEG3_C2, C::CBRT_DEG3_C3 );
+
+            // Halley iteration, y += y * (a - y^3) / (2y^3 + a)
+            for( int i = 0; i < 2; i++ )
+            {
+                RegisterF ycube = y * y * y;
+                y = FMulAdd( y, ( a - ycube ) / ( ycube + ycube + a ), y );
+            }
+
+            RegisterF result = impl::Ldexp( y, Convert<std::int32_t>( q ) );
+            return Masked( absX != RegisterF( 0.0f ), result | ( x ^ absX ) );
+        }
+        else
+        {
+            return Register<float, N, SIMD>{ Cbrt( x.v0 ), Cbrt( x.v1 ) };
+        }
+    }
 }
@@ -231,4 +231,16 @@ namespace FS
     {
         return wasm_f32x4_relaxed_nmadd( a.native, b.native, c.native );
     }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Compress( const typename f32<4, SIMD>::MaskTypeArg& mask, const f32<4, SIMD>& a )
+    {
+        return wasm_i8x16_swizzle( a.native, wasm_v128_load( impl::CompressByteTable4x32[BitMask( mask )].data() ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Expand( const typename f32<4, SIMD>::MaskTypeArg& mask, const f32<4, SIMD>& a )
+    {
+        return wasm_i8x16_swizzle( a.native, wasm_v128_load( impl::ExpandByteTable4x32[BitMask( mask )].data() ) );
+    }
 }
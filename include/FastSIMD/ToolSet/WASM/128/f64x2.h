@@ -0,0 +1,225 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<double, 2, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::WASM>>
+    {
+        static constexpr size_t ElementCount = 2;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __f64x2;
+        using ElementType = double;
+        using MaskType = m64<ElementCount, true, SIMD>;
+        using MaskTypeArg = m64<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( double v ) : native( wasm_f64x2_splat( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = wasm_f64x2_add( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = wasm_f64x2_sub( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = wasm_f64x2_mul( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator /=( const Register& rhs )
+        {
+            native = wasm_f64x2_div( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = wasm_v128_and( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = wasm_v128_or( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = wasm_v128_xor( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator~() const
+        {
+            return wasm_v128_not( native );
+        }
+
+        FS_FORCEINLINE Register operator-() const
+        {
+            return wasm_f64x2_neg( native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return wasm_f64x2_eq( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~( *this == rhs );
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return wasm_f64x2_ge( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return wasm_f64x2_le( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return wasm_f64x2_gt( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return wasm_f64x2_lt( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Load( TypeWrapper<const double*, 2, SIMD> ptr )
+    {
+        return wasm_v128_load( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE void Store( typename f64<2, SIMD>::ElementType* ptr, const f64<2, SIMD>& a )
+    {
+        wasm_v128_store( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE double Extract0( const f64<2, SIMD>& a )
+    {
+        return wasm_f64x2_extract_lane( a.native, 0 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Abs( const f64<2, SIMD>& a )
+    {
+        return wasm_f64x2_abs( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Round( const f64<2, SIMD>& a )
+    {
+        return wasm_f64x2_nearest( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Floor( const f64<2, SIMD>& a )
+    {
+        return wasm_f64x2_floor( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Trunc( const f64<2, SIMD>& a )
+    {
+        return wasm_f64x2_trunc( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Ceil( const f64<2, SIMD>& a )
+    {
+        return wasm_f64x2_ceil( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Min( const f64<2, SIMD>& a, const f64<2, SIMD>& b )
+    {
+        if constexpr( FastSIMD::IsRelaxed() )
+        {
+            return wasm_f64x2_relaxed_min( a.native, b.native );        
+        }
+        else
+        {
+            return wasm_f64x2_min( a.native, b.native );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Max( const f64<2, SIMD>& a, const f64<2, SIMD>& b )
+    {
+        if constexpr( FastSIMD::IsRelaxed() )
+        {
+            return wasm_f64x2_relaxed_max( a.native, b.native );
+        }
+        else
+        {
+            return wasm_f64x2_max( a.native, b.native );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Select( const typename f64<2, SIMD>::MaskTypeArg& mask, const f64<2, SIMD>& ifTrue, const f64<2, SIMD>& ifFalse )
+    {
+        return wasm_v128_bitselect( ifTrue.native, ifFalse.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Masked( const typename f64<2, SIMD>::MaskTypeArg& mask, const f64<2, SIMD>& a )
+    {
+        return wasm_v128_and( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> InvMasked( const typename f64<2, SIMD>::MaskTypeArg& mask, const f64<2, SIMD>& a )
+    {
+        return wasm_v128_andnot( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Sqrt( const f64<2, SIMD>& a )
+    {
+        return wasm_f64x2_sqrt( a.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>, typename = EnableIfRelaxed<SIMD>()>
+    FS_FORCEINLINE f64<2, SIMD> FMulAdd( const f64<2, SIMD>& a, const f64<2, SIMD>& b, const f64<2, SIMD>& c )
+    {
+        return wasm_f64x2_relaxed_madd( a.native, b.native, c.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>, typename = EnableIfRelaxed<SIMD>()>
+    FS_FORCEINLINE f64<2, SIMD> FNMulAdd( const f64<2, SIMD>& a, const f64<2, SIMD>& b, const f64<2, SIMD>& c )
+    {
+        return wasm_f64x2_relaxed_nmadd( a.native, b.native, c.native );
+    }
+}
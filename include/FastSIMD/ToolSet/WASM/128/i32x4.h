@@ -72,6 +72,27 @@ namespace FS
             return *this;
         }
 
+        FS_FORCEINLINE Register& operator >>=( const Register& rhs )
+        {
+            /* no per lane shift count in WASM SIMD */
+            native = wasm_i32x4_make(
+                wasm_i32x4_extract_lane( native, 0 ) >> wasm_i32x4_extract_lane( rhs.native, 0 ),
+                wasm_i32x4_extract_lane( native, 1 ) >> wasm_i32x4_extract_lane( rhs.native, 1 ),
+                wasm_i32x4_extract_lane( native, 2 ) >> wasm_i32x4_extract_lane( rhs.native, 2 ),
+                wasm_i32x4_extract_lane( native, 3 ) >> wasm_i32x4_extract_lane( rhs.native, 3 ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( const Register& rhs )
+        {
+            native = wasm_i32x4_make(
+                wasm_i32x4_extract_lane( native, 0 ) << wasm_i32x4_extract_lane( rhs.native, 0 ),
+                wasm_i32x4_extract_lane( native, 1 ) << wasm_i32x4_extract_lane( rhs.native, 1 ),
+                wasm_i32x4_extract_lane( native, 2 ) << wasm_i32x4_extract_lane( rhs.native, 2 ),
+                wasm_i32x4_extract_lane( native, 3 ) << wasm_i32x4_extract_lane( rhs.native, 3 ) );
+            return *this;
+        }
+
         FS_FORCEINLINE Register operator ~() const
         {
             return wasm_v128_not( native );
@@ -183,4 +204,40 @@ namespace FS
     {
         return wasm_i32x4_add( a.native, mask.native );
     }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> MulHi( const i32<4, SIMD>& a, const i32<4, SIMD>& b )
+    {
+        return wasm_i32x4_shuffle( wasm_i64x2_extmul_low_i32x4( a.native, b.native ), wasm_i64x2_extmul_high_i32x4( a.native, b.native ), 1, 3, 5, 7 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MulWidenEven( const i32<4, SIMD>& a, const i32<4, SIMD>& b )
+    {
+        return wasm_i64x2_extmul_low_i32x4( wasm_i32x4_shuffle( a.native, a.native, 0, 2, 1, 3 ), wasm_i32x4_shuffle( b.native, b.native, 0, 2, 1, 3 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MulWidenOdd( const i32<4, SIMD>& a, const i32<4, SIMD>& b )
+    {
+        return wasm_i64x2_extmul_high_i32x4( wasm_i32x4_shuffle( a.native, a.native, 0, 2, 1, 3 ), wasm_i32x4_shuffle( b.native, b.native, 0, 2, 1, 3 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> PopCount( const i32<4, SIMD>& a )
+    {
+        return wasm_i32x4_extadd_pairwise_i16x8( wasm_i16x8_extadd_pairwise_u8x16( wasm_i8x16_popcnt( a.native ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> Compress( const typename i32<4, SIMD>::MaskTypeArg& mask, const i32<4, SIMD>& a )
+    {
+        return wasm_i8x16_swizzle( a.native, wasm_v128_load( impl::CompressByteTable4x32[BitMask( mask )].data() ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> Expand( const typename i32<4, SIMD>::MaskTypeArg& mask, const i32<4, SIMD>& a )
+    {
+        return wasm_i8x16_swizzle( a.native, wasm_v128_load( impl::ExpandByteTable4x32[BitMask( mask )].data() ) );
+    }
 }
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int64_t, 2, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::WASM>>
+    {
+        static constexpr size_t ElementCount = 2;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = v128_t;
+        using ElementType = std::int64_t;
+        using MaskType = m64<ElementCount, false, SIMD>;
+        using MaskTypeArg = m64<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int64_t v ) : native( wasm_i64x2_splat( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = wasm_i64x2_add( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = wasm_i64x2_sub( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = wasm_i64x2_mul( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = wasm_v128_and( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = wasm_v128_or( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = wasm_v128_xor( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = wasm_i64x2_shr( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = wasm_i64x2_shl( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return wasm_v128_not( native );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return wasm_i64x2_neg( native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return wasm_i64x2_eq( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return wasm_i64x2_ge( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return wasm_i64x2_le( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return wasm_i64x2_gt( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return wasm_i64x2_lt( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Load( TypeWrapper<const std::int64_t*, 2, SIMD> ptr )
+    {
+        return wasm_v128_load( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE void Store( typename i64<2, SIMD>::ElementType* ptr, const i64<2, SIMD>& a )
+    {
+        wasm_v128_store( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE std::int64_t Extract0( const i64<2, SIMD>& a )
+    {
+        return wasm_i64x2_extract_lane( a.native, 0 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Abs( const i64<2, SIMD>& a )
+    {
+        return wasm_i64x2_abs( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Min( const i64<2, SIMD>& a, const i64<2, SIMD>& b )
+    {
+        return wasm_v128_bitselect( a.native, b.native, wasm_i64x2_lt( a.native, b.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Max( const i64<2, SIMD>& a, const i64<2, SIMD>& b )
+    {
+        return wasm_v128_bitselect( a.native, b.native, wasm_i64x2_gt( a.native, b.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Select( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& ifTrue, const i64<2, SIMD>& ifFalse )
+    {
+        return wasm_v128_bitselect( ifTrue.native, ifFalse.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> BitShiftRightZeroExtend( const i64<2, SIMD>& a, int b )
+    {
+        return wasm_u64x2_shr( a.native, b );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Masked( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& a )
+    {
+        return wasm_v128_and( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> InvMasked( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& a )
+    {
+        return wasm_v128_andnot( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MaskedIncrement( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& a )
+    {
+        return wasm_i64x2_sub( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MaskedDecrement( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& a )
+    {
+        return wasm_i64x2_add( a.native, mask.native );
+    }
+}
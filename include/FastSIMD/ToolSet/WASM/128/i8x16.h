@@ -0,0 +1,193 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int8_t, 16, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::WASM>>
+    {
+        static constexpr size_t ElementCount = 16;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = v128_t;
+        using ElementType = std::int8_t;
+        using MaskType = m8<ElementCount, false, SIMD>;
+        using MaskTypeArg = m8<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int8_t v ) : native( wasm_i8x16_splat( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = wasm_i8x16_add( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = wasm_i8x16_sub( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = wasm_v128_and( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = wasm_v128_or( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = wasm_v128_xor( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = wasm_i8x16_shr( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = wasm_i8x16_shl( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return wasm_v128_not( native );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return wasm_i8x16_neg( native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return wasm_i8x16_eq( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return wasm_i8x16_ge( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return wasm_i8x16_le( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return wasm_i8x16_gt( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return wasm_i8x16_lt( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Load( TypeWrapper<const std::int8_t*, 16, SIMD> ptr )
+    {
+        return wasm_v128_load( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE void Store( typename i8<16, SIMD>::ElementType* ptr, const i8<16, SIMD>& a )
+    {
+        wasm_v128_store( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE std::int8_t Extract0( const i8<16, SIMD>& a )
+    {
+        return wasm_i8x16_extract_lane( a.native, 0 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Abs( const i8<16, SIMD>& a )
+    {
+        return wasm_i8x16_abs( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Min( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        return wasm_i8x16_min( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Max( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        return wasm_i8x16_max( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Select( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& ifTrue, const i8<16, SIMD>& ifFalse )
+    {
+        return wasm_v128_bitselect( ifTrue.native, ifFalse.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> BitShiftRightZeroExtend( const i8<16, SIMD>& a, int b )
+    {
+        return wasm_u8x16_shr( a.native, b );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Masked( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& a )
+    {
+        return wasm_v128_and( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> MaskedIncrement( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& a )
+    {
+        return wasm_i8x16_sub( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> MaskedDecrement( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& a )
+    {
+        return wasm_i8x16_add( a.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> AddSat( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        return wasm_i8x16_add_sat( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> SubSat( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        return wasm_i8x16_sub_sat( a.native, b.native );
+    }
+}
@@ -68,4 +68,9 @@ namespace FS
         return wasm_i32x4_bitmask(a.native);
     }
 
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<32, B>, 4, SIMD>>>
+    FS_FORCEINLINE bool AllMask( const Register<Mask<32, B>, 4, SIMD>& a )
+    {
+        return wasm_i32x4_all_true( a.native );
+    }
 }
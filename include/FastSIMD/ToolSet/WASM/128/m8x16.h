@@ -0,0 +1,76 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    namespace impl
+    {
+        struct WasmMaskBase8x16
+        {
+            v128_t native;
+        };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool OPTIMISE_FLOAT>
+    struct Register<Mask<8, OPTIMISE_FLOAT>, 16, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::WASM>>
+        : std::conditional_t<OPTIMISE_FLOAT, impl::WasmMaskBase8x16, Register<Mask<8, true>, 16, SIMD>>
+    {
+        static constexpr size_t ElementCount = 16;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = decltype(WasmMaskBase8x16::native);
+        using ElementType = Mask<8, OPTIMISE_FLOAT>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) { this->native = v; }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return this->native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = wasm_v128_and( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = wasm_v128_or( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = wasm_v128_xor( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return wasm_v128_not( this->native );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<8, B>, 16, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const Register<Mask<8, B>, 16, SIMD>& a )
+    {
+        return wasm_v128_any_true(a.native);
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<8, B>, 16, SIMD>>>
+    FS_FORCEINLINE BitStorage<16> BitMask( const Register<Mask<8, B>, 16, SIMD>& a )
+    {
+        return wasm_i8x16_bitmask(a.native);
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<Register<Mask<8, B>, 16, SIMD>>>
+    FS_FORCEINLINE bool AllMask( const Register<Mask<8, B>, 16, SIMD>& a )
+    {
+        return wasm_i8x16_all_true( a.native );
+    }
+}
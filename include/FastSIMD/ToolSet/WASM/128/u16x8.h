@@ -0,0 +1,193 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::uint16_t, 8, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::WASM>>
+    {
+        static constexpr size_t ElementCount = 8;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = v128_t;
+        using ElementType = std::uint16_t;
+        using MaskType = m16<ElementCount, false, SIMD>;
+        using MaskTypeArg = m16<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::uint16_t v ) : native( wasm_i16x8_splat( (std::int16_t)v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = wasm_i16x8_add( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = wasm_i16x8_sub( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = wasm_i16x8_mul( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = wasm_v128_and( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = wasm_v128_or( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = wasm_v128_xor( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = wasm_u16x8_shr( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = wasm_i16x8_shl( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return wasm_v128_not( native );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return wasm_i16x8_neg( native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return wasm_i16x8_eq( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return wasm_u16x8_ge( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return wasm_u16x8_le( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return wasm_u16x8_gt( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return wasm_u16x8_lt( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Load( TypeWrapper<const std::uint16_t*, 8, SIMD> ptr )
+    {
+        return wasm_v128_load( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE void Store( typename u16<8, SIMD>::ElementType* ptr, const u16<8, SIMD>& a )
+    {
+        wasm_v128_store( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE std::uint16_t Extract0( const u16<8, SIMD>& a )
+    {
+        return wasm_u16x8_extract_lane( a.native, 0 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Min( const u16<8, SIMD>& a, const u16<8, SIMD>& b )
+    {
+        return wasm_u16x8_min( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Max( const u16<8, SIMD>& a, const u16<8, SIMD>& b )
+    {
+        return wasm_u16x8_max( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Select( const typename u16<8, SIMD>::MaskTypeArg& mask, const u16<8, SIMD>& ifTrue, const u16<8, SIMD>& ifFalse )
+    {
+        return wasm_v128_bitselect( ifTrue.native, ifFalse.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Masked( const typename u16<8, SIMD>::MaskTypeArg& mask, const u16<8, SIMD>& a )
+    {
+        return wasm_v128_and( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> MaskedIncrement( const typename u16<8, SIMD>::MaskTypeArg& mask, const u16<8, SIMD>& a )
+    {
+        return wasm_i16x8_sub( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> MaskedDecrement( const typename u16<8, SIMD>::MaskTypeArg& mask, const u16<8, SIMD>& a )
+    {
+        return wasm_i16x8_add( a.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> AddSat( const u16<8, SIMD>& a, const u16<8, SIMD>& b )
+    {
+        return wasm_u16x8_add_sat( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> SubSat( const u16<8, SIMD>& a, const u16<8, SIMD>& b )
+    {
+        return wasm_u16x8_sub_sat( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Average( const u16<8, SIMD>& a, const u16<8, SIMD>& b )
+    {
+        return wasm_u16x8_avgr( a.native, b.native );
+    }
+}
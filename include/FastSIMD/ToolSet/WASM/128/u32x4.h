@@ -0,0 +1,213 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::uint32_t, 4, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::WASM>>
+    {
+        static constexpr size_t ElementCount = 4;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = v128_t;
+        using ElementType = std::uint32_t;
+        using MaskType = m32<ElementCount, false, SIMD>;
+        using MaskTypeArg = m32<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::uint32_t v ) : native( wasm_i32x4_splat( (std::int32_t)v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = wasm_i32x4_add( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = wasm_i32x4_sub( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = wasm_i32x4_mul( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = wasm_v128_and( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = wasm_v128_or( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = wasm_v128_xor( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = wasm_u32x4_shr( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = wasm_i32x4_shl( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( const Register& rhs )
+        {
+            /* no per lane shift count in WASM SIMD */
+            native = wasm_u32x4_make(
+                wasm_u32x4_extract_lane( native, 0 ) >> wasm_u32x4_extract_lane( rhs.native, 0 ),
+                wasm_u32x4_extract_lane( native, 1 ) >> wasm_u32x4_extract_lane( rhs.native, 1 ),
+                wasm_u32x4_extract_lane( native, 2 ) >> wasm_u32x4_extract_lane( rhs.native, 2 ),
+                wasm_u32x4_extract_lane( native, 3 ) >> wasm_u32x4_extract_lane( rhs.native, 3 ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( const Register& rhs )
+        {
+            native = wasm_u32x4_make(
+                wasm_u32x4_extract_lane( native, 0 ) << wasm_u32x4_extract_lane( rhs.native, 0 ),
+                wasm_u32x4_extract_lane( native, 1 ) << wasm_u32x4_extract_lane( rhs.native, 1 ),
+                wasm_u32x4_extract_lane( native, 2 ) << wasm_u32x4_extract_lane( rhs.native, 2 ),
+                wasm_u32x4_extract_lane( native, 3 ) << wasm_u32x4_extract_lane( rhs.native, 3 ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return wasm_v128_not( native );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return wasm_i32x4_neg( native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return wasm_i32x4_eq( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return wasm_u32x4_ge( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return wasm_u32x4_le( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return wasm_u32x4_gt( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return wasm_u32x4_lt( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Load( TypeWrapper<const std::uint32_t*, 4, SIMD> ptr )
+    {
+        return wasm_v128_load( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE void Store( typename u32<4, SIMD>::ElementType* ptr, const u32<4, SIMD>& a )
+    {
+        wasm_v128_store( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE std::uint32_t Extract0( const u32<4, SIMD>& a )
+    {
+        return static_cast<std::uint32_t>( wasm_i32x4_extract_lane( a.native, 0 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Min( const u32<4, SIMD>& a, const u32<4, SIMD>& b )
+    {
+        return wasm_u32x4_min( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Max( const u32<4, SIMD>& a, const u32<4, SIMD>& b )
+    {
+        return wasm_u32x4_max( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Select( const typename u32<4, SIMD>::MaskTypeArg& mask, const u32<4, SIMD>& ifTrue, const u32<4, SIMD>& ifFalse )
+    {
+        return wasm_v128_bitselect( ifTrue.native, ifFalse.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Masked( const typename u32<4, SIMD>::MaskTypeArg& mask, const u32<4, SIMD>& a )
+    {
+        return wasm_v128_and( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> MaskedIncrement( const typename u32<4, SIMD>::MaskTypeArg& mask, const u32<4, SIMD>& a )
+    {
+        return wasm_i32x4_sub( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> MaskedDecrement( const typename u32<4, SIMD>::MaskTypeArg& mask, const u32<4, SIMD>& a )
+    {
+        return wasm_i32x4_add( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> MulHi( const u32<4, SIMD>& a, const u32<4, SIMD>& b )
+    {
+        return wasm_i32x4_shuffle( wasm_u64x2_extmul_low_u32x4( a.native, b.native ), wasm_u64x2_extmul_high_u32x4( a.native, b.native ), 1, 3, 5, 7 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MulWidenEven( const u32<4, SIMD>& a, const u32<4, SIMD>& b )
+    {
+        return wasm_u64x2_extmul_low_u32x4( wasm_i32x4_shuffle( a.native, a.native, 0, 2, 1, 3 ), wasm_i32x4_shuffle( b.native, b.native, 0, 2, 1, 3 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MulWidenOdd( const u32<4, SIMD>& a, const u32<4, SIMD>& b )
+    {
+        return wasm_u64x2_extmul_high_u32x4( wasm_i32x4_shuffle( a.native, a.native, 0, 2, 1, 3 ), wasm_i32x4_shuffle( b.native, b.native, 0, 2, 1, 3 ) );
+    }
+}
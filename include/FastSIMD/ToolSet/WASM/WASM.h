@@ -6,7 +6,17 @@
 
 #include "128/f32x4.h"
 #include "128/i32x4.h"
+#include "128/u32x4.h"
 #include "128/m32x4.h"
+#include "128/i64x2.h"
+#include "128/f64x2.h"
+#include "128/m64x2.h"
+#include "128/i8x16.h"
+#include "128/u8x16.h"
+#include "128/m8x16.h"
+#include "128/i16x8.h"
+#include "128/u16x8.h"
+#include "128/m16x8.h"
 
 namespace FS
 {
@@ -29,6 +39,128 @@ namespace FS
         return wasm_f32x4_convert_i32x4( a.native );
     }
 
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Convert( const f32<4, SIMD>& a, TypeDummy<uint32_t> )
+    {
+        if constexpr( FastSIMD::IsRelaxed() )
+        {
+            return wasm_u32x4_relaxed_trunc_f32x4( Round( a ).native );
+        }
+        else
+        {
+            return wasm_u32x4_trunc_sat_f32x4( Round( a ).native );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Convert( const u32<4, SIMD>& a, TypeDummy<float> )
+    {
+        return wasm_f32x4_convert_u32x4( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = EnableIfNotNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Convert( const f32<4, SIMD>& a, TypeDummy<double> )
+    {
+        return { wasm_f64x2_promote_low_f32x4( a.native ), wasm_f64x2_promote_low_f32x4( wasm_i64x2_shuffle( a.native, a.native, 1, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = EnableIfNotNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Convert( const f64<4, SIMD>& a, TypeDummy<float> )
+    {
+        return wasm_i64x2_shuffle( wasm_f32x4_demote_f64x2_zero( a.v0.native ), wasm_f32x4_demote_f64x2_zero( a.v1.native ), 0, 2 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = EnableIfNotNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Convert( const i32<4, SIMD>& a, TypeDummy<double> )
+    {
+        return { wasm_f64x2_convert_low_i32x4( a.native ), wasm_f64x2_convert_low_i32x4( wasm_i64x2_shuffle( a.native, a.native, 1, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = EnableIfNotNative<f64<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> Convert( const f64<4, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return wasm_i64x2_shuffle(
+            wasm_i32x4_trunc_sat_f64x2_zero( Round( a.v0 ).native ),
+            wasm_i32x4_trunc_sat_f64x2_zero( Round( a.v1 ).native ), 0, 2 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>, typename = EnableIfNotNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> Convert( const i8<16, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return { wasm_i16x8_extend_low_i8x16( a.native ), wasm_i16x8_extend_high_i8x16( a.native ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>, typename = EnableIfNotNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> Convert( const u8<16, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        return { wasm_u16x8_extend_low_u8x16( a.native ), wasm_u16x8_extend_high_u8x16( a.native ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>, typename = EnableIfNotNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Convert( const i16<8, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return { wasm_i32x4_extend_low_i16x8( a.native ), wasm_i32x4_extend_high_i16x8( a.native ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>, typename = EnableIfNotNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Convert( const u16<8, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return { wasm_u32x4_extend_low_u16x8( a.native ), wasm_u32x4_extend_high_u16x8( a.native ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>, typename = EnableIfNotNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Convert( const i16<16, SIMD>& a, TypeDummy<int8_t> )
+    {
+        return wasm_i8x16_narrow_i16x8( a.v0.native, a.v1.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>, typename = EnableIfNotNative<i16<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Convert( const i16<16, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        return wasm_u8x16_narrow_i16x8( a.v0.native, a.v1.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>, typename = EnableIfNotNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Convert( const u16<16, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        // Narrow treats input as signed, clamp to 255 first
+        const v128_t max = wasm_i16x8_splat( 0xFF );
+        return wasm_u8x16_narrow_i16x8( wasm_u16x8_min( a.v0.native, max ), wasm_u16x8_min( a.v1.native, max ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>, typename = EnableIfNotNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Convert( const i32<8, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return wasm_i16x8_narrow_i32x4( a.v0.native, a.v1.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>, typename = EnableIfNotNative<i32<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Convert( const i32<8, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        return wasm_u16x8_narrow_i32x4( a.v0.native, a.v1.native );
+    }
+
+    template<typename U, typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 2, SIMD>>>
+    FS_FORCEINLINE Register<U, 2, SIMD> Cast( const Register<T, 2, SIMD>& a, TypeDummy<U> )
+    {
+        if constexpr(
+            std::is_same_v<typename Register<T, 2, SIMD>::NativeType, __f64x2> &&
+            std::is_same_v<typename Register<U, 2, SIMD>::NativeType, v128_t> )
+        {
+            return static_cast<v128_t>( a.GetNative() );
+        }
+        else if constexpr(
+            std::is_same_v<typename Register<T, 2, SIMD>::NativeType, v128_t> &&
+            std::is_same_v<typename Register<U, 2, SIMD>::NativeType, __f64x2> )
+        {
+            return static_cast<__f64x2>( a.GetNative() );
+        }
+        else
+        {
+            return a.GetNative();
+        }
+    }
+
     template<typename U, typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 4, SIMD>>>
     FS_FORCEINLINE Register<U, 4, SIMD> Cast( const Register<T, 4, SIMD>& a, TypeDummy<U> )
     {
@@ -49,5 +181,12 @@ namespace FS
             return a.GetNative();
         }
     }
+
+    // All 8 and 16 bit registers share v128_t
+    template<typename U, typename T, std::size_t N, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, N, SIMD>>, typename = std::enable_if_t<N == 8 || N == 16>>
+    FS_FORCEINLINE Register<U, N, SIMD> Cast( const Register<T, N, SIMD>& a, TypeDummy<U> )
+    {
+        return a.GetNative();
+    }
 }
 #endif
@@ -281,4 +281,233 @@ namespace FS
     {            
         return _mm_sqrt_ps( a.native );
     }
+
+
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX2 )
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = EnableIfNative<i32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    FS_FORCEINLINE f32<4, SIMD> Gather( const float* base, const i32<4, SIMD>& idx )
+    {
+        return _mm_i32gather_ps( base, idx.native, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = EnableIfNative<i32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    FS_FORCEINLINE f32<4, SIMD> MaskedGather( const typename f32<4, SIMD>::MaskTypeArg& mask, const float* base, const i32<4, SIMD>& idx )
+    {
+        return _mm_mask_i32gather_ps( _mm_setzero_ps(), base, idx.native, mask.native, 4 );
+    }
+#endif
+
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = EnableIfNative<i32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_VL>>
+    FS_FORCEINLINE void Scatter( float* base, const i32<4, SIMD>& idx, const f32<4, SIMD>& a )
+    {
+        _mm_i32scatter_ps( base, idx.native, a.native, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = EnableIfNative<i32<4, SIMD>>, typename = std::enable_if_t<( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ )>>
+    FS_FORCEINLINE void MaskedScatter( const typename f32<4, SIMD>::MaskTypeArg& mask, float* base, const i32<4, SIMD>& idx, const f32<4, SIMD>& a )
+    {
+        _mm_mask_i32scatter_ps( base, _mm_movepi32_mask( _mm_castps_si128( mask.native ) ), idx.native, a.native, 4 );
+    }
+#endif
+
+
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX )
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX>>
+    FS_FORCEINLINE f32<4, SIMD> LoadPartial( TypeWrapper<const float*, 4, SIMD> ptr, std::size_t count )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm_maskz_loadu_ps( (__mmask8)( ( 1u << ( count < 4 ? count : 4 ) ) - 1 ), ptr.value );
+        }
+        else
+#endif
+        {
+            __m128i active = _mm_cmpgt_epi32( _mm_set1_epi32( (std::int32_t)( count < 4 ? count : 4 ) ), _mm_setr_epi32( 0, 1, 2, 3 ) );
+            return _mm_maskload_ps( ptr.value, active );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX>>
+    FS_FORCEINLINE void StorePartial( typename f32<4, SIMD>::ElementType* ptr, const f32<4, SIMD>& a, std::size_t count )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            _mm_mask_storeu_ps( ptr, (__mmask8)( ( 1u << ( count < 4 ? count : 4 ) ) - 1 ), a.native );
+        }
+        else
+#endif
+        {
+            __m128i active = _mm_cmpgt_epi32( _mm_set1_epi32( (std::int32_t)( count < 4 ? count : 4 ) ), _mm_setr_epi32( 0, 1, 2, 3 ) );
+            _mm_maskstore_ps( ptr, active, a.native );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX>>
+    FS_FORCEINLINE f32<4, SIMD> MaskedLoad( const typename f32<4, SIMD>::MaskTypeArg& mask, TypeWrapper<const float*, 4, SIMD> ptr )
+    {
+        return _mm_maskload_ps( ptr.value, _mm_castps_si128( mask.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX>>
+    FS_FORCEINLINE void MaskedStore( const typename f32<4, SIMD>::MaskTypeArg& mask, typename f32<4, SIMD>::ElementType* ptr, const f32<4, SIMD>& a )
+    {
+        _mm_maskstore_ps( ptr, _mm_castps_si128( mask.native ), a.native );
+    }
+#endif
+
+
+    template<std::size_t C, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE std::array<f32<4, SIMD>, C> LoadInterleaved( TypeWrapper<const float*, 4, SIMD> ptr )
+    {
+        if constexpr( C == 2 )
+        {
+            __m128 a = _mm_loadu_ps( ptr.value );
+            __m128 b = _mm_loadu_ps( ptr.value + 4 );
+
+            return { _mm_shuffle_ps( a, b, _MM_SHUFFLE( 2, 0, 2, 0 ) ), _mm_shuffle_ps( a, b, _MM_SHUFFLE( 3, 1, 3, 1 ) ) };
+        }
+        else if constexpr( C == 3 )
+        {
+            __m128 a = _mm_loadu_ps( ptr.value );     /* x0 y0 z0 x1 */
+            __m128 b = _mm_loadu_ps( ptr.value + 4 ); /* y1 z1 x2 y2 */
+            __m128 c = _mm_loadu_ps( ptr.value + 8 ); /* z2 x3 y3 z3 */
+
+            __m128 x = _mm_shuffle_ps( a, _mm_shuffle_ps( b, c, _MM_SHUFFLE( 0, 1, 0, 2 ) ), _MM_SHUFFLE( 2, 0, 3, 0 ) );
+            __m128 y = _mm_shuffle_ps( _mm_shuffle_ps( a, b, _MM_SHUFFLE( 0, 0, 0, 1 ) ), _mm_shuffle_ps( b, c, _MM_SHUFFLE( 0, 2, 0, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) );
+            __m128 z = _mm_shuffle_ps( _mm_shuffle_ps( a, b, _MM_SHUFFLE( 0, 1, 0, 2 ) ), c, _MM_SHUFFLE( 3, 0, 2, 0 ) );
+
+            return { x, y, z };
+        }
+        else
+        {
+            __m128 t0 = _mm_unpacklo_ps( _mm_loadu_ps( ptr.value ), _mm_loadu_ps( ptr.value + 4 ) );
+            __m128 t1 = _mm_unpacklo_ps( _mm_loadu_ps( ptr.value + 8 ), _mm_loadu_ps( ptr.value + 12 ) );
+            __m128 t2 = _mm_unpackhi_ps( _mm_loadu_ps( ptr.value ), _mm_loadu_ps( ptr.value + 4 ) );
+            __m128 t3 = _mm_unpackhi_ps( _mm_loadu_ps( ptr.value + 8 ), _mm_loadu_ps( ptr.value + 12 ) );
+
+            return { _mm_movelh_ps( t0, t1 ), _mm_movehl_ps( t1, t0 ), _mm_movelh_ps( t2, t3 ), _mm_movehl_ps( t3, t2 ) };
+        }
+    }
+
+    template<std::size_t C, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE void StoreInterleaved( typename f32<4, SIMD>::ElementType* ptr, const std::array<f32<4, SIMD>, C>& a )
+    {
+        if constexpr( C == 2 )
+        {
+            _mm_storeu_ps( ptr, _mm_unpacklo_ps( a[0].native, a[1].native ) );
+            _mm_storeu_ps( ptr + 4, _mm_unpackhi_ps( a[0].native, a[1].native ) );
+        }
+        else if constexpr( C == 3 )
+        {
+            __m128 x = a[0].native;
+            __m128 y = a[1].native;
+            __m128 z = a[2].native;
+
+            _mm_storeu_ps( ptr,     _mm_shuffle_ps( _mm_shuffle_ps( x, y, _MM_SHUFFLE( 0, 0, 0, 0 ) ), _mm_shuffle_ps( z, x, _MM_SHUFFLE( 0, 1, 0, 0 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+            _mm_storeu_ps( ptr + 4, _mm_shuffle_ps( _mm_shuffle_ps( y, z, _MM_SHUFFLE( 0, 1, 0, 1 ) ), _mm_shuffle_ps( x, y, _MM_SHUFFLE( 0, 2, 0, 2 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+            _mm_storeu_ps( ptr + 8, _mm_shuffle_ps( _mm_shuffle_ps( z, x, _MM_SHUFFLE( 0, 3, 0, 2 ) ), _mm_shuffle_ps( y, z, _MM_SHUFFLE( 0, 3, 0, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+        }
+        else
+        {
+            __m128 t0 = _mm_unpacklo_ps( a[0].native, a[1].native );
+            __m128 t1 = _mm_unpacklo_ps( a[2].native, a[3].native );
+            __m128 t2 = _mm_unpackhi_ps( a[0].native, a[1].native );
+            __m128 t3 = _mm_unpackhi_ps( a[2].native, a[3].native );
+
+            _mm_storeu_ps( ptr,      _mm_movelh_ps( t0, t1 ) );
+            _mm_storeu_ps( ptr + 4,  _mm_movehl_ps( t1, t0 ) );
+            _mm_storeu_ps( ptr + 8,  _mm_movelh_ps( t2, t3 ) );
+            _mm_storeu_ps( ptr + 12, _mm_movehl_ps( t3, t2 ) );
+        }
+    }
+
+
+    template<std::size_t... I, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Shuffle( const f32<4, SIMD>& a, std::index_sequence<I...> )
+    {
+        constexpr std::size_t idx[] = { I... };
+
+        return _mm_shuffle_ps( a.native, a.native, _MM_SHUFFLE( idx[3], idx[2], idx[1], idx[0] ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::SSSE3>>
+    FS_FORCEINLINE f32<4, SIMD> Permute( const f32<4, SIMD>& a, const i32<4, SIMD>& idx )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX )
+        {
+            return _mm_permutevar_ps( a.native, idx.native );
+        }
+        else
+#endif
+        {
+            /* spread each element index to the 4 byte indices it covers */
+            __m128i byteIdx = _mm_slli_epi32( _mm_and_si128( idx.native, _mm_set1_epi32( 3 ) ), 2 );
+            byteIdx = _mm_or_si128( byteIdx, _mm_slli_epi32( byteIdx, 8 ) );
+            byteIdx = _mm_or_si128( byteIdx, _mm_slli_epi32( byteIdx, 16 ) );
+            byteIdx = _mm_add_epi32( byteIdx, _mm_set1_epi32( 0x03020100 ) );
+
+            return _mm_castsi128_ps( _mm_shuffle_epi8( _mm_castps_si128( a.native ), byteIdx ) );
+        }
+    }
+
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_VL>>
+    FS_FORCEINLINE f32<4, SIMD> Permute2( const f32<4, SIMD>& a, const f32<4, SIMD>& b, const i32<4, SIMD>& idx )
+    {
+        return _mm_permutex2var_ps( a.native, idx.native, b.native );
+    }
+#endif
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> PrefixSum( const f32<4, SIMD>& a )
+    {
+        __m128 sum = _mm_add_ps( a.native, _mm_castsi128_ps( _mm_slli_si128( _mm_castps_si128( a.native ), 4 ) ) );
+        return _mm_add_ps( sum, _mm_castsi128_ps( _mm_slli_si128( _mm_castps_si128( sum ), 8 ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Compress( const typename f32<4, SIMD>::MaskTypeArg& mask, const f32<4, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ ) )
+        {
+            return _mm_maskz_compress_ps( _mm_movepi32_mask( _mm_castps_si128( mask.native ) ), a.native );
+        }
+        else
+#endif
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSSE3 )
+        {
+            __m128i shuffle = _mm_loadu_si128( (const __m128i*)impl::CompressByteTable4x32[_mm_movemask_ps( mask.native )].data() );
+            return _mm_castsi128_ps( _mm_shuffle_epi8( _mm_castps_si128( a.native ), shuffle ) );
+        }
+        else
+        {
+            return impl::CompressElements( mask, a );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Expand( const typename f32<4, SIMD>::MaskTypeArg& mask, const f32<4, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ ) )
+        {
+            return _mm_maskz_expand_ps( _mm_movepi32_mask( _mm_castps_si128( mask.native ) ), a.native );
+        }
+        else
+#endif
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSSE3 )
+        {
+            __m128i shuffle = _mm_loadu_si128( (const __m128i*)impl::ExpandByteTable4x32[_mm_movemask_ps( mask.native )].data() );
+            return _mm_castsi128_ps( _mm_shuffle_epi8( _mm_castps_si128( a.native ), shuffle ) );
+        }
+        else
+        {
+            return impl::ExpandElements( mask, a );
+        }
+    }
 }
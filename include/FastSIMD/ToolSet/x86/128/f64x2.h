@@ -0,0 +1,257 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<double, 2, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::SSE2>>
+    {
+        static constexpr size_t ElementCount = 2;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m128d;
+        using ElementType = double;
+        using MaskType = m64<ElementCount, true, SIMD>;
+        using MaskTypeArg = m64<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( double v ) : native( _mm_set1_pd( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm_add_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm_sub_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = _mm_mul_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator /=( const Register& rhs )
+        {
+            native = _mm_div_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm_and_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm_or_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm_xor_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator~() const
+        {
+            const __m128i neg1 = _mm_set1_epi32( -1 );
+            return _mm_xor_pd( native, _mm_castsi128_pd( neg1 ) );
+        }
+
+        FS_FORCEINLINE Register operator-() const
+        {
+            return _mm_xor_pd( native, _mm_set1_pd( -0.0 ) );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm_cmpeq_pd( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return _mm_cmpneq_pd( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return _mm_cmpge_pd( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return _mm_cmple_pd( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm_cmpgt_pd( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm_cmplt_pd( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Load( TypeWrapper<const double*, 2, SIMD> ptr )
+    {
+        return _mm_loadu_pd( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE void Store( typename f64<2, SIMD>::ElementType* ptr, const f64<2, SIMD>& a )
+    {
+        _mm_storeu_pd( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE double Extract0( const f64<2, SIMD>& a )
+    {
+        return _mm_cvtsd_f64( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Abs( const f64<2, SIMD>& a )
+    {
+        return _mm_andnot_pd( _mm_set1_pd( -0.0 ), a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Round( const f64<2, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return _mm_round_pd( a.native, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+        }
+        else
+        {
+            // No 64bit int conversion before AVX512, adding 2^52 pushes the fraction out of the mantissa
+            const __m128d signBit = _mm_set1_pd( -0.0 );
+            const __m128d magic = _mm_set1_pd( 4503599627370496.0 );
+
+            __m128d aAbs = _mm_andnot_pd( signBit, a.native );
+            __m128d aRound = _mm_or_pd( _mm_sub_pd( _mm_add_pd( aAbs, magic ), magic ), _mm_and_pd( signBit, a.native ) );
+            __m128d inRange = _mm_cmplt_pd( aAbs, magic );
+
+            return _mm_or_pd( _mm_and_pd( inRange, aRound ), _mm_andnot_pd( inRange, a.native ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Floor( const f64<2, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return _mm_round_pd( a.native, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC );
+        }
+        else
+        {
+            f64<2, SIMD> aRound = Round( a );
+
+            return _mm_sub_pd( aRound.native, _mm_and_pd( _mm_cmpgt_pd( aRound.native, a.native ), _mm_set1_pd( 1.0 ) ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Ceil( const f64<2, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return _mm_round_pd( a.native, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC );
+        }
+        else
+        {
+            f64<2, SIMD> aRound = Round( a );
+
+            return _mm_sub_pd( aRound.native, _mm_and_pd( _mm_cmplt_pd( aRound.native, a.native ), _mm_set1_pd( -1.0 ) ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Trunc( const f64<2, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return _mm_round_pd( a.native, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC );
+        }
+        else
+        {
+            const __m128d signBit = _mm_set1_pd( -0.0 );
+
+            __m128d aAbs = _mm_andnot_pd( signBit, a.native );
+            __m128d aAbsFloor = Floor( f64<2, SIMD>( aAbs ) ).native;
+
+            return _mm_or_pd( aAbsFloor, _mm_and_pd( signBit, a.native ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Min( const f64<2, SIMD>& a, const f64<2, SIMD>& b )
+    {
+        return _mm_min_pd( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Max( const f64<2, SIMD>& a, const f64<2, SIMD>& b )
+    {
+        return _mm_max_pd( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Select( const typename f64<2, SIMD>::MaskTypeArg& mask, const f64<2, SIMD>& ifTrue, const f64<2, SIMD>& ifFalse )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return _mm_blendv_pd( ifFalse.native, ifTrue.native, mask.native );
+        }
+        else
+        {
+            return _mm_xor_pd( ifFalse.native, _mm_and_pd( mask.native, _mm_xor_pd( ifTrue.native, ifFalse.native ) ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> BitwiseAndNot( const f64<2, SIMD>& a, const f64<2, SIMD>& b )
+    {
+        return _mm_andnot_pd( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Masked( const typename f64<2, SIMD>::MaskTypeArg& mask, const f64<2, SIMD>& a )
+    {
+        return _mm_and_pd( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> InvMasked( const typename f64<2, SIMD>::MaskTypeArg& mask, const f64<2, SIMD>& a )
+    {
+        return _mm_andnot_pd( mask.native, a.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<2, SIMD>>>
+    FS_FORCEINLINE f64<2, SIMD> Sqrt( const f64<2, SIMD>& a )
+    {
+        return _mm_sqrt_pd( a.native );
+    }
+}
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int16_t, 8, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::SSE2>>
+    {
+        static constexpr size_t ElementCount = 8;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m128i;
+        using ElementType = std::int16_t;
+        using MaskType = m16<ElementCount, false, SIMD>;
+        using MaskTypeArg = m16<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int16_t v ) : native( _mm_set1_epi16( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm_add_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm_sub_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = _mm_mullo_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm_and_si128( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm_or_si128( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm_xor_si128( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = _mm_srai_epi16( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm_slli_epi16( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m128i neg1 = _mm_set1_epi32( -1 );
+            return _mm_xor_si128( native, neg1 );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm_sub_epi16( _mm_setzero_si128(), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm_cmpeq_epi16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return ~(*this < rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return ~(*this > rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm_cmpgt_epi16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm_cmplt_epi16( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Load( TypeWrapper<const std::int16_t*, 8, SIMD> ptr )
+    {
+        return _mm_loadu_si128( (const __m128i*)ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE void Store( typename i16<8, SIMD>::ElementType* ptr, const i16<8, SIMD>& a )
+    {
+        _mm_storeu_si128( (__m128i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE std::int16_t Extract0( const i16<8, SIMD>& a )
+    {
+        return static_cast<std::int16_t>( _mm_cvtsi128_si32( a.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Abs( const i16<8, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSSE3 )
+        {
+            return _mm_abs_epi16( a.native );
+        }
+        else
+        {
+            return _mm_max_epi16( a.native, _mm_sub_epi16( _mm_setzero_si128(), a.native ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Min( const i16<8, SIMD>& a, const i16<8, SIMD>& b )
+    {
+        return _mm_min_epi16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Max( const i16<8, SIMD>& a, const i16<8, SIMD>& b )
+    {
+        return _mm_max_epi16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Select( const typename i16<8, SIMD>::MaskTypeArg& mask, const i16<8, SIMD>& ifTrue, const i16<8, SIMD>& ifFalse )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return _mm_blendv_epi8( ifFalse.native, ifTrue.native, mask.native );
+        }
+        else
+        {
+            return _mm_xor_si128( ifFalse.native, _mm_and_si128( mask.native, _mm_xor_si128( ifTrue.native, ifFalse.native ) ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> BitwiseAndNot( const i16<8, SIMD>& a, const i16<8, SIMD>& b )
+    {
+        return _mm_andnot_si128( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> BitShiftRightZeroExtend( const i16<8, SIMD>& a, int b )
+    {
+        return _mm_srli_epi16( a.native, b );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Masked( const typename i16<8, SIMD>::MaskTypeArg& mask, const i16<8, SIMD>& a )
+    {
+        return _mm_and_si128( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> InvMasked( const typename i16<8, SIMD>::MaskTypeArg& mask, const i16<8, SIMD>& a )
+    {
+        return _mm_andnot_si128( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> MaskedIncrement( const typename i16<8, SIMD>::MaskTypeArg& mask, const i16<8, SIMD>& a )
+    {
+        return _mm_sub_epi16( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> MaskedDecrement( const typename i16<8, SIMD>::MaskTypeArg& mask, const i16<8, SIMD>& a )
+    {
+        return _mm_add_epi16( a.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> AddSat( const i16<8, SIMD>& a, const i16<8, SIMD>& b )
+    {
+        return _mm_adds_epi16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> SubSat( const i16<8, SIMD>& a, const i16<8, SIMD>& b )
+    {
+        return _mm_subs_epi16( a.native, b.native );
+    }
+}
@@ -4,6 +4,23 @@
 
 namespace FS
 {
+    namespace impl
+    {
+        // Shift each element by its own count, using a uniform count shift for each element and combining the results
+        template<typename SHIFT>
+        FS_FORCEINLINE __m128i NativeShiftVariable( __m128i a, __m128i count, SHIFT shift )
+        {
+            const __m128i zero = _mm_setzero_si128();
+            __m128i count01 = _mm_unpacklo_epi32( count, zero );
+            __m128i count23 = _mm_unpackhi_epi32( count, zero );
+
+            __m128i shift01 = _mm_unpacklo_epi64( shift( a, count01 ), shift( a, _mm_srli_si128( count01, 8 ) ) );
+            __m128i shift23 = _mm_unpackhi_epi64( shift( a, count23 ), shift( a, _mm_srli_si128( count23, 8 ) ) );
+
+            return _mm_castps_si128( _mm_shuffle_ps( _mm_castsi128_ps( shift01 ), _mm_castsi128_ps( shift23 ), _MM_SHUFFLE( 3, 0, 3, 0 ) ) );
+        }
+    }
+
     template<FastSIMD::FeatureSet SIMD>
     struct Register<std::int32_t, 4, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::SSE2>>
     {
@@ -81,6 +98,36 @@ namespace FS
             return *this;
         }
 
+        FS_FORCEINLINE Register& operator >>=( const Register& rhs )
+        {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX2 )
+            if constexpr( SIMD & FastSIMD::FeatureFlag::AVX2 )
+            {
+                native = _mm_srav_epi32( native, rhs.native );
+            }
+            else
+#endif
+            {
+                native = impl::NativeShiftVariable( native, rhs.native, []( __m128i a, __m128i count ) { return _mm_sra_epi32( a, count ); } );
+            }
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( const Register& rhs )
+        {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX2 )
+            if constexpr( SIMD & FastSIMD::FeatureFlag::AVX2 )
+            {
+                native = _mm_sllv_epi32( native, rhs.native );
+            }
+            else
+#endif
+            {
+                native = impl::NativeShiftVariable( native, rhs.native, []( __m128i a, __m128i count ) { return _mm_sll_epi32( a, count ); } );
+            }
+            return *this;
+        }
+
         FS_FORCEINLINE Register operator ~() const
         {
             const __m128i neg1 = _mm_set1_epi32( -1 );
@@ -240,4 +287,226 @@ namespace FS
     {
         return _mm_add_epi32( a.native, _mm_castps_si128( mask.native ) );    
     }
+
+
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX2 )
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    FS_FORCEINLINE i32<4, SIMD> Gather( const std::int32_t* base, const i32<4, SIMD>& idx )
+    {
+        return _mm_i32gather_epi32( base, idx.native, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    FS_FORCEINLINE i32<4, SIMD> MaskedGather( const typename i32<4, SIMD>::MaskTypeArg& mask, const std::int32_t* base, const i32<4, SIMD>& idx )
+    {
+        return _mm_mask_i32gather_epi32( _mm_setzero_si128(), base, idx.native, _mm_castps_si128( mask.native ), 4 );
+    }
+#endif
+
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_VL>>
+    FS_FORCEINLINE void Scatter( std::int32_t* base, const i32<4, SIMD>& idx, const i32<4, SIMD>& a )
+    {
+        _mm_i32scatter_epi32( base, idx.native, a.native, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = std::enable_if_t<( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ )>>
+    FS_FORCEINLINE void MaskedScatter( const typename i32<4, SIMD>::MaskTypeArg& mask, std::int32_t* base, const i32<4, SIMD>& idx, const i32<4, SIMD>& a )
+    {
+        _mm_mask_i32scatter_epi32( base, _mm_movepi32_mask( _mm_castps_si128( mask.native ) ), idx.native, a.native, 4 );
+    }
+#endif
+
+
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX2 )
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    FS_FORCEINLINE i32<4, SIMD> LoadPartial( TypeWrapper<const std::int32_t*, 4, SIMD> ptr, std::size_t count )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm_maskz_loadu_epi32( (__mmask8)( ( 1u << ( count < 4 ? count : 4 ) ) - 1 ), ptr.value );
+        }
+        else
+#endif
+        {
+            __m128i active = _mm_cmpgt_epi32( _mm_set1_epi32( (std::int32_t)( count < 4 ? count : 4 ) ), _mm_setr_epi32( 0, 1, 2, 3 ) );
+            return _mm_maskload_epi32( ptr.value, active );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    FS_FORCEINLINE void StorePartial( typename i32<4, SIMD>::ElementType* ptr, const i32<4, SIMD>& a, std::size_t count )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            _mm_mask_storeu_epi32( ptr, (__mmask8)( ( 1u << ( count < 4 ? count : 4 ) ) - 1 ), a.native );
+        }
+        else
+#endif
+        {
+            __m128i active = _mm_cmpgt_epi32( _mm_set1_epi32( (std::int32_t)( count < 4 ? count : 4 ) ), _mm_setr_epi32( 0, 1, 2, 3 ) );
+            _mm_maskstore_epi32( ptr, active, a.native );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    FS_FORCEINLINE i32<4, SIMD> MaskedLoad( const typename i32<4, SIMD>::MaskTypeArg& mask, TypeWrapper<const std::int32_t*, 4, SIMD> ptr )
+    {
+        return _mm_maskload_epi32( ptr.value, _mm_castps_si128( mask.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    FS_FORCEINLINE void MaskedStore( const typename i32<4, SIMD>::MaskTypeArg& mask, typename i32<4, SIMD>::ElementType* ptr, const i32<4, SIMD>& a )
+    {
+        _mm_maskstore_epi32( ptr, _mm_castps_si128( mask.native ), a.native );
+    }
+#endif
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> PrefixSum( const i32<4, SIMD>& a )
+    {
+        __m128i sum = _mm_add_epi32( a.native, _mm_slli_si128( a.native, 4 ) );
+        return _mm_add_epi32( sum, _mm_slli_si128( sum, 8 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> MulHi( const i32<4, SIMD>& a, const i32<4, SIMD>& b )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            __m128i mul20 = _mm_mul_epi32( a.native, b.native ); /* mul 2,0 */
+            __m128i mul31 = _mm_mul_epi32( _mm_srli_epi64( a.native, 32 ), _mm_srli_epi64( b.native, 32 ) ); /* mul 3,1 */
+            return _mm_blend_epi16( _mm_srli_epi64( mul20, 32 ), mul31, 0xCC );
+        }
+        else
+        {
+            /* unsigned high product, corrected for negative inputs */
+            __m128i mul20 = _mm_mul_epu32( a.native, b.native ); /* mul 2,0 */
+            __m128i mul31 = _mm_mul_epu32( _mm_srli_epi64( a.native, 32 ), _mm_srli_epi64( b.native, 32 ) ); /* mul 3,1 */
+            __m128i high = _mm_unpacklo_epi32( _mm_shuffle_epi32( mul20, _MM_SHUFFLE( 3, 1, 3, 1 ) ), _mm_shuffle_epi32( mul31, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+
+            __m128i correction = _mm_add_epi32( _mm_and_si128( _mm_srai_epi32( a.native, 31 ), b.native ), _mm_and_si128( _mm_srai_epi32( b.native, 31 ), a.native ) );
+            return _mm_sub_epi32( high, correction );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MulWidenEven( const i32<4, SIMD>& a, const i32<4, SIMD>& b )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return _mm_mul_epi32( a.native, b.native );
+        }
+        else
+        {
+            /* unsigned product, high half corrected for negative inputs */
+            __m128i correction = _mm_add_epi32( _mm_and_si128( _mm_srai_epi32( a.native, 31 ), b.native ), _mm_and_si128( _mm_srai_epi32( b.native, 31 ), a.native ) );
+            return _mm_sub_epi64( _mm_mul_epu32( a.native, b.native ), _mm_slli_epi64( correction, 32 ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MulWidenOdd( const i32<4, SIMD>& a, const i32<4, SIMD>& b )
+    {
+        return MulWidenEven( i32<4, SIMD>( _mm_srli_epi64( a.native, 32 ) ), i32<4, SIMD>( _mm_srli_epi64( b.native, 32 ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> PopCount( const i32<4, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 ) && defined( __AVX512VPOPCNTDQ__ )
+        if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_VPOPCNTDQ ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) )
+        {
+            return _mm_popcnt_epi32( a.native );
+        }
+        else
+#endif
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSSE3 )
+        {
+            /* bit count of each nibble from a lookup table, then sum the 4 bytes of each element */
+            const __m128i lut = _mm_setr_epi8( 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 );
+            const __m128i lowNibble = _mm_set1_epi8( 0x0F );
+
+            __m128i count = _mm_add_epi8( _mm_shuffle_epi8( lut, _mm_and_si128( a.native, lowNibble ) ), _mm_shuffle_epi8( lut, _mm_and_si128( _mm_srli_epi16( a.native, 4 ), lowNibble ) ) );
+            return _mm_madd_epi16( _mm_maddubs_epi16( count, _mm_set1_epi8( 1 ) ), _mm_set1_epi16( 1 ) );
+        }
+        else
+        {
+            return impl::PopCountSwar( a );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> CountLeadingZeros( const i32<4, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_CD ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) )
+        {
+            return _mm_lzcnt_epi32( a.native );
+        }
+        else
+#endif
+        {
+            return impl::CountLeadingZerosFloat( a );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> RotateLeft( const i32<4, SIMD>& a, int b )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm_rolv_epi32( a.native, _mm_set1_epi32( b ) );
+        }
+        else
+#endif
+        {
+            return impl::RotateLeftShift( a, b );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> Compress( const typename i32<4, SIMD>::MaskTypeArg& mask, const i32<4, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ ) )
+        {
+            return _mm_maskz_compress_epi32( _mm_movepi32_mask( _mm_castps_si128( mask.native ) ), a.native );
+        }
+        else
+#endif
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSSE3 )
+        {
+            __m128i shuffle = _mm_loadu_si128( (const __m128i*)impl::CompressByteTable4x32[_mm_movemask_ps( mask.native )].data() );
+            return _mm_shuffle_epi8( a.native, shuffle );
+        }
+        else
+        {
+            return impl::CompressElements( mask, a );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> Expand( const typename i32<4, SIMD>::MaskTypeArg& mask, const i32<4, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ ) )
+        {
+            return _mm_maskz_expand_epi32( _mm_movepi32_mask( _mm_castps_si128( mask.native ) ), a.native );
+        }
+        else
+#endif
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSSE3 )
+        {
+            __m128i shuffle = _mm_loadu_si128( (const __m128i*)impl::ExpandByteTable4x32[_mm_movemask_ps( mask.native )].data() );
+            return _mm_shuffle_epi8( a.native, shuffle );
+        }
+        else
+        {
+            return impl::ExpandElements( mask, a );
+        }
+    }
 }
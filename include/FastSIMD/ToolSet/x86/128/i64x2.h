@@ -0,0 +1,277 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int64_t, 2, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::SSE2>>
+    {
+        static constexpr size_t ElementCount = 2;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m128i;
+        using ElementType = std::int64_t;
+        using MaskType = m64<ElementCount, false, SIMD>;
+        using MaskTypeArg = m64<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int64_t v ) : native( _mm_set1_epi64x( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm_add_epi64( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm_sub_epi64( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+            if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) )
+            {
+                native = _mm_mullo_epi64( native, rhs.native );
+            }
+            else
+#endif
+            {
+                __m128i lolo = _mm_mul_epu32( native, rhs.native ); /* lo * lo, full 64 bit */
+                __m128i lohi = _mm_mul_epu32( native, _mm_srli_epi64( rhs.native, 32 ) ); /* lo * hi */
+                __m128i hilo = _mm_mul_epu32( _mm_srli_epi64( native, 32 ), rhs.native ); /* hi * lo */
+                native = _mm_add_epi64( lolo, _mm_slli_epi64( _mm_add_epi64( lohi, hilo ), 32 ) );
+            }
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm_and_si128( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm_or_si128( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm_xor_si128( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+            if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+            {
+                native = _mm_srai_epi64( native, rhs );
+            }
+            else
+#endif
+            {
+                /* no 64 bit arithmetic shift, flip negative lanes around a logical shift */
+                __m128i signMask = _mm_srai_epi32( _mm_shuffle_epi32( native, _MM_SHUFFLE( 3, 3, 1, 1 ) ), 31 );
+                native = _mm_xor_si128( _mm_srli_epi64( _mm_xor_si128( native, signMask ), rhs ), signMask );
+            }
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm_slli_epi64( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m128i neg1 = _mm_set1_epi32( -1 );
+            return _mm_xor_si128( native, neg1 );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm_sub_epi64( _mm_setzero_si128(), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+            {
+                return _mm_cmpeq_epi64( native, rhs.native );
+            }
+            else
+            {
+                __m128i eq32 = _mm_cmpeq_epi32( native, rhs.native );
+                return _mm_and_si128( eq32, _mm_shuffle_epi32( eq32, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+            }
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return ~(*this < rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return ~(*this > rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            if constexpr( SIMD & FastSIMD::FeatureFlag::SSE42 )
+            {
+                return _mm_cmpgt_epi64( native, rhs.native );
+            }
+            else
+            {
+                /* high dword decides unless equal, then borrow from (rhs - this) carries the unsigned low dword compare */
+                __m128i gt = _mm_and_si128( _mm_cmpeq_epi32( native, rhs.native ), _mm_sub_epi64( rhs.native, native ) );
+                gt = _mm_or_si128( gt, _mm_cmpgt_epi32( native, rhs.native ) );
+                return _mm_shuffle_epi32( gt, _MM_SHUFFLE( 3, 3, 1, 1 ) );
+            }
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return rhs > *this;
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Load( TypeWrapper<const std::int64_t*, 2, SIMD> ptr )
+    {
+        return _mm_loadu_si128( (const __m128i*)ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE void Store( typename i64<2, SIMD>::ElementType* ptr, const i64<2, SIMD>& a )
+    {
+        _mm_storeu_si128( (__m128i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE std::int64_t Extract0( const i64<2, SIMD>& a )
+    {
+        std::int64_t value;
+        _mm_storel_epi64( (__m128i*)&value, a.native );
+        return value;
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Abs( const i64<2, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm_abs_epi64( a.native );
+        }
+        else
+#endif
+        {
+            __m128i signMask = _mm_srai_epi32( _mm_shuffle_epi32( a.native, _MM_SHUFFLE( 3, 3, 1, 1 ) ), 31 );
+            return _mm_sub_epi64( _mm_xor_si128( a.native, signMask ), signMask );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Min( const i64<2, SIMD>& a, const i64<2, SIMD>& b )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm_min_epi64( a.native, b.native );
+        }
+        else
+#endif
+        {
+            return Select( a < b, a, b );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Max( const i64<2, SIMD>& a, const i64<2, SIMD>& b )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm_max_epi64( a.native, b.native );
+        }
+        else
+#endif
+        {
+            return Select( a > b, a, b );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Select( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& ifTrue, const i64<2, SIMD>& ifFalse )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return _mm_blendv_epi8( ifFalse.native, ifTrue.native, _mm_castpd_si128( mask.native ) );
+        }
+        else
+        {
+            return _mm_xor_si128( ifFalse.native, _mm_and_si128( _mm_castpd_si128( mask.native ), _mm_xor_si128( ifTrue.native, ifFalse.native ) ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> BitwiseAndNot( const i64<2, SIMD>& a, const i64<2, SIMD>& b )
+    {
+        return _mm_andnot_si128( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> BitShiftRightZeroExtend( const i64<2, SIMD>& a, int b )
+    {
+        return _mm_srli_epi64( a.native, b );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> Masked( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& a )
+    {
+        return _mm_and_si128( _mm_castpd_si128( mask.native ), a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> InvMasked( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& a )
+    {
+        return _mm_andnot_si128( _mm_castpd_si128( mask.native ), a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MaskedIncrement( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& a )
+    {
+        return _mm_sub_epi64( a.native, _mm_castpd_si128( mask.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<2, SIMD>>>
+    FS_FORCEINLINE i64<2, SIMD> MaskedDecrement( const typename i64<2, SIMD>::MaskTypeArg& mask, const i64<2, SIMD>& a )
+    {
+        return _mm_add_epi64( a.native, _mm_castpd_si128( mask.native ) );
+    }
+}
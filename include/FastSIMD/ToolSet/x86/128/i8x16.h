@@ -0,0 +1,237 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int8_t, 16, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::SSE2>>
+    {
+        static constexpr size_t ElementCount = 16;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m128i;
+        using ElementType = std::int8_t;
+        using MaskType = m8<ElementCount, false, SIMD>;
+        using MaskTypeArg = m8<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int8_t v ) : native( _mm_set1_epi8( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm_add_epi8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm_sub_epi8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm_and_si128( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm_or_si128( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm_xor_si128( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            /* no 8 bit shifts, shift odd bytes in place and even bytes from the top of each 16 bit lane */
+            __m128i odd = _mm_and_si128( _mm_srai_epi16( native, rhs ), _mm_set1_epi16( (std::int16_t)0xFF00 ) );
+            __m128i even = _mm_srli_epi16( _mm_srai_epi16( _mm_slli_epi16( native, 8 ), rhs ), 8 );
+            native = _mm_or_si128( odd, even );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm_and_si128( _mm_slli_epi16( native, rhs ), _mm_set1_epi8( (std::int8_t)( 0xFF << rhs ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m128i neg1 = _mm_set1_epi32( -1 );
+            return _mm_xor_si128( native, neg1 );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm_sub_epi8( _mm_setzero_si128(), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm_cmpeq_epi8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return ~(*this < rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return ~(*this > rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm_cmpgt_epi8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm_cmplt_epi8( native, rhs.native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Load( TypeWrapper<const std::int8_t*, 16, SIMD> ptr )
+    {
+        return _mm_loadu_si128( (const __m128i*)ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE void Store( typename i8<16, SIMD>::ElementType* ptr, const i8<16, SIMD>& a )
+    {
+        _mm_storeu_si128( (__m128i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE std::int8_t Extract0( const i8<16, SIMD>& a )
+    {
+        return static_cast<std::int8_t>( _mm_cvtsi128_si32( a.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Abs( const i8<16, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSSE3 )
+        {
+            return _mm_abs_epi8( a.native );
+        }
+        else
+        {
+            return _mm_min_epu8( a.native, _mm_sub_epi8( _mm_setzero_si128(), a.native ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Min( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return _mm_min_epi8( a.native, b.native );
+        }
+        else
+        {
+            return Select( a < b, a, b );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Max( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return _mm_max_epi8( a.native, b.native );
+        }
+        else
+        {
+            return Select( a > b, a, b );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Select( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& ifTrue, const i8<16, SIMD>& ifFalse )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return _mm_blendv_epi8( ifFalse.native, ifTrue.native, mask.native );
+        }
+        else
+        {
+            return _mm_xor_si128( ifFalse.native, _mm_and_si128( mask.native, _mm_xor_si128( ifTrue.native, ifFalse.native ) ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> BitwiseAndNot( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        return _mm_andnot_si128( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> BitShiftRightZeroExtend( const i8<16, SIMD>& a, int b )
+    {
+        return _mm_and_si128( _mm_srli_epi16( a.native, b ), _mm_set1_epi8( (std::int8_t)( 0xFF >> b ) ) );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Masked( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& a )
+    {
+        return _mm_and_si128( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> InvMasked( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& a )
+    {
+        return _mm_andnot_si128( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> MaskedIncrement( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& a )
+    {
+        return _mm_sub_epi8( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> MaskedDecrement( const typename i8<16, SIMD>::MaskTypeArg& mask, const i8<16, SIMD>& a )
+    {
+        return _mm_add_epi8( a.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> AddSat( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        return _mm_adds_epi8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> SubSat( const i8<16, SIMD>& a, const i8<16, SIMD>& b )
+    {
+        return _mm_subs_epi8( a.native, b.native );
+    }
+}
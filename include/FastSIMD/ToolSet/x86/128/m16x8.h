@@ -0,0 +1,78 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    namespace impl
+    {
+        struct SSEMaskBase16x8
+        {
+            __m128i native;
+        };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool OPTIMISE_FLOAT>
+    struct Register<Mask<16, OPTIMISE_FLOAT>, 8, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::SSE2>>
+        : std::conditional_t<OPTIMISE_FLOAT, impl::SSEMaskBase16x8, Register<Mask<16, true>, 8, SIMD>>
+    {
+        static constexpr size_t ElementCount = 8;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = decltype(SSEMaskBase16x8::native);
+        using ElementType = Mask<16, OPTIMISE_FLOAT>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) { this->native = v; }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return this->native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = _mm_and_si128( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = _mm_or_si128( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = _mm_xor_si128( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m128i neg1 = _mm_set1_epi32( -1 );
+            return _mm_xor_si128( this->native, neg1 );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m16<8, B, SIMD>>>
+    FS_FORCEINLINE m16<8, B, SIMD> BitwiseAndNot( const m16<8, B, SIMD>& a, const m16<8, B, SIMD>& b )
+    {
+        return _mm_andnot_si128( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m16<8, B, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const m16<8, B, SIMD>& a )
+    {
+        return _mm_movemask_epi8( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m16<8, B, SIMD>>>
+    FS_FORCEINLINE BitStorage<8> BitMask( const m16<8, B, SIMD>& a )
+    {
+        // Saturating pack keeps each 16 bit lane's all/none state in a single byte
+        return static_cast<BitStorage<8>>( _mm_movemask_epi8( _mm_packs_epi16( a.native, _mm_setzero_si128() ) ) );
+    }
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<Mask<64, true>, 2, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::SSE2>>
+    {
+        static constexpr size_t ElementCount = 2;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m128d;
+        using ElementType = Mask<64, true>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm_and_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm_or_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm_xor_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m128i neg1 = _mm_set1_epi32( -1 );
+            return _mm_xor_pd( native, _mm_castsi128_pd( neg1 ) );
+        }
+
+        NativeType native;
+    };
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<m64<2, true, SIMD>>>
+    FS_FORCEINLINE m64<2, true, SIMD> BitwiseAndNot( const m64<2, true, SIMD>& a, const m64<2, true, SIMD>& b )
+    {
+        return _mm_andnot_pd( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<m64<2, true, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const m64<2, true, SIMD>& a )
+    {
+        return _mm_movemask_pd( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m64<2, B, SIMD>>>
+    FS_FORCEINLINE BitStorage<2> BitMask( const m64<2, B, SIMD>& a )
+    {
+        return static_cast<BitStorage<2>>( _mm_movemask_pd( a.native ) );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<Mask<64, false>, 2, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::SSE2>> : Register<Mask<64, true>, 2, SIMD>
+    {
+        static constexpr size_t ElementCount = 2;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m128i;
+        using ElementType = Mask<64, false>;
+        using MaskType = Register;
+        using MaskTypeArg = Register<Mask<64, true>, 2, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : Register<Mask<64, true>, 2, SIMD>( _mm_castsi128_pd( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return _mm_castpd_si128( this->native );
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = _mm_castsi128_pd( _mm_and_si128( _mm_castpd_si128( this->native ), _mm_castpd_si128( rhs.native ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = _mm_castsi128_pd( _mm_or_si128( _mm_castpd_si128( this->native ), _mm_castpd_si128( rhs.native ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = _mm_castsi128_pd( _mm_xor_si128( _mm_castpd_si128( this->native ), _mm_castpd_si128( rhs.native ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m128i neg1 = _mm_set1_epi32( -1 );
+            return _mm_xor_si128( _mm_castpd_si128( this->native ), neg1 );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<m64<2, false, SIMD>>>
+    FS_FORCEINLINE m64<2, false, SIMD> BitwiseAndNot( const m64<2, false, SIMD>& a, const m64<2, false, SIMD>& b )
+    {
+        return _mm_andnot_si128( _mm_castpd_si128( b.native ), _mm_castpd_si128( a.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<m64<2, false, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const m64<2, false, SIMD>& a )
+    {
+        return _mm_movemask_epi8( _mm_castpd_si128( a.native ) );
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    namespace impl
+    {
+        struct SSEMaskBase8x16
+        {
+            __m128i native;
+        };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool OPTIMISE_FLOAT>
+    struct Register<Mask<8, OPTIMISE_FLOAT>, 16, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::SSE2>>
+        : std::conditional_t<OPTIMISE_FLOAT, impl::SSEMaskBase8x16, Register<Mask<8, true>, 16, SIMD>>
+    {
+        static constexpr size_t ElementCount = 16;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = decltype(SSEMaskBase8x16::native);
+        using ElementType = Mask<8, OPTIMISE_FLOAT>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) { this->native = v; }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return this->native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = _mm_and_si128( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = _mm_or_si128( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = _mm_xor_si128( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m128i neg1 = _mm_set1_epi32( -1 );
+            return _mm_xor_si128( this->native, neg1 );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m8<16, B, SIMD>>>
+    FS_FORCEINLINE m8<16, B, SIMD> BitwiseAndNot( const m8<16, B, SIMD>& a, const m8<16, B, SIMD>& b )
+    {
+        return _mm_andnot_si128( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m8<16, B, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const m8<16, B, SIMD>& a )
+    {
+        return _mm_movemask_epi8( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m8<16, B, SIMD>>>
+    FS_FORCEINLINE BitStorage<16> BitMask( const m8<16, B, SIMD>& a )
+    {
+        return static_cast<BitStorage<16>>( _mm_movemask_epi8( a.native ) );
+    }
+}
@@ -259,4 +259,281 @@ namespace FS
     {            
         return _mm256_fnmsub_ps( a.native, b.native, c.native );
     }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE f32<8, SIMD> Gather( const float* base, const i32<8, SIMD>& idx )
+    {
+        return _mm256_i32gather_ps( base, idx.native, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE f32<8, SIMD> MaskedGather( const typename f32<8, SIMD>::MaskTypeArg& mask, const float* base, const i32<8, SIMD>& idx )
+    {
+        return _mm256_mask_i32gather_ps( _mm256_setzero_ps(), base, idx.native, mask.native, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>, typename = EnableIfNative<i32<8, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_VL>>
+    FS_FORCEINLINE void Scatter( float* base, const i32<8, SIMD>& idx, const f32<8, SIMD>& a )
+    {
+        _mm256_i32scatter_ps( base, idx.native, a.native, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>, typename = EnableIfNative<i32<8, SIMD>>, typename = std::enable_if_t<( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ )>>
+    FS_FORCEINLINE void MaskedScatter( const typename f32<8, SIMD>::MaskTypeArg& mask, float* base, const i32<8, SIMD>& idx, const f32<8, SIMD>& a )
+    {
+        _mm256_mask_i32scatter_ps( base, _mm256_movepi32_mask( _mm256_castps_si256( mask.native ) ), idx.native, a.native, 4 );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>>
+    FS_FORCEINLINE f32<8, SIMD> LoadPartial( TypeWrapper<const float*, 8, SIMD> ptr, std::size_t count )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm256_maskz_loadu_ps( (__mmask8)( ( 1u << ( count < 8 ? count : 8 ) ) - 1 ), ptr.value );
+        }
+        else
+        {
+            /* float compare, integer compares need AVX2 */
+            __m256 active = _mm256_cmp_ps( _mm256_setr_ps( 0, 1, 2, 3, 4, 5, 6, 7 ), _mm256_set1_ps( (float)( count < 8 ? count : 8 ) ), _CMP_LT_OQ );
+            return _mm256_maskload_ps( ptr.value, _mm256_castps_si256( active ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>>
+    FS_FORCEINLINE void StorePartial( typename f32<8, SIMD>::ElementType* ptr, const f32<8, SIMD>& a, std::size_t count )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            _mm256_mask_storeu_ps( ptr, (__mmask8)( ( 1u << ( count < 8 ? count : 8 ) ) - 1 ), a.native );
+        }
+        else
+        {
+            __m256 active = _mm256_cmp_ps( _mm256_setr_ps( 0, 1, 2, 3, 4, 5, 6, 7 ), _mm256_set1_ps( (float)( count < 8 ? count : 8 ) ), _CMP_LT_OQ );
+            _mm256_maskstore_ps( ptr, _mm256_castps_si256( active ), a.native );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>>
+    FS_FORCEINLINE f32<8, SIMD> MaskedLoad( const typename f32<8, SIMD>::MaskTypeArg& mask, TypeWrapper<const float*, 8, SIMD> ptr )
+    {
+        return _mm256_maskload_ps( ptr.value, _mm256_castps_si256( mask.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>>
+    FS_FORCEINLINE void MaskedStore( const typename f32<8, SIMD>::MaskTypeArg& mask, typename f32<8, SIMD>::ElementType* ptr, const f32<8, SIMD>& a )
+    {
+        _mm256_maskstore_ps( ptr, _mm256_castps_si256( mask.native ), a.native );
+    }
+
+
+    namespace impl
+    {
+        // De-interleave 3 or 4 element structures within each 128 bit lane, lane ordering is handled by the caller
+        FS_FORCEINLINE std::array<__m256, 3> Deinterleave3Lanes( __m256 a, __m256 b, __m256 c )
+        {
+            __m256 x = _mm256_shuffle_ps( a, _mm256_shuffle_ps( b, c, _MM_SHUFFLE( 0, 1, 0, 2 ) ), _MM_SHUFFLE( 2, 0, 3, 0 ) );
+            __m256 y = _mm256_shuffle_ps( _mm256_shuffle_ps( a, b, _MM_SHUFFLE( 0, 0, 0, 1 ) ), _mm256_shuffle_ps( b, c, _MM_SHUFFLE( 0, 2, 0, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) );
+            __m256 z = _mm256_shuffle_ps( _mm256_shuffle_ps( a, b, _MM_SHUFFLE( 0, 1, 0, 2 ) ), c, _MM_SHUFFLE( 3, 0, 2, 0 ) );
+
+            return { x, y, z };
+        }
+
+        FS_FORCEINLINE std::array<__m256, 3> Interleave3Lanes( __m256 x, __m256 y, __m256 z )
+        {
+            return {
+                _mm256_shuffle_ps( _mm256_shuffle_ps( x, y, _MM_SHUFFLE( 0, 0, 0, 0 ) ), _mm256_shuffle_ps( z, x, _MM_SHUFFLE( 0, 1, 0, 0 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ),
+                _mm256_shuffle_ps( _mm256_shuffle_ps( y, z, _MM_SHUFFLE( 0, 1, 0, 1 ) ), _mm256_shuffle_ps( x, y, _MM_SHUFFLE( 0, 2, 0, 2 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ),
+                _mm256_shuffle_ps( _mm256_shuffle_ps( z, x, _MM_SHUFFLE( 0, 3, 0, 2 ) ), _mm256_shuffle_ps( y, z, _MM_SHUFFLE( 0, 3, 0, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) )
+            };
+        }
+
+        // 4x4 transpose within each 128 bit lane
+        FS_FORCEINLINE std::array<__m256, 4> Transpose4Lanes( __m256 a, __m256 b, __m256 c, __m256 d )
+        {
+            __m256d t0 = _mm256_castps_pd( _mm256_unpacklo_ps( a, b ) );
+            __m256d t1 = _mm256_castps_pd( _mm256_unpacklo_ps( c, d ) );
+            __m256d t2 = _mm256_castps_pd( _mm256_unpackhi_ps( a, b ) );
+            __m256d t3 = _mm256_castps_pd( _mm256_unpackhi_ps( c, d ) );
+
+            return {
+                _mm256_castpd_ps( _mm256_unpacklo_pd( t0, t1 ) ),
+                _mm256_castpd_ps( _mm256_unpackhi_pd( t0, t1 ) ),
+                _mm256_castpd_ps( _mm256_unpacklo_pd( t2, t3 ) ),
+                _mm256_castpd_ps( _mm256_unpackhi_pd( t2, t3 ) )
+            };
+        }
+    }
+
+    template<std::size_t C, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>>
+    FS_FORCEINLINE std::array<f32<8, SIMD>, C> LoadInterleaved( TypeWrapper<const float*, 8, SIMD> ptr )
+    {
+        // Gather each group of 4 structures into one 128 bit lane, then de-interleave within lanes
+        if constexpr( C == 2 )
+        {
+            __m256 a = _mm256_loadu_ps( ptr.value );
+            __m256 b = _mm256_loadu_ps( ptr.value + 8 );
+            __m256 lo = _mm256_permute2f128_ps( a, b, 0x20 );
+            __m256 hi = _mm256_permute2f128_ps( a, b, 0x31 );
+
+            return { _mm256_shuffle_ps( lo, hi, _MM_SHUFFLE( 2, 0, 2, 0 ) ), _mm256_shuffle_ps( lo, hi, _MM_SHUFFLE( 3, 1, 3, 1 ) ) };
+        }
+        else if constexpr( C == 3 )
+        {
+            __m256 a = _mm256_loadu_ps( ptr.value );
+            __m256 b = _mm256_loadu_ps( ptr.value + 8 );
+            __m256 c = _mm256_loadu_ps( ptr.value + 16 );
+
+            auto r = impl::Deinterleave3Lanes( _mm256_permute2f128_ps( a, b, 0x30 ), _mm256_permute2f128_ps( a, c, 0x21 ), _mm256_permute2f128_ps( b, c, 0x30 ) );
+
+            return { r[0], r[1], r[2] };
+        }
+        else
+        {
+            __m256 a = _mm256_loadu_ps( ptr.value );
+            __m256 b = _mm256_loadu_ps( ptr.value + 8 );
+            __m256 c = _mm256_loadu_ps( ptr.value + 16 );
+            __m256 d = _mm256_loadu_ps( ptr.value + 24 );
+
+            auto r = impl::Transpose4Lanes( _mm256_permute2f128_ps( a, c, 0x20 ), _mm256_permute2f128_ps( a, c, 0x31 ),
+                                            _mm256_permute2f128_ps( b, d, 0x20 ), _mm256_permute2f128_ps( b, d, 0x31 ) );
+
+            return { r[0], r[1], r[2], r[3] };
+        }
+    }
+
+    template<std::size_t C, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>>
+    FS_FORCEINLINE void StoreInterleaved( typename f32<8, SIMD>::ElementType* ptr, const std::array<f32<8, SIMD>, C>& a )
+    {
+        if constexpr( C == 2 )
+        {
+            __m256 lo = _mm256_unpacklo_ps( a[0].native, a[1].native );
+            __m256 hi = _mm256_unpackhi_ps( a[0].native, a[1].native );
+
+            _mm256_storeu_ps( ptr, _mm256_permute2f128_ps( lo, hi, 0x20 ) );
+            _mm256_storeu_ps( ptr + 8, _mm256_permute2f128_ps( lo, hi, 0x31 ) );
+        }
+        else if constexpr( C == 3 )
+        {
+            auto r = impl::Interleave3Lanes( a[0].native, a[1].native, a[2].native );
+
+            _mm256_storeu_ps( ptr,      _mm256_permute2f128_ps( r[0], r[1], 0x20 ) );
+            _mm256_storeu_ps( ptr + 8,  _mm256_permute2f128_ps( r[2], r[0], 0x30 ) );
+            _mm256_storeu_ps( ptr + 16, _mm256_permute2f128_ps( r[1], r[2], 0x31 ) );
+        }
+        else
+        {
+            auto r = impl::Transpose4Lanes( a[0].native, a[1].native, a[2].native, a[3].native );
+
+            _mm256_storeu_ps( ptr,      _mm256_permute2f128_ps( r[0], r[1], 0x20 ) );
+            _mm256_storeu_ps( ptr + 8,  _mm256_permute2f128_ps( r[2], r[3], 0x20 ) );
+            _mm256_storeu_ps( ptr + 16, _mm256_permute2f128_ps( r[0], r[1], 0x31 ) );
+            _mm256_storeu_ps( ptr + 24, _mm256_permute2f128_ps( r[2], r[3], 0x31 ) );
+        }
+    }
+
+
+    template<std::size_t... I, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>>
+    FS_FORCEINLINE f32<8, SIMD> Shuffle( const f32<8, SIMD>& a, std::index_sequence<I...> )
+    {
+        constexpr std::size_t idx[] = { I... };
+
+        if constexpr( impl::IsLaneRepeatedShuffle<4, I...>() )
+        {
+            return _mm256_permute_ps( a.native, _MM_SHUFFLE( idx[3], idx[2], idx[1], idx[0] ) );
+        }
+        else
+        {
+            return Permute( a, Constant<std::int32_t, SIMD>( static_cast<std::int32_t>( I )... ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>>
+    FS_FORCEINLINE f32<8, SIMD> Permute( const f32<8, SIMD>& a, const i32<8, SIMD>& idx )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX2 )
+        {
+            return _mm256_permutevar8x32_ps( a.native, idx.native );
+        }
+        else
+        {
+            /* permute within lanes using both the low and high lane as the source, bit 2 of each index picks the result */
+            __m256i idx256 = _mm256_setr_m128i( idx.v0.native, idx.v1.native );
+            __m256 fromLow = _mm256_permutevar_ps( _mm256_permute2f128_ps( a.native, a.native, 0x00 ), idx256 );
+            __m256 fromHigh = _mm256_permutevar_ps( _mm256_permute2f128_ps( a.native, a.native, 0x11 ), idx256 );
+            __m256 highBit = _mm256_castsi256_ps( _mm256_setr_m128i( _mm_slli_epi32( idx.v0.native, 29 ), _mm_slli_epi32( idx.v1.native, 29 ) ) );
+
+            return _mm256_blendv_ps( fromLow, fromHigh, highBit );
+        }
+    }
+
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_VL>>
+    FS_FORCEINLINE f32<8, SIMD> Permute2( const f32<8, SIMD>& a, const f32<8, SIMD>& b, const i32<8, SIMD>& idx )
+    {
+        return _mm256_permutex2var_ps( a.native, idx.native, b.native );
+    }
+#endif
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>>
+    FS_FORCEINLINE f32<8, SIMD> PrefixSum( const f32<8, SIMD>& a )
+    {
+        /* scan within each 128 bit lane, then carry the low lane total into the high lane */
+        const __m256 zero = _mm256_setzero_ps();
+        __m256 sum = _mm256_add_ps( a.native, _mm256_blend_ps( _mm256_permute_ps( a.native, _MM_SHUFFLE( 2, 1, 0, 0 ) ), zero, 0x11 ) );
+        sum = _mm256_add_ps( sum, _mm256_blend_ps( _mm256_permute_ps( sum, _MM_SHUFFLE( 1, 0, 0, 0 ) ), zero, 0x33 ) );
+
+        __m256 carry = _mm256_permute_ps( _mm256_permute2f128_ps( sum, sum, 0x08 ), _MM_SHUFFLE( 3, 3, 3, 3 ) );
+        return _mm256_add_ps( sum, carry );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>>
+    FS_FORCEINLINE f32<8, SIMD> Compress( const typename f32<8, SIMD>::MaskTypeArg& mask, const f32<8, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ ) )
+        {
+            return _mm256_maskz_compress_ps( _mm256_movepi32_mask( _mm256_castps_si256( mask.native ) ), a.native );
+        }
+        else
+#endif
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX2 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX2 )
+        {
+            int bits = _mm256_movemask_ps( mask.native );
+            __m256i idx = _mm256_srlv_epi32( _mm256_set1_epi32( (std::int32_t)impl::CompressNibbleTable8x32[bits] ), _mm256_setr_epi32( 0, 4, 8, 12, 16, 20, 24, 28 ) );
+            __m256i active = _mm256_cmpgt_epi32( _mm256_set1_epi32( impl::CountBits( bits ) ), _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) );
+            return _mm256_and_ps( _mm256_castsi256_ps( active ), _mm256_permutevar8x32_ps( a.native, idx ) );
+        }
+        else
+#endif
+        {
+            return impl::CompressElements( mask, a );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>>
+    FS_FORCEINLINE f32<8, SIMD> Expand( const typename f32<8, SIMD>::MaskTypeArg& mask, const f32<8, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ ) )
+        {
+            return _mm256_maskz_expand_ps( _mm256_movepi32_mask( _mm256_castps_si256( mask.native ) ), a.native );
+        }
+        else
+#endif
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX2 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX2 )
+        {
+            int bits = _mm256_movemask_ps( mask.native );
+            __m256i idx = _mm256_srlv_epi32( _mm256_set1_epi32( (std::int32_t)impl::ExpandNibbleTable8x32[bits] ), _mm256_setr_epi32( 0, 4, 8, 12, 16, 20, 24, 28 ) );
+            return _mm256_and_ps( _mm256_castsi256_ps( _mm256_castps_si256( mask.native ) ), _mm256_permutevar8x32_ps( a.native, idx ) );
+        }
+        else
+#endif
+        {
+            return impl::ExpandElements( mask, a );
+        }
+    }
 }
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<double, 4, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX>>
+    {
+        static constexpr size_t ElementCount = 4;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m256d;
+        using ElementType = double;
+        using MaskType = m64<ElementCount, true, SIMD>;
+        using MaskTypeArg = m64<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( double v ) : native( _mm256_set1_pd( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm256_add_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm256_sub_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = _mm256_mul_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator /=( const Register& rhs )
+        {
+            native = _mm256_div_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm256_and_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm256_or_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm256_xor_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator~() const
+        {
+            const __m256i neg1 = _mm256_set1_epi32( -1 );
+            return _mm256_xor_pd( native, _mm256_castsi256_pd( neg1 ) );
+        }
+
+        FS_FORCEINLINE Register operator-() const
+        {
+            return _mm256_xor_pd( native, _mm256_set1_pd( -0.0 ) );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm256_cmp_pd( native, rhs.native, _CMP_EQ_OQ );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return _mm256_cmp_pd( native, rhs.native, _CMP_NEQ_OQ );
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return _mm256_cmp_pd( native, rhs.native, _CMP_GE_OQ );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return _mm256_cmp_pd( native, rhs.native, _CMP_LE_OQ );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm256_cmp_pd( native, rhs.native, _CMP_GT_OQ );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm256_cmp_pd( native, rhs.native, _CMP_LT_OQ );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Load( TypeWrapper<const double*, 4, SIMD> ptr )
+    {
+        return _mm256_loadu_pd( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE void Store( typename f64<4, SIMD>::ElementType* ptr, const f64<4, SIMD>& a )
+    {
+        _mm256_storeu_pd( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE double Extract0( const f64<4, SIMD>& a )
+    {
+        return _mm256_cvtsd_f64( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Abs( const f64<4, SIMD>& a )
+    {
+        return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Round( const f64<4, SIMD>& a )
+    {
+        return _mm256_round_pd( a.native, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Floor( const f64<4, SIMD>& a )
+    {
+        return _mm256_round_pd( a.native, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Ceil( const f64<4, SIMD>& a )
+    {
+        return _mm256_round_pd( a.native, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Trunc( const f64<4, SIMD>& a )
+    {
+        return _mm256_round_pd( a.native, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Min( const f64<4, SIMD>& a, const f64<4, SIMD>& b )
+    {
+        return _mm256_min_pd( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Max( const f64<4, SIMD>& a, const f64<4, SIMD>& b )
+    {
+        return _mm256_max_pd( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Select( const typename f64<4, SIMD>::MaskTypeArg& mask, const f64<4, SIMD>& ifTrue, const f64<4, SIMD>& ifFalse )
+    {
+        return _mm256_blendv_pd( ifFalse.native, ifTrue.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> BitwiseAndNot( const f64<4, SIMD>& a, const f64<4, SIMD>& b )
+    {
+        return _mm256_andnot_pd( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Masked( const typename f64<4, SIMD>::MaskTypeArg& mask, const f64<4, SIMD>& a )
+    {
+        return _mm256_and_pd( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> InvMasked( const typename f64<4, SIMD>::MaskTypeArg& mask, const f64<4, SIMD>& a )
+    {
+        return _mm256_andnot_pd( mask.native, a.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Sqrt( const f64<4, SIMD>& a )
+    {
+        return _mm256_sqrt_pd( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>, typename = EnableIfRelaxed<SIMD>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    FS_FORCEINLINE f64<4, SIMD> FMulAdd( const f64<4, SIMD>& a, const f64<4, SIMD>& b, const f64<4, SIMD>& c )
+    {
+        return _mm256_fmadd_pd( a.native, b.native, c.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>, typename = EnableIfRelaxed<SIMD>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    FS_FORCEINLINE f64<4, SIMD> FMulSub( const f64<4, SIMD>& a, const f64<4, SIMD>& b, const f64<4, SIMD>& c )
+    {
+        return _mm256_fmsub_pd( a.native, b.native, c.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>, typename = EnableIfRelaxed<SIMD>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    FS_FORCEINLINE f64<4, SIMD> FNMulAdd( const f64<4, SIMD>& a, const f64<4, SIMD>& b, const f64<4, SIMD>& c )
+    {
+        return _mm256_fnmadd_pd( a.native, b.native, c.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>, typename = EnableIfRelaxed<SIMD>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    FS_FORCEINLINE f64<4, SIMD> FNMulSub( const f64<4, SIMD>& a, const f64<4, SIMD>& b, const f64<4, SIMD>& c )
+    {
+        return _mm256_fnmsub_pd( a.native, b.native, c.native );
+    }
+}
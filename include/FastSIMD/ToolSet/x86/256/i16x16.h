@@ -0,0 +1,212 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int16_t, 16, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    {
+        static constexpr size_t ElementCount = 16;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m256i;
+        using ElementType = std::int16_t;
+        using MaskType = m16<ElementCount, false, SIMD>;
+        using MaskTypeArg = m16<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int16_t v ) : native( _mm256_set1_epi16( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm256_add_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm256_sub_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = _mm256_mullo_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm256_and_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm256_or_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm256_xor_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = _mm256_srai_epi16( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm256_slli_epi16( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m256i neg1 = _mm256_set1_epi32( -1 );
+            return _mm256_xor_si256( native, neg1 );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm256_sub_epi16( _mm256_setzero_si256(), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm256_cmpeq_epi16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return ~(*this < rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return ~(*this > rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm256_cmpgt_epi16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm256_cmpgt_epi16( rhs.native, native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> Load( TypeWrapper<const std::int16_t*, 16, SIMD> ptr )
+    {
+        return _mm256_loadu_si256( (const __m256i*)ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE void Store( typename i16<16, SIMD>::ElementType* ptr, const i16<16, SIMD>& a )
+    {
+        _mm256_storeu_si256( (__m256i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE std::int16_t Extract0( const i16<16, SIMD>& a )
+    {
+        return static_cast<std::int16_t>( _mm_cvtsi128_si32( _mm256_castsi256_si128( a.native ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> Abs( const i16<16, SIMD>& a )
+    {
+        return _mm256_abs_epi16( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> Min( const i16<16, SIMD>& a, const i16<16, SIMD>& b )
+    {
+        return _mm256_min_epi16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> Max( const i16<16, SIMD>& a, const i16<16, SIMD>& b )
+    {
+        return _mm256_max_epi16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> Select( const typename i16<16, SIMD>::MaskTypeArg& mask, const i16<16, SIMD>& ifTrue, const i16<16, SIMD>& ifFalse )
+    {
+        return _mm256_blendv_epi8( ifFalse.native, ifTrue.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> BitwiseAndNot( const i16<16, SIMD>& a, const i16<16, SIMD>& b )
+    {
+        return _mm256_andnot_si256( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> BitShiftRightZeroExtend( const i16<16, SIMD>& a, int b )
+    {
+        return _mm256_srli_epi16( a.native, b );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> Masked( const typename i16<16, SIMD>::MaskTypeArg& mask, const i16<16, SIMD>& a )
+    {
+        return _mm256_and_si256( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> InvMasked( const typename i16<16, SIMD>::MaskTypeArg& mask, const i16<16, SIMD>& a )
+    {
+        return _mm256_andnot_si256( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> MaskedIncrement( const typename i16<16, SIMD>::MaskTypeArg& mask, const i16<16, SIMD>& a )
+    {
+        return _mm256_sub_epi16( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> MaskedDecrement( const typename i16<16, SIMD>::MaskTypeArg& mask, const i16<16, SIMD>& a )
+    {
+        return _mm256_add_epi16( a.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> AddSat( const i16<16, SIMD>& a, const i16<16, SIMD>& b )
+    {
+        return _mm256_adds_epi16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> SubSat( const i16<16, SIMD>& a, const i16<16, SIMD>& b )
+    {
+        return _mm256_subs_epi16( a.native, b.native );
+    }
+}
@@ -72,6 +72,18 @@ namespace FS
             return *this;
         }
 
+        FS_FORCEINLINE Register& operator >>=( const Register& rhs )
+        {
+            native = _mm256_srav_epi32( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( const Register& rhs )
+        {
+            native = _mm256_sllv_epi32( native, rhs.native );
+            return *this;
+        }
+
         FS_FORCEINLINE Register operator ~() const
         {
             const __m256i neg1 = _mm256_set1_epi32( -1 );
@@ -202,4 +214,200 @@ namespace FS
     {
         return _mm256_add_epi32( a.native, _mm256_castps_si256( mask.native ) );    
     }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Gather( const std::int32_t* base, const i32<8, SIMD>& idx )
+    {
+        return _mm256_i32gather_epi32( base, idx.native, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> MaskedGather( const typename i32<8, SIMD>::MaskTypeArg& mask, const std::int32_t* base, const i32<8, SIMD>& idx )
+    {
+        return _mm256_mask_i32gather_epi32( _mm256_setzero_si256(), base, idx.native, _mm256_castps_si256( mask.native ), 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_VL>>
+    FS_FORCEINLINE void Scatter( std::int32_t* base, const i32<8, SIMD>& idx, const i32<8, SIMD>& a )
+    {
+        _mm256_i32scatter_epi32( base, idx.native, a.native, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>, typename = std::enable_if_t<( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ )>>
+    FS_FORCEINLINE void MaskedScatter( const typename i32<8, SIMD>::MaskTypeArg& mask, std::int32_t* base, const i32<8, SIMD>& idx, const i32<8, SIMD>& a )
+    {
+        _mm256_mask_i32scatter_epi32( base, _mm256_movepi32_mask( _mm256_castps_si256( mask.native ) ), idx.native, a.native, 4 );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> LoadPartial( TypeWrapper<const std::int32_t*, 8, SIMD> ptr, std::size_t count )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm256_maskz_loadu_epi32( (__mmask8)( ( 1u << ( count < 8 ? count : 8 ) ) - 1 ), ptr.value );
+        }
+        else
+        {
+            __m256i active = _mm256_cmpgt_epi32( _mm256_set1_epi32( (std::int32_t)( count < 8 ? count : 8 ) ), _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) );
+            return _mm256_maskload_epi32( ptr.value, active );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE void StorePartial( typename i32<8, SIMD>::ElementType* ptr, const i32<8, SIMD>& a, std::size_t count )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            _mm256_mask_storeu_epi32( ptr, (__mmask8)( ( 1u << ( count < 8 ? count : 8 ) ) - 1 ), a.native );
+        }
+        else
+        {
+            __m256i active = _mm256_cmpgt_epi32( _mm256_set1_epi32( (std::int32_t)( count < 8 ? count : 8 ) ), _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) );
+            _mm256_maskstore_epi32( ptr, active, a.native );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> MaskedLoad( const typename i32<8, SIMD>::MaskTypeArg& mask, TypeWrapper<const std::int32_t*, 8, SIMD> ptr )
+    {
+        return _mm256_maskload_epi32( ptr.value, _mm256_castps_si256( mask.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE void MaskedStore( const typename i32<8, SIMD>::MaskTypeArg& mask, typename i32<8, SIMD>::ElementType* ptr, const i32<8, SIMD>& a )
+    {
+        _mm256_maskstore_epi32( ptr, _mm256_castps_si256( mask.native ), a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> PrefixSum( const i32<8, SIMD>& a )
+    {
+        /* scan within each 128 bit lane, then carry the low lane total into the high lane */
+        __m256i sum = _mm256_add_epi32( a.native, _mm256_slli_si256( a.native, 4 ) );
+        sum = _mm256_add_epi32( sum, _mm256_slli_si256( sum, 8 ) );
+
+        __m256i carry = _mm256_shuffle_epi32( _mm256_permute2x128_si256( sum, sum, 0x08 ), _MM_SHUFFLE( 3, 3, 3, 3 ) );
+        return _mm256_add_epi32( sum, carry );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> MulHi( const i32<8, SIMD>& a, const i32<8, SIMD>& b )
+    {
+        __m256i mul20 = _mm256_mul_epi32( a.native, b.native ); /* mul even */
+        __m256i mul31 = _mm256_mul_epi32( _mm256_srli_epi64( a.native, 32 ), _mm256_srli_epi64( b.native, 32 ) ); /* mul odd */
+        return _mm256_blend_epi32( _mm256_srli_epi64( mul20, 32 ), mul31, 0xAA );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> MulWidenEven( const i32<8, SIMD>& a, const i32<8, SIMD>& b )
+    {
+        return _mm256_mul_epi32( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> MulWidenOdd( const i32<8, SIMD>& a, const i32<8, SIMD>& b )
+    {
+        return _mm256_mul_epi32( _mm256_srli_epi64( a.native, 32 ), _mm256_srli_epi64( b.native, 32 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> PopCount( const i32<8, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 ) && defined( __AVX512VPOPCNTDQ__ )
+        if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_VPOPCNTDQ ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) )
+        {
+            return _mm256_popcnt_epi32( a.native );
+        }
+        else
+#endif
+        {
+            /* bit count of each nibble from a lookup table, then sum the 4 bytes of each element */
+            const __m256i lut = _mm256_setr_epi8( 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 );
+            const __m256i lowNibble = _mm256_set1_epi8( 0x0F );
+
+            __m256i count = _mm256_add_epi8( _mm256_shuffle_epi8( lut, _mm256_and_si256( a.native, lowNibble ) ), _mm256_shuffle_epi8( lut, _mm256_and_si256( _mm256_srli_epi16( a.native, 4 ), lowNibble ) ) );
+            return _mm256_madd_epi16( _mm256_maddubs_epi16( count, _mm256_set1_epi8( 1 ) ), _mm256_set1_epi16( 1 ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> CountLeadingZeros( const i32<8, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_CD ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) )
+        {
+            return _mm256_lzcnt_epi32( a.native );
+        }
+        else
+#endif
+        {
+            return impl::CountLeadingZerosFloat( a );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> RotateLeft( const i32<8, SIMD>& a, int b )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm256_rolv_epi32( a.native, _mm256_set1_epi32( b ) );
+        }
+        else
+#endif
+        {
+            return impl::RotateLeftShift( a, b );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Compress( const typename i32<8, SIMD>::MaskTypeArg& mask, const i32<8, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ ) )
+        {
+            return _mm256_maskz_compress_epi32( _mm256_movepi32_mask( _mm256_castps_si256( mask.native ) ), a.native );
+        }
+        else
+#endif
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX2 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX2 )
+        {
+            int bits = _mm256_movemask_ps( mask.native );
+            __m256i idx = _mm256_srlv_epi32( _mm256_set1_epi32( (std::int32_t)impl::CompressNibbleTable8x32[bits] ), _mm256_setr_epi32( 0, 4, 8, 12, 16, 20, 24, 28 ) );
+            __m256i active = _mm256_cmpgt_epi32( _mm256_set1_epi32( impl::CountBits( bits ) ), _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) );
+            return _mm256_and_si256( active, _mm256_permutevar8x32_epi32( a.native, idx ) );
+        }
+        else
+#endif
+        {
+            return impl::CompressElements( mask, a );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Expand( const typename i32<8, SIMD>::MaskTypeArg& mask, const i32<8, SIMD>& a )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ ) )
+        {
+            return _mm256_maskz_expand_epi32( _mm256_movepi32_mask( _mm256_castps_si256( mask.native ) ), a.native );
+        }
+        else
+#endif
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX2 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX2 )
+        {
+            int bits = _mm256_movemask_ps( mask.native );
+            __m256i idx = _mm256_srlv_epi32( _mm256_set1_epi32( (std::int32_t)impl::ExpandNibbleTable8x32[bits] ), _mm256_setr_epi32( 0, 4, 8, 12, 16, 20, 24, 28 ) );
+            return _mm256_and_si256( _mm256_castps_si256( mask.native ), _mm256_permutevar8x32_epi32( a.native, idx ) );
+        }
+        else
+#endif
+        {
+            return impl::ExpandElements( mask, a );
+        }
+    }
 }
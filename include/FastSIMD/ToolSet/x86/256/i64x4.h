@@ -0,0 +1,242 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int64_t, 4, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    {
+        static constexpr size_t ElementCount = 4;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m256i;
+        using ElementType = std::int64_t;
+        using MaskType = m64<ElementCount, false, SIMD>;
+        using MaskTypeArg = m64<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int64_t v ) : native( _mm256_set1_epi64x( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm256_add_epi64( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm256_sub_epi64( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            if constexpr( ( SIMD & FastSIMD::FeatureFlag::AVX512_DQ ) && ( SIMD & FastSIMD::FeatureFlag::AVX512_VL ) )
+            {
+                native = _mm256_mullo_epi64( native, rhs.native );
+            }
+            else
+            {
+                __m256i lolo = _mm256_mul_epu32( native, rhs.native ); /* lo * lo, full 64 bit */
+                __m256i lohi = _mm256_mul_epu32( native, _mm256_srli_epi64( rhs.native, 32 ) ); /* lo * hi */
+                __m256i hilo = _mm256_mul_epu32( _mm256_srli_epi64( native, 32 ), rhs.native ); /* hi * lo */
+                native = _mm256_add_epi64( lolo, _mm256_slli_epi64( _mm256_add_epi64( lohi, hilo ), 32 ) );
+            }
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm256_and_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm256_or_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm256_xor_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+            {
+                native = _mm256_srai_epi64( native, rhs );
+            }
+            else
+            {
+                /* no 64 bit arithmetic shift, flip negative lanes around a logical shift */
+                __m256i signMask = _mm256_cmpgt_epi64( _mm256_setzero_si256(), native );
+                native = _mm256_xor_si256( _mm256_srli_epi64( _mm256_xor_si256( native, signMask ), rhs ), signMask );
+            }
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm256_slli_epi64( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m256i neg1 = _mm256_set1_epi32( -1 );
+            return _mm256_xor_si256( native, neg1 );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm256_sub_epi64( _mm256_setzero_si256(), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm256_cmpeq_epi64( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return ~(*this < rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return ~(*this > rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm256_cmpgt_epi64( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm256_cmpgt_epi64( rhs.native, native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> Load( TypeWrapper<const std::int64_t*, 4, SIMD> ptr )
+    {
+        return _mm256_loadu_si256( (const __m256i*)ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE void Store( typename i64<4, SIMD>::ElementType* ptr, const i64<4, SIMD>& a )
+    {
+        _mm256_storeu_si256( (__m256i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE std::int64_t Extract0( const i64<4, SIMD>& a )
+    {
+        std::int64_t value;
+        _mm_storel_epi64( (__m128i*)&value, _mm256_castsi256_si128( a.native ) );
+        return value;
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> Abs( const i64<4, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm256_abs_epi64( a.native );
+        }
+        else
+        {
+            __m256i signMask = _mm256_cmpgt_epi64( _mm256_setzero_si256(), a.native );
+            return _mm256_sub_epi64( _mm256_xor_si256( a.native, signMask ), signMask );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> Min( const i64<4, SIMD>& a, const i64<4, SIMD>& b )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm256_min_epi64( a.native, b.native );
+        }
+        else
+        {
+            return _mm256_blendv_epi8( a.native, b.native, _mm256_cmpgt_epi64( a.native, b.native ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> Max( const i64<4, SIMD>& a, const i64<4, SIMD>& b )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm256_max_epi64( a.native, b.native );
+        }
+        else
+        {
+            return _mm256_blendv_epi8( b.native, a.native, _mm256_cmpgt_epi64( a.native, b.native ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> Select( const typename i64<4, SIMD>::MaskTypeArg& mask, const i64<4, SIMD>& ifTrue, const i64<4, SIMD>& ifFalse )
+    {
+        return _mm256_blendv_epi8( ifFalse.native, ifTrue.native, _mm256_castpd_si256( mask.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> BitwiseAndNot( const i64<4, SIMD>& a, const i64<4, SIMD>& b )
+    {
+        return _mm256_andnot_si256( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> BitShiftRightZeroExtend( const i64<4, SIMD>& a, int b )
+    {
+        return _mm256_srli_epi64( a.native, b );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> Masked( const typename i64<4, SIMD>::MaskTypeArg& mask, const i64<4, SIMD>& a )
+    {
+        return _mm256_and_si256( _mm256_castpd_si256( mask.native ), a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> InvMasked( const typename i64<4, SIMD>::MaskTypeArg& mask, const i64<4, SIMD>& a )
+    {
+        return _mm256_andnot_si256( _mm256_castpd_si256( mask.native ), a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> MaskedIncrement( const typename i64<4, SIMD>::MaskTypeArg& mask, const i64<4, SIMD>& a )
+    {
+        return _mm256_sub_epi64( a.native, _mm256_castpd_si256( mask.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<4, SIMD>>>
+    FS_FORCEINLINE i64<4, SIMD> MaskedDecrement( const typename i64<4, SIMD>::MaskTypeArg& mask, const i64<4, SIMD>& a )
+    {
+        return _mm256_add_epi64( a.native, _mm256_castpd_si256( mask.native ) );
+    }
+}
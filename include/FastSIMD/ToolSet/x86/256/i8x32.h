@@ -0,0 +1,209 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int8_t, 32, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    {
+        static constexpr size_t ElementCount = 32;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m256i;
+        using ElementType = std::int8_t;
+        using MaskType = m8<ElementCount, false, SIMD>;
+        using MaskTypeArg = m8<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int8_t v ) : native( _mm256_set1_epi8( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm256_add_epi8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm256_sub_epi8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm256_and_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm256_or_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm256_xor_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            /* no 8 bit shifts, shift odd bytes in place and even bytes from the top of each 16 bit lane */
+            __m256i odd = _mm256_and_si256( _mm256_srai_epi16( native, rhs ), _mm256_set1_epi16( (std::int16_t)0xFF00 ) );
+            __m256i even = _mm256_srli_epi16( _mm256_srai_epi16( _mm256_slli_epi16( native, 8 ), rhs ), 8 );
+            native = _mm256_or_si256( odd, even );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm256_and_si256( _mm256_slli_epi16( native, rhs ), _mm256_set1_epi8( (std::int8_t)( 0xFF << rhs ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m256i neg1 = _mm256_set1_epi32( -1 );
+            return _mm256_xor_si256( native, neg1 );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm256_sub_epi8( _mm256_setzero_si256(), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm256_cmpeq_epi8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return ~(*this < rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return ~(*this > rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm256_cmpgt_epi8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm256_cmpgt_epi8( rhs.native, native );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> Load( TypeWrapper<const std::int8_t*, 32, SIMD> ptr )
+    {
+        return _mm256_loadu_si256( (const __m256i*)ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE void Store( typename i8<32, SIMD>::ElementType* ptr, const i8<32, SIMD>& a )
+    {
+        _mm256_storeu_si256( (__m256i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE std::int8_t Extract0( const i8<32, SIMD>& a )
+    {
+        return static_cast<std::int8_t>( _mm_cvtsi128_si32( _mm256_castsi256_si128( a.native ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> Abs( const i8<32, SIMD>& a )
+    {
+        return _mm256_abs_epi8( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> Min( const i8<32, SIMD>& a, const i8<32, SIMD>& b )
+    {
+        return _mm256_min_epi8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> Max( const i8<32, SIMD>& a, const i8<32, SIMD>& b )
+    {
+        return _mm256_max_epi8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> Select( const typename i8<32, SIMD>::MaskTypeArg& mask, const i8<32, SIMD>& ifTrue, const i8<32, SIMD>& ifFalse )
+    {
+        return _mm256_blendv_epi8( ifFalse.native, ifTrue.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> BitwiseAndNot( const i8<32, SIMD>& a, const i8<32, SIMD>& b )
+    {
+        return _mm256_andnot_si256( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> BitShiftRightZeroExtend( const i8<32, SIMD>& a, int b )
+    {
+        return _mm256_and_si256( _mm256_srli_epi16( a.native, b ), _mm256_set1_epi8( (std::int8_t)( 0xFF >> b ) ) );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> Masked( const typename i8<32, SIMD>::MaskTypeArg& mask, const i8<32, SIMD>& a )
+    {
+        return _mm256_and_si256( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> InvMasked( const typename i8<32, SIMD>::MaskTypeArg& mask, const i8<32, SIMD>& a )
+    {
+        return _mm256_andnot_si256( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> MaskedIncrement( const typename i8<32, SIMD>::MaskTypeArg& mask, const i8<32, SIMD>& a )
+    {
+        return _mm256_sub_epi8( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> MaskedDecrement( const typename i8<32, SIMD>::MaskTypeArg& mask, const i8<32, SIMD>& a )
+    {
+        return _mm256_add_epi8( a.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> AddSat( const i8<32, SIMD>& a, const i8<32, SIMD>& b )
+    {
+        return _mm256_adds_epi8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> SubSat( const i8<32, SIMD>& a, const i8<32, SIMD>& b )
+    {
+        return _mm256_subs_epi8( a.native, b.native );
+    }
+}
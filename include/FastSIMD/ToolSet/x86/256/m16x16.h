@@ -0,0 +1,78 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    namespace impl
+    {
+        struct AVXMaskBase16x16
+        {
+            __m256i native;
+        };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool OPTIMISE_FLOAT>
+    struct Register<Mask<16, OPTIMISE_FLOAT>, 16, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+        : std::conditional_t<OPTIMISE_FLOAT, impl::AVXMaskBase16x16, Register<Mask<16, true>, 16, SIMD>>
+    {
+        static constexpr size_t ElementCount = 16;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = decltype(AVXMaskBase16x16::native);
+        using ElementType = Mask<16, OPTIMISE_FLOAT>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) { this->native = v; }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return this->native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = _mm256_and_si256( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = _mm256_or_si256( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = _mm256_xor_si256( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m256i neg1 = _mm256_set1_epi32( -1 );
+            return _mm256_xor_si256( this->native, neg1 );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m16<16, B, SIMD>>>
+    FS_FORCEINLINE m16<16, B, SIMD> BitwiseAndNot( const m16<16, B, SIMD>& a, const m16<16, B, SIMD>& b )
+    {
+        return _mm256_andnot_si256( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m16<16, B, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const m16<16, B, SIMD>& a )
+    {
+        return _mm256_movemask_epi8( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m16<16, B, SIMD>>>
+    FS_FORCEINLINE BitStorage<16> BitMask( const m16<16, B, SIMD>& a )
+    {
+        // Saturating pack keeps each 16 bit lane's all/none state in a single byte
+        return static_cast<BitStorage<16>>( _mm_movemask_epi8( _mm_packs_epi16( _mm256_castsi256_si128( a.native ), _mm256_extracti128_si256( a.native, 1 ) ) ) );
+    }
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<Mask<64, true>, 4, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX>>
+    {
+        static constexpr size_t ElementCount = 4;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m256d;
+        using ElementType = Mask<64, true>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm256_and_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm256_or_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm256_xor_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m256i neg1 = _mm256_set1_epi32( -1 );
+            return _mm256_xor_pd( native, _mm256_castsi256_pd( neg1 ) );
+        }
+
+        NativeType native;
+    };
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<m64<4, true, SIMD>>>
+    FS_FORCEINLINE m64<4, true, SIMD> BitwiseAndNot( const m64<4, true, SIMD>& a, const m64<4, true, SIMD>& b )
+    {
+        return _mm256_andnot_pd( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<m64<4, true, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const m64<4, true, SIMD>& a )
+    {
+        return _mm256_movemask_pd( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m64<4, B, SIMD>>>
+    FS_FORCEINLINE BitStorage<4> BitMask( const m64<4, B, SIMD>& a )
+    {
+        return static_cast<BitStorage<4>>( _mm256_movemask_pd( a.native ) );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<Mask<64, false>, 4, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>> : Register<Mask<64, true>, 4, SIMD>
+    {
+        static constexpr size_t ElementCount = 4;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m256i;
+        using ElementType = Mask<64, false>;
+        using MaskType = Register;
+        using MaskTypeArg = Register<Mask<64, true>, 4, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : Register<Mask<64, true>, 4, SIMD>( _mm256_castsi256_pd( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return _mm256_castpd_si256( this->native );
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = _mm256_castsi256_pd( _mm256_and_si256( _mm256_castpd_si256( this->native ), _mm256_castpd_si256( rhs.native ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = _mm256_castsi256_pd( _mm256_or_si256( _mm256_castpd_si256( this->native ), _mm256_castpd_si256( rhs.native ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = _mm256_castsi256_pd( _mm256_xor_si256( _mm256_castpd_si256( this->native ), _mm256_castpd_si256( rhs.native ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m256i neg1 = _mm256_set1_epi32( -1 );
+            return _mm256_xor_si256( _mm256_castpd_si256( this->native ), neg1 );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<m64<4, false, SIMD>>>
+    FS_FORCEINLINE m64<4, false, SIMD> BitwiseAndNot( const m64<4, false, SIMD>& a, const m64<4, false, SIMD>& b )
+    {
+        return _mm256_andnot_si256( _mm256_castpd_si256( b.native ), _mm256_castpd_si256( a.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<m64<4, false, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const m64<4, false, SIMD>& a )
+    {
+        return _mm256_movemask_epi8( _mm256_castpd_si256( a.native ) );
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    namespace impl
+    {
+        struct AVXMaskBase8x32
+        {
+            __m256i native;
+        };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool OPTIMISE_FLOAT>
+    struct Register<Mask<8, OPTIMISE_FLOAT>, 32, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+        : std::conditional_t<OPTIMISE_FLOAT, impl::AVXMaskBase8x32, Register<Mask<8, true>, 32, SIMD>>
+    {
+        static constexpr size_t ElementCount = 32;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = decltype(AVXMaskBase8x32::native);
+        using ElementType = Mask<8, OPTIMISE_FLOAT>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) { this->native = v; }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return this->native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = _mm256_and_si256( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = _mm256_or_si256( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = _mm256_xor_si256( this->native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m256i neg1 = _mm256_set1_epi32( -1 );
+            return _mm256_xor_si256( this->native, neg1 );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m8<32, B, SIMD>>>
+    FS_FORCEINLINE m8<32, B, SIMD> BitwiseAndNot( const m8<32, B, SIMD>& a, const m8<32, B, SIMD>& b )
+    {
+        return _mm256_andnot_si256( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m8<32, B, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const m8<32, B, SIMD>& a )
+    {
+        return _mm256_movemask_epi8( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m8<32, B, SIMD>>>
+    FS_FORCEINLINE BitStorage<32> BitMask( const m8<32, B, SIMD>& a )
+    {
+        return static_cast<BitStorage<32>>( _mm256_movemask_epi8( a.native ) );
+    }
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::uint16_t, 16, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    {
+        static constexpr size_t ElementCount = 16;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m256i;
+        using ElementType = std::uint16_t;
+        using MaskType = m16<ElementCount, false, SIMD>;
+        using MaskTypeArg = m16<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::uint16_t v ) : native( _mm256_set1_epi16( (std::int16_t)v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm256_add_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm256_sub_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = _mm256_mullo_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm256_and_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm256_or_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm256_xor_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = _mm256_srli_epi16( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm256_slli_epi16( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m256i neg1 = _mm256_set1_epi32( -1 );
+            return _mm256_xor_si256( native, neg1 );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm256_sub_epi16( _mm256_setzero_si256(), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm256_cmpeq_epi16( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            /* unsigned saturating rhs - this is only zero when this >= rhs */
+            return _mm256_cmpeq_epi16( _mm256_subs_epu16( rhs.native, native ), _mm256_setzero_si256() );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return _mm256_cmpeq_epi16( _mm256_subs_epu16( native, rhs.native ), _mm256_setzero_si256() );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return ~(*this <= rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return ~(*this >= rhs);
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> Load( TypeWrapper<const std::uint16_t*, 16, SIMD> ptr )
+    {
+        return _mm256_loadu_si256( (const __m256i*)ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE void Store( typename u16<16, SIMD>::ElementType* ptr, const u16<16, SIMD>& a )
+    {
+        _mm256_storeu_si256( (__m256i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE std::uint16_t Extract0( const u16<16, SIMD>& a )
+    {
+        return static_cast<std::uint16_t>( _mm_cvtsi128_si32( _mm256_castsi256_si128( a.native ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> Min( const u16<16, SIMD>& a, const u16<16, SIMD>& b )
+    {
+        return _mm256_min_epu16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> Max( const u16<16, SIMD>& a, const u16<16, SIMD>& b )
+    {
+        return _mm256_max_epu16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> Select( const typename u16<16, SIMD>::MaskTypeArg& mask, const u16<16, SIMD>& ifTrue, const u16<16, SIMD>& ifFalse )
+    {
+        return _mm256_blendv_epi8( ifFalse.native, ifTrue.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> BitwiseAndNot( const u16<16, SIMD>& a, const u16<16, SIMD>& b )
+    {
+        return _mm256_andnot_si256( b.native, a.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> Masked( const typename u16<16, SIMD>::MaskTypeArg& mask, const u16<16, SIMD>& a )
+    {
+        return _mm256_and_si256( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> InvMasked( const typename u16<16, SIMD>::MaskTypeArg& mask, const u16<16, SIMD>& a )
+    {
+        return _mm256_andnot_si256( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> MaskedIncrement( const typename u16<16, SIMD>::MaskTypeArg& mask, const u16<16, SIMD>& a )
+    {
+        return _mm256_sub_epi16( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> MaskedDecrement( const typename u16<16, SIMD>::MaskTypeArg& mask, const u16<16, SIMD>& a )
+    {
+        return _mm256_add_epi16( a.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> AddSat( const u16<16, SIMD>& a, const u16<16, SIMD>& b )
+    {
+        return _mm256_adds_epu16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> SubSat( const u16<16, SIMD>& a, const u16<16, SIMD>& b )
+    {
+        return _mm256_subs_epu16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> Average( const u16<16, SIMD>& a, const u16<16, SIMD>& b )
+    {
+        return _mm256_avg_epu16( a.native, b.native );
+    }
+}
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::uint8_t, 32, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX2>>
+    {
+        static constexpr size_t ElementCount = 32;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m256i;
+        using ElementType = std::uint8_t;
+        using MaskType = m8<ElementCount, false, SIMD>;
+        using MaskTypeArg = m8<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::uint8_t v ) : native( _mm256_set1_epi8( (std::int8_t)v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm256_add_epi8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm256_sub_epi8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm256_and_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm256_or_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm256_xor_si256( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = _mm256_and_si256( _mm256_srli_epi16( native, rhs ), _mm256_set1_epi8( (std::int8_t)( 0xFF >> rhs ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm256_and_si256( _mm256_slli_epi16( native, rhs ), _mm256_set1_epi8( (std::int8_t)( 0xFF << rhs ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m256i neg1 = _mm256_set1_epi32( -1 );
+            return _mm256_xor_si256( native, neg1 );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm256_sub_epi8( _mm256_setzero_si256(), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm256_cmpeq_epi8( native, rhs.native );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return ~(*this == rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            /* unsigned saturating rhs - this is only zero when this >= rhs */
+            return _mm256_cmpeq_epi8( _mm256_subs_epu8( rhs.native, native ), _mm256_setzero_si256() );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return _mm256_cmpeq_epi8( _mm256_subs_epu8( native, rhs.native ), _mm256_setzero_si256() );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return ~(*this <= rhs);
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return ~(*this >= rhs);
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> Load( TypeWrapper<const std::uint8_t*, 32, SIMD> ptr )
+    {
+        return _mm256_loadu_si256( (const __m256i*)ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE void Store( typename u8<32, SIMD>::ElementType* ptr, const u8<32, SIMD>& a )
+    {
+        _mm256_storeu_si256( (__m256i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE std::uint8_t Extract0( const u8<32, SIMD>& a )
+    {
+        return static_cast<std::uint8_t>( _mm_cvtsi128_si32( _mm256_castsi256_si128( a.native ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> Min( const u8<32, SIMD>& a, const u8<32, SIMD>& b )
+    {
+        return _mm256_min_epu8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> Max( const u8<32, SIMD>& a, const u8<32, SIMD>& b )
+    {
+        return _mm256_max_epu8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> Select( const typename u8<32, SIMD>::MaskTypeArg& mask, const u8<32, SIMD>& ifTrue, const u8<32, SIMD>& ifFalse )
+    {
+        return _mm256_blendv_epi8( ifFalse.native, ifTrue.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> BitwiseAndNot( const u8<32, SIMD>& a, const u8<32, SIMD>& b )
+    {
+        return _mm256_andnot_si256( b.native, a.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> Masked( const typename u8<32, SIMD>::MaskTypeArg& mask, const u8<32, SIMD>& a )
+    {
+        return _mm256_and_si256( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> InvMasked( const typename u8<32, SIMD>::MaskTypeArg& mask, const u8<32, SIMD>& a )
+    {
+        return _mm256_andnot_si256( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> MaskedIncrement( const typename u8<32, SIMD>::MaskTypeArg& mask, const u8<32, SIMD>& a )
+    {
+        return _mm256_sub_epi8( a.native, mask.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> MaskedDecrement( const typename u8<32, SIMD>::MaskTypeArg& mask, const u8<32, SIMD>& a )
+    {
+        return _mm256_add_epi8( a.native, mask.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> AddSat( const u8<32, SIMD>& a, const u8<32, SIMD>& b )
+    {
+        return _mm256_adds_epu8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> SubSat( const u8<32, SIMD>& a, const u8<32, SIMD>& b )
+    {
+        return _mm256_subs_epu8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> Average( const u8<32, SIMD>& a, const u8<32, SIMD>& b )
+    {
+        return _mm256_avg_epu8( a.native, b.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> TableLookup( const u8<32, SIMD>& table, const u8<32, SIMD>& idx )
+    {
+        /* pshufb only looks up within 128 bit lanes, look up from both table halves and combine */
+        /* indices out of range for each half saturate into the top bit so pshufb returns 0 for them */
+        const __m256i outOfRange = _mm256_set1_epi8( 0x70 );
+        __m256i low = _mm256_permute2x128_si256( table.native, table.native, 0x00 );
+        __m256i high = _mm256_permute2x128_si256( table.native, table.native, 0x11 );
+
+        __m256i fromLow = _mm256_shuffle_epi8( low, _mm256_adds_epu8( idx.native, outOfRange ) );
+        __m256i fromHigh = _mm256_shuffle_epi8( high, _mm256_adds_epu8( _mm256_sub_epi8( idx.native, _mm256_set1_epi8( 16 ) ), outOfRange ) );
+
+        return _mm256_or_si256( fromLow, fromHigh );
+    }
+}
@@ -274,4 +274,267 @@ namespace FS
     {
         return _mm512_fnmsub_ps( a.native, b.native, c.native );
     }
-}
\ No newline at end of file
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> Gather( const float* base, const i32<16, SIMD>& idx )
+    {
+        return _mm512_i32gather_ps( idx.native, base, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> MaskedGather( const typename f32<16, SIMD>::MaskTypeArg& mask, const float* base, const i32<16, SIMD>& idx )
+    {
+        return _mm512_mask_i32gather_ps( _mm512_setzero_ps(), mask.native, idx.native, base, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE void Scatter( float* base, const i32<16, SIMD>& idx, const f32<16, SIMD>& a )
+    {
+        _mm512_i32scatter_ps( base, idx.native, a.native, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE void MaskedScatter( const typename f32<16, SIMD>::MaskTypeArg& mask, float* base, const i32<16, SIMD>& idx, const f32<16, SIMD>& a )
+    {
+        _mm512_mask_i32scatter_ps( base, mask.native, idx.native, a.native, 4 );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> LoadPartial( TypeWrapper<const float*, 16, SIMD> ptr, std::size_t count )
+    {
+        return _mm512_maskz_loadu_ps( (__mmask16)( ( 1u << ( count < 16 ? count : 16 ) ) - 1 ), ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE void StorePartial( typename f32<16, SIMD>::ElementType* ptr, const f32<16, SIMD>& a, std::size_t count )
+    {
+        _mm512_mask_storeu_ps( ptr, (__mmask16)( ( 1u << ( count < 16 ? count : 16 ) ) - 1 ), a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> MaskedLoad( const typename f32<16, SIMD>::MaskTypeArg& mask, TypeWrapper<const float*, 16, SIMD> ptr )
+    {
+        return _mm512_maskz_loadu_ps( mask.native, ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE void MaskedStore( const typename f32<16, SIMD>::MaskTypeArg& mask, typename f32<16, SIMD>::ElementType* ptr, const f32<16, SIMD>& a )
+    {
+        _mm512_mask_storeu_ps( ptr, mask.native, a.native );
+    }
+
+
+    namespace impl
+    {
+        // De-interleave 3 or 4 element structures within each 128 bit lane, lane ordering is handled by the caller
+        FS_FORCEINLINE std::array<__m512, 3> Deinterleave3Lanes( __m512 a, __m512 b, __m512 c )
+        {
+            __m512 x = _mm512_shuffle_ps( a, _mm512_shuffle_ps( b, c, _MM_SHUFFLE( 0, 1, 0, 2 ) ), _MM_SHUFFLE( 2, 0, 3, 0 ) );
+            __m512 y = _mm512_shuffle_ps( _mm512_shuffle_ps( a, b, _MM_SHUFFLE( 0, 0, 0, 1 ) ), _mm512_shuffle_ps( b, c, _MM_SHUFFLE( 0, 2, 0, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) );
+            __m512 z = _mm512_shuffle_ps( _mm512_shuffle_ps( a, b, _MM_SHUFFLE( 0, 1, 0, 2 ) ), c, _MM_SHUFFLE( 3, 0, 2, 0 ) );
+
+            return { x, y, z };
+        }
+
+        FS_FORCEINLINE std::array<__m512, 3> Interleave3Lanes( __m512 x, __m512 y, __m512 z )
+        {
+            return {
+                _mm512_shuffle_ps( _mm512_shuffle_ps( x, y, _MM_SHUFFLE( 0, 0, 0, 0 ) ), _mm512_shuffle_ps( z, x, _MM_SHUFFLE( 0, 1, 0, 0 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ),
+                _mm512_shuffle_ps( _mm512_shuffle_ps( y, z, _MM_SHUFFLE( 0, 1, 0, 1 ) ), _mm512_shuffle_ps( x, y, _MM_SHUFFLE( 0, 2, 0, 2 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ),
+                _mm512_shuffle_ps( _mm512_shuffle_ps( z, x, _MM_SHUFFLE( 0, 3, 0, 2 ) ), _mm512_shuffle_ps( y, z, _MM_SHUFFLE( 0, 3, 0, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) )
+            };
+        }
+
+        // 4x4 transpose within each 128 bit lane, also used with shuffle_f32x4 to transpose the lanes themselves
+        FS_FORCEINLINE std::array<__m512, 4> Transpose4Lanes( __m512 a, __m512 b, __m512 c, __m512 d )
+        {
+            __m512d t0 = _mm512_castps_pd( _mm512_unpacklo_ps( a, b ) );
+            __m512d t1 = _mm512_castps_pd( _mm512_unpacklo_ps( c, d ) );
+            __m512d t2 = _mm512_castps_pd( _mm512_unpackhi_ps( a, b ) );
+            __m512d t3 = _mm512_castps_pd( _mm512_unpackhi_ps( c, d ) );
+
+            return {
+                _mm512_castpd_ps( _mm512_unpacklo_pd( t0, t1 ) ),
+                _mm512_castpd_ps( _mm512_unpackhi_pd( t0, t1 ) ),
+                _mm512_castpd_ps( _mm512_unpacklo_pd( t2, t3 ) ),
+                _mm512_castpd_ps( _mm512_unpackhi_pd( t2, t3 ) )
+            };
+        }
+
+        // Transpose 128 bit lanes of 4 registers
+        FS_FORCEINLINE std::array<__m512, 4> TransposeLanes( __m512 a, __m512 b, __m512 c, __m512 d )
+        {
+            __m512 t0 = _mm512_shuffle_f32x4( a, b, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+            __m512 t1 = _mm512_shuffle_f32x4( a, b, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+            __m512 t2 = _mm512_shuffle_f32x4( c, d, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+            __m512 t3 = _mm512_shuffle_f32x4( c, d, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+
+            return {
+                _mm512_shuffle_f32x4( t0, t2, _MM_SHUFFLE( 2, 0, 2, 0 ) ),
+                _mm512_shuffle_f32x4( t0, t2, _MM_SHUFFLE( 3, 1, 3, 1 ) ),
+                _mm512_shuffle_f32x4( t1, t3, _MM_SHUFFLE( 2, 0, 2, 0 ) ),
+                _mm512_shuffle_f32x4( t1, t3, _MM_SHUFFLE( 3, 1, 3, 1 ) )
+            };
+        }
+    }
+
+    template<std::size_t C, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE std::array<f32<16, SIMD>, C> LoadInterleaved( TypeWrapper<const float*, 16, SIMD> ptr )
+    {
+        // Gather each group of 4 structures into one 128 bit lane, then de-interleave within lanes
+        if constexpr( C == 2 )
+        {
+            __m512 a = _mm512_loadu_ps( ptr.value );
+            __m512 b = _mm512_loadu_ps( ptr.value + 16 );
+            __m512 lo = _mm512_shuffle_f32x4( a, b, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+            __m512 hi = _mm512_shuffle_f32x4( a, b, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+
+            return { _mm512_shuffle_ps( lo, hi, _MM_SHUFFLE( 2, 0, 2, 0 ) ), _mm512_shuffle_ps( lo, hi, _MM_SHUFFLE( 3, 1, 3, 1 ) ) };
+        }
+        else if constexpr( C == 3 )
+        {
+            __m512 a = _mm512_loadu_ps( ptr.value );
+            __m512 b = _mm512_loadu_ps( ptr.value + 16 );
+            __m512 c = _mm512_loadu_ps( ptr.value + 32 );
+
+            /* Lane level version of the in lane de-interleave */
+            __m512 x = _mm512_shuffle_f32x4( a, _mm512_shuffle_f32x4( b, c, _MM_SHUFFLE( 0, 1, 0, 2 ) ), _MM_SHUFFLE( 2, 0, 3, 0 ) );
+            __m512 y = _mm512_shuffle_f32x4( _mm512_shuffle_f32x4( a, b, _MM_SHUFFLE( 0, 0, 0, 1 ) ), _mm512_shuffle_f32x4( b, c, _MM_SHUFFLE( 0, 2, 0, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) );
+            __m512 z = _mm512_shuffle_f32x4( _mm512_shuffle_f32x4( a, b, _MM_SHUFFLE( 0, 1, 0, 2 ) ), c, _MM_SHUFFLE( 3, 0, 2, 0 ) );
+
+            auto r = impl::Deinterleave3Lanes( x, y, z );
+
+            return { r[0], r[1], r[2] };
+        }
+        else
+        {
+            auto t = impl::TransposeLanes( _mm512_loadu_ps( ptr.value ), _mm512_loadu_ps( ptr.value + 16 ),
+                                           _mm512_loadu_ps( ptr.value + 32 ), _mm512_loadu_ps( ptr.value + 48 ) );
+
+            auto r = impl::Transpose4Lanes( t[0], t[1], t[2], t[3] );
+
+            return { r[0], r[1], r[2], r[3] };
+        }
+    }
+
+    template<std::size_t C, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE void StoreInterleaved( typename f32<16, SIMD>::ElementType* ptr, const std::array<f32<16, SIMD>, C>& a )
+    {
+        if constexpr( C == 2 )
+        {
+            __m512 lo = _mm512_unpacklo_ps( a[0].native, a[1].native );
+            __m512 hi = _mm512_unpackhi_ps( a[0].native, a[1].native );
+            __m512 t0 = _mm512_shuffle_f32x4( lo, hi, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+            __m512 t1 = _mm512_shuffle_f32x4( lo, hi, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+
+            _mm512_storeu_ps( ptr, _mm512_shuffle_f32x4( t0, t0, _MM_SHUFFLE( 3, 1, 2, 0 ) ) );
+            _mm512_storeu_ps( ptr + 16, _mm512_shuffle_f32x4( t1, t1, _MM_SHUFFLE( 3, 1, 2, 0 ) ) );
+        }
+        else if constexpr( C == 3 )
+        {
+            auto r = impl::Interleave3Lanes( a[0].native, a[1].native, a[2].native );
+
+            /* Lane level version of the in lane interleave */
+            __m512 x = r[0], y = r[1], z = r[2];
+
+            _mm512_storeu_ps( ptr,      _mm512_shuffle_f32x4( _mm512_shuffle_f32x4( x, y, _MM_SHUFFLE( 0, 0, 0, 0 ) ), _mm512_shuffle_f32x4( z, x, _MM_SHUFFLE( 0, 1, 0, 0 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+            _mm512_storeu_ps( ptr + 16, _mm512_shuffle_f32x4( _mm512_shuffle_f32x4( y, z, _MM_SHUFFLE( 0, 1, 0, 1 ) ), _mm512_shuffle_f32x4( x, y, _MM_SHUFFLE( 0, 2, 0, 2 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+            _mm512_storeu_ps( ptr + 32, _mm512_shuffle_f32x4( _mm512_shuffle_f32x4( z, x, _MM_SHUFFLE( 0, 3, 0, 2 ) ), _mm512_shuffle_f32x4( y, z, _MM_SHUFFLE( 0, 3, 0, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+        }
+        else
+        {
+            auto r = impl::Transpose4Lanes( a[0].native, a[1].native, a[2].native, a[3].native );
+            auto t = impl::TransposeLanes( r[0], r[1], r[2], r[3] );
+
+            _mm512_storeu_ps( ptr,      t[0] );
+            _mm512_storeu_ps( ptr + 16, t[1] );
+            _mm512_storeu_ps( ptr + 32, t[2] );
+            _mm512_storeu_ps( ptr + 48, t[3] );
+        }
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE float ReduceAdd( const f32<16, SIMD>& a )
+    {
+        return _mm512_reduce_add_ps( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE float ReduceMin( const f32<16, SIMD>& a )
+    {
+        return _mm512_reduce_min_ps( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE float ReduceMax( const f32<16, SIMD>& a )
+    {
+        return _mm512_reduce_max_ps( a.native );
+    }
+
+
+    template<std::size_t... I, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> Shuffle( const f32<16, SIMD>& a, std::index_sequence<I...> )
+    {
+        constexpr std::size_t idx[] = { I... };
+
+        if constexpr( impl::IsLaneRepeatedShuffle<4, I...>() )
+        {
+            return _mm512_permute_ps( a.native, _MM_SHUFFLE( idx[3], idx[2], idx[1], idx[0] ) );
+        }
+        else
+        {
+            return Permute( a, Constant<std::int32_t, SIMD>( static_cast<std::int32_t>( I )... ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> Permute( const f32<16, SIMD>& a, const i32<16, SIMD>& idx )
+    {
+        return _mm512_permutexvar_ps( idx.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> Permute2( const f32<16, SIMD>& a, const f32<16, SIMD>& b, const i32<16, SIMD>& idx )
+    {
+        return _mm512_permutex2var_ps( a.native, idx.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> PrefixSum( const f32<16, SIMD>& a )
+    {
+        /* alignr with zero shifts elements up, filling with 0 */
+        const __m512i zero = _mm512_setzero_si512();
+        __m512 sum = _mm512_add_ps( a.native, _mm512_castsi512_ps( _mm512_alignr_epi32( _mm512_castps_si512( a.native ), zero, 15 ) ) );
+        sum = _mm512_add_ps( sum, _mm512_castsi512_ps( _mm512_alignr_epi32( _mm512_castps_si512( sum ), zero, 14 ) ) );
+        sum = _mm512_add_ps( sum, _mm512_castsi512_ps( _mm512_alignr_epi32( _mm512_castps_si512( sum ), zero, 12 ) ) );
+        return _mm512_add_ps( sum, _mm512_castsi512_ps( _mm512_alignr_epi32( _mm512_castps_si512( sum ), zero, 8 ) ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> Compress( const typename f32<16, SIMD>::MaskTypeArg& mask, const f32<16, SIMD>& a )
+    {
+        return _mm512_maskz_compress_ps( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> Expand( const typename f32<16, SIMD>::MaskTypeArg& mask, const f32<16, SIMD>& a )
+    {
+        return _mm512_maskz_expand_ps( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE std::size_t CompressStore( const typename f32<16, SIMD>::MaskTypeArg& mask, typename f32<16, SIMD>::ElementType* ptr, const f32<16, SIMD>& a )
+    {
+        _mm512_mask_compressstoreu_ps( ptr, mask.native, a.native );
+        return static_cast<std::size_t>( CountTrue( mask ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> ExpandLoad( const typename f32<16, SIMD>::MaskTypeArg& mask, TypeWrapper<const float*, 16, SIMD> ptr )
+    {
+        return _mm512_maskz_expandloadu_ps( mask.native, ptr.value );
+    }
+}
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<double, 8, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_F>>
+    {
+        static constexpr size_t ElementCount = 8;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m512d;
+        using ElementType = double;
+        using MaskType = m64<ElementCount, true, SIMD>;
+        using MaskTypeArg = m64<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( double v ) : native( _mm512_set1_pd( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm512_add_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm512_sub_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = _mm512_mul_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator /=( const Register& rhs )
+        {
+            native = _mm512_div_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm512_and_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm512_or_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm512_xor_pd( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator~() const
+        {
+            const __m512i neg1 = _mm512_set1_epi32( -1 );
+            return _mm512_xor_pd( native, _mm512_castsi512_pd( neg1 ) );
+        }
+
+        FS_FORCEINLINE Register operator-() const
+        {
+            return _mm512_xor_pd( native, _mm512_set1_pd( -0.0 ) );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm512_cmp_pd_mask( native, rhs.native, _CMP_EQ_OQ );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return _mm512_cmp_pd_mask( native, rhs.native, _CMP_NEQ_OQ );
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return _mm512_cmp_pd_mask( native, rhs.native, _CMP_GE_OQ );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return _mm512_cmp_pd_mask( native, rhs.native, _CMP_LE_OQ );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm512_cmp_pd_mask( native, rhs.native, _CMP_GT_OQ );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm512_cmp_pd_mask( native, rhs.native, _CMP_LT_OQ );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Load( TypeWrapper<const double*, 8, SIMD> ptr )
+    {
+        return _mm512_loadu_pd( ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE void Store( typename f64<8, SIMD>::ElementType* ptr, const f64<8, SIMD>& a )
+    {
+        _mm512_storeu_pd( ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE double Extract0( const f64<8, SIMD>& a )
+    {
+        return _mm512_cvtsd_f64( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Abs( const f64<8, SIMD>& a )
+    {
+        return _mm512_abs_pd( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Round( const f64<8, SIMD>& a )
+    {
+        return _mm512_roundscale_pd( a.native, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Floor( const f64<8, SIMD>& a )
+    {
+        return _mm512_roundscale_pd( a.native, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Ceil( const f64<8, SIMD>& a )
+    {
+        return _mm512_roundscale_pd( a.native, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Trunc( const f64<8, SIMD>& a )
+    {
+        return _mm512_roundscale_pd( a.native, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Min( const f64<8, SIMD>& a, const f64<8, SIMD>& b )
+    {
+        return _mm512_min_pd( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Max( const f64<8, SIMD>& a, const f64<8, SIMD>& b )
+    {
+        return _mm512_max_pd( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Select( const typename f64<8, SIMD>::MaskTypeArg& mask, const f64<8, SIMD>& ifTrue, const f64<8, SIMD>& ifFalse )
+    {
+        return _mm512_mask_blend_pd( mask.native, ifFalse.native, ifTrue.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> BitwiseAndNot( const f64<8, SIMD>& a, const f64<8, SIMD>& b )
+    {
+        return _mm512_andnot_pd( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Masked( const typename f64<8, SIMD>::MaskTypeArg& mask, const f64<8, SIMD>& a )
+    {
+        return _mm512_maskz_mov_pd( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> InvMasked( const typename f64<8, SIMD>::MaskTypeArg& mask, const f64<8, SIMD>& a )
+    {
+        return _mm512_maskz_mov_pd( ~mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> MaskedAdd( const typename f64<8, SIMD>::MaskTypeArg& mask, const f64<8, SIMD>& a, const f64<8, SIMD>& b )
+    {
+        return _mm512_mask_add_pd( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> MaskedSub( const typename f64<8, SIMD>::MaskTypeArg& mask, const f64<8, SIMD>& a, const f64<8, SIMD>& b )
+    {
+        return _mm512_mask_sub_pd( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> MaskedMul( const typename f64<8, SIMD>::MaskTypeArg& mask, const f64<8, SIMD>& a, const f64<8, SIMD>& b )
+    {
+        return _mm512_mask_mul_pd( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> InvMaskedAdd( const typename f64<8, SIMD>::MaskTypeArg& mask, const f64<8, SIMD>& a, const f64<8, SIMD>& b )
+    {
+        return _mm512_mask_add_pd( a.native, ~mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> InvMaskedSub( const typename f64<8, SIMD>::MaskTypeArg& mask, const f64<8, SIMD>& a, const f64<8, SIMD>& b )
+    {
+        return _mm512_mask_sub_pd( a.native, ~mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> InvMaskedMul( const typename f64<8, SIMD>::MaskTypeArg& mask, const f64<8, SIMD>& a, const f64<8, SIMD>& b )
+    {
+        return _mm512_mask_mul_pd( a.native, ~mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Sqrt( const f64<8, SIMD>& a )
+    {
+        return _mm512_sqrt_pd( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>, typename = EnableIfRelaxed<SIMD>()>
+    FS_FORCEINLINE f64<8, SIMD> FMulAdd( const f64<8, SIMD>& a, const f64<8, SIMD>& b, const f64<8, SIMD>& c )
+    {
+        return _mm512_fmadd_pd( a.native, b.native, c.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>, typename = EnableIfRelaxed<SIMD>()>
+    FS_FORCEINLINE f64<8, SIMD> FMulSub( const f64<8, SIMD>& a, const f64<8, SIMD>& b, const f64<8, SIMD>& c )
+    {
+        return _mm512_fmsub_pd( a.native, b.native, c.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>, typename = EnableIfRelaxed<SIMD>()>
+    FS_FORCEINLINE f64<8, SIMD> FNMulAdd( const f64<8, SIMD>& a, const f64<8, SIMD>& b, const f64<8, SIMD>& c )
+    {
+        return _mm512_fnmadd_pd( a.native, b.native, c.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>, typename = EnableIfRelaxed<SIMD>()>
+    FS_FORCEINLINE f64<8, SIMD> FNMulSub( const f64<8, SIMD>& a, const f64<8, SIMD>& b, const f64<8, SIMD>& c )
+    {
+        return _mm512_fnmsub_pd( a.native, b.native, c.native );
+    }
+}
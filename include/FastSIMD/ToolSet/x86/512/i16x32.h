@@ -0,0 +1,225 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int16_t, 32, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_BW>>
+    {
+        static constexpr size_t ElementCount = 32;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m512i;
+        using ElementType = std::int16_t;
+        using MaskType = m16<ElementCount, false, SIMD>;
+        using MaskTypeArg = m16<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int16_t v ) : native( _mm512_set1_epi16( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm512_add_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm512_sub_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = _mm512_mullo_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm512_and_si512( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm512_or_si512( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm512_xor_si512( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = _mm512_srai_epi16( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm512_slli_epi16( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m512i neg1 = _mm512_set1_epi32( -1 );
+            return _mm512_xor_si512( native, neg1 );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm512_sub_epi16( _mm512_setzero_si512(), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi16_mask( native, rhs.native, _MM_CMPINT_EQ );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi16_mask( native, rhs.native, _MM_CMPINT_NE );
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi16_mask( native, rhs.native, _MM_CMPINT_NLT );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi16_mask( native, rhs.native, _MM_CMPINT_LE );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi16_mask( native, rhs.native, _MM_CMPINT_NLE );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi16_mask( native, rhs.native, _MM_CMPINT_LT );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> Load( TypeWrapper<const std::int16_t*, 32, SIMD> ptr )
+    {
+        return _mm512_loadu_si512( (const __m512i*)ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE void Store( typename i16<32, SIMD>::ElementType* ptr, const i16<32, SIMD>& a )
+    {
+        _mm512_storeu_si512( (__m512i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE std::int16_t Extract0( const i16<32, SIMD>& a )
+    {
+        return static_cast<std::int16_t>( _mm512_cvtsi512_si32( a.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> Abs( const i16<32, SIMD>& a )
+    {
+        return _mm512_abs_epi16( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> Min( const i16<32, SIMD>& a, const i16<32, SIMD>& b )
+    {
+        return _mm512_min_epi16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> Max( const i16<32, SIMD>& a, const i16<32, SIMD>& b )
+    {
+        return _mm512_max_epi16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> Select( const typename i16<32, SIMD>::MaskTypeArg& mask, const i16<32, SIMD>& ifTrue, const i16<32, SIMD>& ifFalse )
+    {
+        return _mm512_mask_blend_epi16( mask.native, ifFalse.native, ifTrue.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> BitwiseAndNot( const i16<32, SIMD>& a, const i16<32, SIMD>& b )
+    {
+        return _mm512_andnot_si512( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> BitShiftRightZeroExtend( const i16<32, SIMD>& a, int b )
+    {
+        return _mm512_srli_epi16( a.native, b );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> Masked( const typename i16<32, SIMD>::MaskTypeArg& mask, const i16<32, SIMD>& a )
+    {
+        return _mm512_maskz_mov_epi16( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> InvMasked( const typename i16<32, SIMD>::MaskTypeArg& mask, const i16<32, SIMD>& a )
+    {
+        return _mm512_maskz_mov_epi16( ~mask.native, a.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> MaskedAdd( const typename i16<32, SIMD>::MaskTypeArg& mask, const i16<32, SIMD>& a, const i16<32, SIMD>& b )
+    {
+        return _mm512_mask_add_epi16( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> MaskedSub( const typename i16<32, SIMD>::MaskTypeArg& mask, const i16<32, SIMD>& a, const i16<32, SIMD>& b )
+    {
+        return _mm512_mask_sub_epi16( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> InvMaskedAdd( const typename i16<32, SIMD>::MaskTypeArg& mask, const i16<32, SIMD>& a, const i16<32, SIMD>& b )
+    {
+        return _mm512_mask_add_epi16( a.native, ~mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> InvMaskedSub( const typename i16<32, SIMD>::MaskTypeArg& mask, const i16<32, SIMD>& a, const i16<32, SIMD>& b )
+    {
+        return _mm512_mask_sub_epi16( a.native, ~mask.native, a.native, b.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> AddSat( const i16<32, SIMD>& a, const i16<32, SIMD>& b )
+    {
+        return _mm512_adds_epi16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> SubSat( const i16<32, SIMD>& a, const i16<32, SIMD>& b )
+    {
+        return _mm512_subs_epi16( a.native, b.native );
+    }
+}
@@ -72,6 +72,18 @@ namespace FS
             return *this;
         }
 
+        FS_FORCEINLINE Register& operator >>=( const Register& rhs )
+        {
+            native = _mm512_srav_epi32( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( const Register& rhs )
+        {
+            native = _mm512_sllv_epi32( native, rhs.native );
+            return *this;
+        }
+
         FS_FORCEINLINE Register operator ~() const
         {
             const __m512i neg1 = _mm512_set1_epi32( -1 );
@@ -221,4 +233,180 @@ namespace FS
     {
         return _mm512_mask_mullo_epi32( a.native, ~mask.native, a.native, b.native );
     }
-}
\ No newline at end of file
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> Gather( const std::int32_t* base, const i32<16, SIMD>& idx )
+    {
+        return _mm512_i32gather_epi32( idx.native, base, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> MaskedGather( const typename i32<16, SIMD>::MaskTypeArg& mask, const std::int32_t* base, const i32<16, SIMD>& idx )
+    {
+        return _mm512_mask_i32gather_epi32( _mm512_setzero_si512(), mask.native, idx.native, base, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE void Scatter( std::int32_t* base, const i32<16, SIMD>& idx, const i32<16, SIMD>& a )
+    {
+        _mm512_i32scatter_epi32( base, idx.native, a.native, 4 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE void MaskedScatter( const typename i32<16, SIMD>::MaskTypeArg& mask, std::int32_t* base, const i32<16, SIMD>& idx, const i32<16, SIMD>& a )
+    {
+        _mm512_mask_i32scatter_epi32( base, mask.native, idx.native, a.native, 4 );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> LoadPartial( TypeWrapper<const std::int32_t*, 16, SIMD> ptr, std::size_t count )
+    {
+        return _mm512_maskz_loadu_epi32( (__mmask16)( ( 1u << ( count < 16 ? count : 16 ) ) - 1 ), ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE void StorePartial( typename i32<16, SIMD>::ElementType* ptr, const i32<16, SIMD>& a, std::size_t count )
+    {
+        _mm512_mask_storeu_epi32( ptr, (__mmask16)( ( 1u << ( count < 16 ? count : 16 ) ) - 1 ), a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> MaskedLoad( const typename i32<16, SIMD>::MaskTypeArg& mask, TypeWrapper<const std::int32_t*, 16, SIMD> ptr )
+    {
+        return _mm512_maskz_loadu_epi32( mask.native, ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE void MaskedStore( const typename i32<16, SIMD>::MaskTypeArg& mask, typename i32<16, SIMD>::ElementType* ptr, const i32<16, SIMD>& a )
+    {
+        _mm512_mask_storeu_epi32( ptr, mask.native, a.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE std::int32_t ReduceAdd( const i32<16, SIMD>& a )
+    {
+        return _mm512_reduce_add_epi32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE std::int32_t ReduceMin( const i32<16, SIMD>& a )
+    {
+        return _mm512_reduce_min_epi32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE std::int32_t ReduceMax( const i32<16, SIMD>& a )
+    {
+        return _mm512_reduce_max_epi32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE std::int32_t ReduceAnd( const i32<16, SIMD>& a )
+    {
+        return _mm512_reduce_and_epi32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE std::int32_t ReduceOr( const i32<16, SIMD>& a )
+    {
+        return _mm512_reduce_or_epi32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> PrefixSum( const i32<16, SIMD>& a )
+    {
+        /* alignr with zero shifts elements up, filling with 0 */
+        const __m512i zero = _mm512_setzero_si512();
+        __m512i sum = _mm512_add_epi32( a.native, _mm512_alignr_epi32( a.native, zero, 15 ) );
+        sum = _mm512_add_epi32( sum, _mm512_alignr_epi32( sum, zero, 14 ) );
+        sum = _mm512_add_epi32( sum, _mm512_alignr_epi32( sum, zero, 12 ) );
+        return _mm512_add_epi32( sum, _mm512_alignr_epi32( sum, zero, 8 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> MulHi( const i32<16, SIMD>& a, const i32<16, SIMD>& b )
+    {
+        __m512i mul20 = _mm512_mul_epi32( a.native, b.native ); /* mul even */
+        __m512i mul31 = _mm512_mul_epi32( _mm512_srli_epi64( a.native, 32 ), _mm512_srli_epi64( b.native, 32 ) ); /* mul odd */
+        return _mm512_mask_blend_epi32( 0xAAAA, _mm512_srli_epi64( mul20, 32 ), mul31 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> MulWidenEven( const i32<16, SIMD>& a, const i32<16, SIMD>& b )
+    {
+        return _mm512_mul_epi32( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> MulWidenOdd( const i32<16, SIMD>& a, const i32<16, SIMD>& b )
+    {
+        return _mm512_mul_epi32( _mm512_srli_epi64( a.native, 32 ), _mm512_srli_epi64( b.native, 32 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> PopCount( const i32<16, SIMD>& a )
+    {
+#if defined( __AVX512VPOPCNTDQ__ )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VPOPCNTDQ )
+        {
+            return _mm512_popcnt_epi32( a.native );
+        }
+        else
+#endif
+        {
+            /* bit count of each nibble from a lookup table, then sum the 4 bytes of each element */
+            const __m512i lut = _mm512_broadcast_i32x4( _mm_setr_epi8( 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 ) );
+            const __m512i lowNibble = _mm512_set1_epi8( 0x0F );
+
+            __m512i count = _mm512_add_epi8( _mm512_shuffle_epi8( lut, _mm512_and_si512( a.native, lowNibble ) ), _mm512_shuffle_epi8( lut, _mm512_and_si512( _mm512_srli_epi16( a.native, 4 ), lowNibble ) ) );
+            return _mm512_madd_epi16( _mm512_maddubs_epi16( count, _mm512_set1_epi8( 1 ) ), _mm512_set1_epi16( 1 ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> CountLeadingZeros( const i32<16, SIMD>& a )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_CD )
+        {
+            return _mm512_lzcnt_epi32( a.native );
+        }
+        else
+        {
+            return impl::CountLeadingZerosFloat( a );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> RotateLeft( const i32<16, SIMD>& a, int b )
+    {
+        return _mm512_rolv_epi32( a.native, _mm512_set1_epi32( b ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> Compress( const typename i32<16, SIMD>::MaskTypeArg& mask, const i32<16, SIMD>& a )
+    {
+        return _mm512_maskz_compress_epi32( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> Expand( const typename i32<16, SIMD>::MaskTypeArg& mask, const i32<16, SIMD>& a )
+    {
+        return _mm512_maskz_expand_epi32( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE std::size_t CompressStore( const typename i32<16, SIMD>::MaskTypeArg& mask, typename i32<16, SIMD>::ElementType* ptr, const i32<16, SIMD>& a )
+    {
+        _mm512_mask_compressstoreu_epi32( ptr, mask.native, a.native );
+        return static_cast<std::size_t>( CountTrue( mask ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> ExpandLoad( const typename i32<16, SIMD>::MaskTypeArg& mask, TypeWrapper<const std::int32_t*, 16, SIMD> ptr )
+    {
+        return _mm512_maskz_expandloadu_epi32( mask.native, ptr.value );
+    }
+}
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int64_t, 8, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_F>>
+    {
+        static constexpr size_t ElementCount = 8;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m512i;
+        using ElementType = std::int64_t;
+        using MaskType = m64<ElementCount, false, SIMD>;
+        using MaskTypeArg = m64<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int64_t v ) : native( _mm512_set1_epi64( v ) ) { }
+        
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm512_add_epi64( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm512_sub_epi64( native, rhs.native );
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_DQ )
+            {
+                native = _mm512_mullo_epi64( native, rhs.native );
+            }
+            else
+            {
+                __m512i lolo = _mm512_mul_epu32( native, rhs.native ); /* lo * lo, full 64 bit */
+                __m512i lohi = _mm512_mul_epu32( native, _mm512_srli_epi64( rhs.native, 32 ) ); /* lo * hi */
+                __m512i hilo = _mm512_mul_epu32( _mm512_srli_epi64( native, 32 ), rhs.native ); /* hi * lo */
+                native = _mm512_add_epi64( lolo, _mm512_slli_epi64( _mm512_add_epi64( lohi, hilo ), 32 ) );
+            }
+            return *this;
+        }
+            
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm512_and_si512( native, rhs.native );
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm512_or_si512( native, rhs.native );
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm512_xor_si512( native, rhs.native );
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = _mm512_srai_epi64( native, rhs );
+            return *this;
+        }
+        
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm512_slli_epi64( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m512i neg1 = _mm512_set1_epi64( -1 );
+            return _mm512_xor_si512( native, neg1 );        
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm512_sub_epi64( _mm512_setzero_si512(), native );
+        }
+
+        
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi64_mask( native, rhs.native, _MM_CMPINT_EQ );
+        }
+        
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi64_mask( native, rhs.native, _MM_CMPINT_NE );
+        }
+        
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi64_mask( native, rhs.native, _MM_CMPINT_NLT );
+        }
+        
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi64_mask( native, rhs.native, _MM_CMPINT_LE );
+        }
+        
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi64_mask( native, rhs.native, _MM_CMPINT_NLE );
+        }
+        
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi64_mask( native, rhs.native, _MM_CMPINT_LT );
+        }
+
+        NativeType native;
+    };
+
+    
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> Load( TypeWrapper<const std::int64_t*, 8, SIMD> ptr )
+    {
+        return _mm512_loadu_si512( (const __m512i*)ptr.value );
+    }
+    
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE void Store( typename i64<8, SIMD>::ElementType* ptr, const i64<8, SIMD>& a )
+    {
+        _mm512_storeu_si512( (__m512i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE std::int64_t Extract0( const i64<8, SIMD>& a )
+    {
+        std::int64_t value;
+        _mm_storel_epi64( (__m128i*)&value, _mm512_castsi512_si128( a.native ) );
+        return value;
+    }
+        
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> Abs( const i64<8, SIMD>& a )
+    {
+        return _mm512_abs_epi64( a.native );
+    }
+        
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> Min( const i64<8, SIMD>& a, const i64<8, SIMD>& b )
+    {
+        return _mm512_min_epi64( a.native, b.native );
+    }
+        
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> Max( const i64<8, SIMD>& a, const i64<8, SIMD>& b )
+    {
+        return _mm512_max_epi64( a.native, b.native );
+    }
+        
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> Select( const typename i64<8, SIMD>::MaskTypeArg& mask, const i64<8, SIMD>& ifTrue, const i64<8, SIMD>& ifFalse )
+    {
+        return _mm512_mask_blend_epi64( mask.native, ifFalse.native, ifTrue.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> BitwiseAndNot( const i64<8, SIMD>& a, const i64<8, SIMD>& b )
+    {
+        return _mm512_andnot_si512( b.native, a.native );        
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> BitShiftRightZeroExtend( const i64<8, SIMD>& a, int b )
+    {
+        return _mm512_srli_epi64( a.native, b );        
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> Masked( const typename i64<8, SIMD>::MaskTypeArg& mask, const i64<8, SIMD>& a )
+    {
+        return _mm512_maskz_mov_epi64( mask.native, a.native );    
+    }
+        
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> InvMasked( const typename i64<8, SIMD>::MaskTypeArg& mask, const i64<8, SIMD>& a )
+    {
+        return _mm512_maskz_mov_epi64( ~mask.native, a.native );    
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> MaskedAdd( const typename i64<8, SIMD>::MaskTypeArg& mask, const i64<8, SIMD>& a, const i64<8, SIMD>& b )
+    {
+        return _mm512_mask_add_epi64( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> MaskedSub( const typename i64<8, SIMD>::MaskTypeArg& mask, const i64<8, SIMD>& a, const i64<8, SIMD>& b )
+    {
+        return _mm512_mask_sub_epi64( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_DQ>>
+    FS_FORCEINLINE i64<8, SIMD> MaskedMul( const typename i64<8, SIMD>::MaskTypeArg& mask, const i64<8, SIMD>& a, const i64<8, SIMD>& b )
+    {
+        return _mm512_mask_mullo_epi64( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> InvMaskedAdd( const typename i64<8, SIMD>::MaskTypeArg& mask, const i64<8, SIMD>& a, const i64<8, SIMD>& b )
+    {
+        return _mm512_mask_add_epi64( a.native, ~mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>>
+    FS_FORCEINLINE i64<8, SIMD> InvMaskedSub( const typename i64<8, SIMD>::MaskTypeArg& mask, const i64<8, SIMD>& a, const i64<8, SIMD>& b )
+    {
+        return _mm512_mask_sub_epi64( a.native, ~mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i64<8, SIMD>>, typename = std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_DQ>>
+    FS_FORCEINLINE i64<8, SIMD> InvMaskedMul( const typename i64<8, SIMD>::MaskTypeArg& mask, const i64<8, SIMD>& a, const i64<8, SIMD>& b )
+    {
+        return _mm512_mask_mullo_epi64( a.native, ~mask.native, a.native, b.native );
+    }
+}
\ No newline at end of file
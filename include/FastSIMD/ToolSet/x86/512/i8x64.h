@@ -0,0 +1,221 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::int8_t, 64, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_BW>>
+    {
+        static constexpr size_t ElementCount = 64;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m512i;
+        using ElementType = std::int8_t;
+        using MaskType = m8<ElementCount, false, SIMD>;
+        using MaskTypeArg = m8<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::int8_t v ) : native( _mm512_set1_epi8( v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm512_add_epi8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm512_sub_epi8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm512_and_si512( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm512_or_si512( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm512_xor_si512( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            /* no 8 bit shifts, shift odd bytes in place and blend in even bytes shifted from the top of each 16 bit lane */
+            __m512i even = _mm512_srli_epi16( _mm512_srai_epi16( _mm512_slli_epi16( native, 8 ), rhs ), 8 );
+            native = _mm512_mask_blend_epi8( 0x5555555555555555, _mm512_srai_epi16( native, rhs ), even );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm512_and_si512( _mm512_slli_epi16( native, rhs ), _mm512_set1_epi8( (std::int8_t)( 0xFF << rhs ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m512i neg1 = _mm512_set1_epi32( -1 );
+            return _mm512_xor_si512( native, neg1 );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm512_sub_epi8( _mm512_setzero_si512(), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi8_mask( native, rhs.native, _MM_CMPINT_EQ );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi8_mask( native, rhs.native, _MM_CMPINT_NE );
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi8_mask( native, rhs.native, _MM_CMPINT_NLT );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi8_mask( native, rhs.native, _MM_CMPINT_LE );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi8_mask( native, rhs.native, _MM_CMPINT_NLE );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm512_cmp_epi8_mask( native, rhs.native, _MM_CMPINT_LT );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> Load( TypeWrapper<const std::int8_t*, 64, SIMD> ptr )
+    {
+        return _mm512_loadu_si512( (const __m512i*)ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE void Store( typename i8<64, SIMD>::ElementType* ptr, const i8<64, SIMD>& a )
+    {
+        _mm512_storeu_si512( (__m512i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE std::int8_t Extract0( const i8<64, SIMD>& a )
+    {
+        return static_cast<std::int8_t>( _mm512_cvtsi512_si32( a.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> Abs( const i8<64, SIMD>& a )
+    {
+        return _mm512_abs_epi8( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> Min( const i8<64, SIMD>& a, const i8<64, SIMD>& b )
+    {
+        return _mm512_min_epi8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> Max( const i8<64, SIMD>& a, const i8<64, SIMD>& b )
+    {
+        return _mm512_max_epi8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> Select( const typename i8<64, SIMD>::MaskTypeArg& mask, const i8<64, SIMD>& ifTrue, const i8<64, SIMD>& ifFalse )
+    {
+        return _mm512_mask_blend_epi8( mask.native, ifFalse.native, ifTrue.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> BitwiseAndNot( const i8<64, SIMD>& a, const i8<64, SIMD>& b )
+    {
+        return _mm512_andnot_si512( b.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> BitShiftRightZeroExtend( const i8<64, SIMD>& a, int b )
+    {
+        return _mm512_and_si512( _mm512_srli_epi16( a.native, b ), _mm512_set1_epi8( (std::int8_t)( 0xFF >> b ) ) );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> Masked( const typename i8<64, SIMD>::MaskTypeArg& mask, const i8<64, SIMD>& a )
+    {
+        return _mm512_maskz_mov_epi8( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> InvMasked( const typename i8<64, SIMD>::MaskTypeArg& mask, const i8<64, SIMD>& a )
+    {
+        return _mm512_maskz_mov_epi8( ~mask.native, a.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> MaskedAdd( const typename i8<64, SIMD>::MaskTypeArg& mask, const i8<64, SIMD>& a, const i8<64, SIMD>& b )
+    {
+        return _mm512_mask_add_epi8( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> MaskedSub( const typename i8<64, SIMD>::MaskTypeArg& mask, const i8<64, SIMD>& a, const i8<64, SIMD>& b )
+    {
+        return _mm512_mask_sub_epi8( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> InvMaskedAdd( const typename i8<64, SIMD>::MaskTypeArg& mask, const i8<64, SIMD>& a, const i8<64, SIMD>& b )
+    {
+        return _mm512_mask_add_epi8( a.native, ~mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> InvMaskedSub( const typename i8<64, SIMD>::MaskTypeArg& mask, const i8<64, SIMD>& a, const i8<64, SIMD>& b )
+    {
+        return _mm512_mask_sub_epi8( a.native, ~mask.native, a.native, b.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> AddSat( const i8<64, SIMD>& a, const i8<64, SIMD>& b )
+    {
+        return _mm512_adds_epi8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> SubSat( const i8<64, SIMD>& a, const i8<64, SIMD>& b )
+    {
+        return _mm512_subs_epi8( a.native, b.native );
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    namespace impl
+    {
+        struct AVX512MaskBase32
+        {
+            __mmask32 native;
+        };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool OPTIMISE_FLOAT>
+    struct Register<Mask<16, OPTIMISE_FLOAT>, 32, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_BW>>
+        : std::conditional_t<OPTIMISE_FLOAT, impl::AVX512MaskBase32, Register<Mask<16, true>, 32, SIMD>>
+    {
+        static constexpr size_t ElementCount = 32;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = decltype(AVX512MaskBase32::native);
+        using ElementType = Mask<16, OPTIMISE_FLOAT>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) { this->native = v; }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return this->native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = ( this->native & rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = ( this->native | rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = ( this->native ^ rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return static_cast<NativeType>( ~this->native );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m16<32, B, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const m16<32, B, SIMD>& a )
+    {
+        return (bool)a.native;
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m16<32, B, SIMD>>>
+    FS_FORCEINLINE BitStorage<32> BitMask( const m16<32, B, SIMD>& a )
+    {
+        return static_cast<BitStorage<32>>( a.native );
+    }
+}
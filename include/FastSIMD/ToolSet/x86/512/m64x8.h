@@ -0,0 +1,70 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    namespace impl
+    {
+        struct AVX512MaskBase8
+        {
+            __mmask8 native;
+        };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool OPTIMISE_FLOAT>
+    struct Register<Mask<64, OPTIMISE_FLOAT>, 8, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_F>>
+        : std::conditional_t<OPTIMISE_FLOAT, impl::AVX512MaskBase8, Register<Mask<64, true>, 8, SIMD>>
+    {
+        static constexpr size_t ElementCount = 8;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = decltype(AVX512MaskBase8::native);
+        using ElementType = Mask<64, OPTIMISE_FLOAT>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) { this->native = v; }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return this->native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = ( this->native & rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = ( this->native | rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = ( this->native ^ rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return static_cast<NativeType>( ~this->native );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m64<8, B, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const m64<8, B, SIMD>& a )
+    {
+        return (bool)a.native;
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m64<8, B, SIMD>>>
+    FS_FORCEINLINE BitStorage<8> BitMask( const m64<8, B, SIMD>& a )
+    {
+        return static_cast<BitStorage<8>>( a.native );
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    namespace impl
+    {
+        struct AVX512MaskBase64
+        {
+            __mmask64 native;
+        };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool OPTIMISE_FLOAT>
+    struct Register<Mask<8, OPTIMISE_FLOAT>, 64, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_BW>>
+        : std::conditional_t<OPTIMISE_FLOAT, impl::AVX512MaskBase64, Register<Mask<8, true>, 64, SIMD>>
+    {
+        static constexpr size_t ElementCount = 64;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = decltype(AVX512MaskBase64::native);
+        using ElementType = Mask<8, OPTIMISE_FLOAT>;
+        using MaskType = Register;
+        using MaskTypeArg = Register;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) { this->native = v; }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return this->native;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            this->native = ( this->native & rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            this->native = ( this->native | rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            this->native = ( this->native ^ rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            return static_cast<NativeType>( ~this->native );
+        }
+    };
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m8<64, B, SIMD>>>
+    FS_FORCEINLINE bool AnyMask( const m8<64, B, SIMD>& a )
+    {
+        return (bool)a.native;
+    }
+
+    template<FastSIMD::FeatureSet SIMD, bool B, typename = EnableIfNative<m8<64, B, SIMD>>>
+    FS_FORCEINLINE BitStorage<64> BitMask( const m8<64, B, SIMD>& a )
+    {
+        return static_cast<BitStorage<64>>( a.native );
+    }
+}
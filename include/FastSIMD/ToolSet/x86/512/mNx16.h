@@ -13,7 +13,7 @@ namespace FS
     }
 
     template<FastSIMD::FeatureSet SIMD, std::size_t N, bool OPTIMISE_FLOAT>
-    struct Register<Mask<N, OPTIMISE_FLOAT>, 16, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_F>>
+    struct Register<Mask<N, OPTIMISE_FLOAT>, 16, SIMD, std::enable_if_t<( SIMD & FastSIMD::FeatureFlag::AVX512_F ) && N == 32>>
         : std::conditional_t<OPTIMISE_FLOAT, impl::AVX512MaskBase, Register<Mask<N, true>, 16, SIMD>>
     {
         static constexpr size_t ElementCount = 16;
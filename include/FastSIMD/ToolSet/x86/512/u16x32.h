@@ -0,0 +1,219 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::uint16_t, 32, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_BW>>
+    {
+        static constexpr size_t ElementCount = 32;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m512i;
+        using ElementType = std::uint16_t;
+        using MaskType = m16<ElementCount, false, SIMD>;
+        using MaskTypeArg = m16<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::uint16_t v ) : native( _mm512_set1_epi16( (std::int16_t)v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm512_add_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm512_sub_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator *=( const Register& rhs )
+        {
+            native = _mm512_mullo_epi16( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm512_and_si512( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm512_or_si512( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm512_xor_si512( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = _mm512_srli_epi16( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm512_slli_epi16( native, rhs );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m512i neg1 = _mm512_set1_epi32( -1 );
+            return _mm512_xor_si512( native, neg1 );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm512_sub_epi16( _mm512_setzero_si512(), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm512_cmp_epu16_mask( native, rhs.native, _MM_CMPINT_EQ );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epu16_mask( native, rhs.native, _MM_CMPINT_NE );
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epu16_mask( native, rhs.native, _MM_CMPINT_NLT );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epu16_mask( native, rhs.native, _MM_CMPINT_LE );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm512_cmp_epu16_mask( native, rhs.native, _MM_CMPINT_NLE );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm512_cmp_epu16_mask( native, rhs.native, _MM_CMPINT_LT );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> Load( TypeWrapper<const std::uint16_t*, 32, SIMD> ptr )
+    {
+        return _mm512_loadu_si512( (const __m512i*)ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE void Store( typename u16<32, SIMD>::ElementType* ptr, const u16<32, SIMD>& a )
+    {
+        _mm512_storeu_si512( (__m512i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE std::uint16_t Extract0( const u16<32, SIMD>& a )
+    {
+        return static_cast<std::uint16_t>( _mm512_cvtsi512_si32( a.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> Min( const u16<32, SIMD>& a, const u16<32, SIMD>& b )
+    {
+        return _mm512_min_epu16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> Max( const u16<32, SIMD>& a, const u16<32, SIMD>& b )
+    {
+        return _mm512_max_epu16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> Select( const typename u16<32, SIMD>::MaskTypeArg& mask, const u16<32, SIMD>& ifTrue, const u16<32, SIMD>& ifFalse )
+    {
+        return _mm512_mask_blend_epi16( mask.native, ifFalse.native, ifTrue.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> BitwiseAndNot( const u16<32, SIMD>& a, const u16<32, SIMD>& b )
+    {
+        return _mm512_andnot_si512( b.native, a.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> Masked( const typename u16<32, SIMD>::MaskTypeArg& mask, const u16<32, SIMD>& a )
+    {
+        return _mm512_maskz_mov_epi16( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> InvMasked( const typename u16<32, SIMD>::MaskTypeArg& mask, const u16<32, SIMD>& a )
+    {
+        return _mm512_maskz_mov_epi16( ~mask.native, a.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> MaskedAdd( const typename u16<32, SIMD>::MaskTypeArg& mask, const u16<32, SIMD>& a, const u16<32, SIMD>& b )
+    {
+        return _mm512_mask_add_epi16( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> MaskedSub( const typename u16<32, SIMD>::MaskTypeArg& mask, const u16<32, SIMD>& a, const u16<32, SIMD>& b )
+    {
+        return _mm512_mask_sub_epi16( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> InvMaskedAdd( const typename u16<32, SIMD>::MaskTypeArg& mask, const u16<32, SIMD>& a, const u16<32, SIMD>& b )
+    {
+        return _mm512_mask_add_epi16( a.native, ~mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> InvMaskedSub( const typename u16<32, SIMD>::MaskTypeArg& mask, const u16<32, SIMD>& a, const u16<32, SIMD>& b )
+    {
+        return _mm512_mask_sub_epi16( a.native, ~mask.native, a.native, b.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> AddSat( const u16<32, SIMD>& a, const u16<32, SIMD>& b )
+    {
+        return _mm512_adds_epu16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> SubSat( const u16<32, SIMD>& a, const u16<32, SIMD>& b )
+    {
+        return _mm512_subs_epu16( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> Average( const u16<32, SIMD>& a, const u16<32, SIMD>& b )
+    {
+        return _mm512_avg_epu16( a.native, b.native );
+    }
+}
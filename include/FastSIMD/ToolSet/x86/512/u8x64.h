@@ -0,0 +1,229 @@
+#pragma once
+
+#include <FastSIMD/ToolSet/Generic/Register.h>
+
+namespace FS
+{
+    template<FastSIMD::FeatureSet SIMD>
+    struct Register<std::uint8_t, 64, SIMD, std::enable_if_t<SIMD & FastSIMD::FeatureFlag::AVX512_BW>>
+    {
+        static constexpr size_t ElementCount = 64;
+        static constexpr auto FeatureFlags = SIMD;
+
+        using NativeType = __m512i;
+        using ElementType = std::uint8_t;
+        using MaskType = m8<ElementCount, false, SIMD>;
+        using MaskTypeArg = m8<ElementCount, true, SIMD>;
+
+        FS_FORCEINLINE Register() = default;
+        FS_FORCEINLINE Register( NativeType v ) : native( v ) { }
+        FS_FORCEINLINE Register( std::uint8_t v ) : native( _mm512_set1_epi8( (std::int8_t)v ) ) { }
+
+        FS_FORCEINLINE NativeType GetNative() const
+        {
+            return native;
+        }
+
+        FS_FORCEINLINE Register& operator +=( const Register& rhs )
+        {
+            native = _mm512_add_epi8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator -=( const Register& rhs )
+        {
+            native = _mm512_sub_epi8( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator &=( const Register& rhs )
+        {
+            native = _mm512_and_si512( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator |=( const Register& rhs )
+        {
+            native = _mm512_or_si512( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator ^=( const Register& rhs )
+        {
+            native = _mm512_xor_si512( native, rhs.native );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator >>=( int rhs )
+        {
+            native = _mm512_and_si512( _mm512_srli_epi16( native, rhs ), _mm512_set1_epi8( (std::int8_t)( 0xFF >> rhs ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register& operator <<=( int rhs )
+        {
+            native = _mm512_and_si512( _mm512_slli_epi16( native, rhs ), _mm512_set1_epi8( (std::int8_t)( 0xFF << rhs ) ) );
+            return *this;
+        }
+
+        FS_FORCEINLINE Register operator ~() const
+        {
+            const __m512i neg1 = _mm512_set1_epi32( -1 );
+            return _mm512_xor_si512( native, neg1 );
+        }
+
+        FS_FORCEINLINE Register operator -() const
+        {
+            return _mm512_sub_epi8( _mm512_setzero_si512(), native );
+        }
+
+
+        FS_FORCEINLINE MaskType operator ==( const Register& rhs ) const
+        {
+            return _mm512_cmp_epu8_mask( native, rhs.native, _MM_CMPINT_EQ );
+        }
+
+        FS_FORCEINLINE MaskType operator !=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epu8_mask( native, rhs.native, _MM_CMPINT_NE );
+        }
+
+        FS_FORCEINLINE MaskType operator >=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epu8_mask( native, rhs.native, _MM_CMPINT_NLT );
+        }
+
+        FS_FORCEINLINE MaskType operator <=( const Register& rhs ) const
+        {
+            return _mm512_cmp_epu8_mask( native, rhs.native, _MM_CMPINT_LE );
+        }
+
+        FS_FORCEINLINE MaskType operator >( const Register& rhs ) const
+        {
+            return _mm512_cmp_epu8_mask( native, rhs.native, _MM_CMPINT_NLE );
+        }
+
+        FS_FORCEINLINE MaskType operator <( const Register& rhs ) const
+        {
+            return _mm512_cmp_epu8_mask( native, rhs.native, _MM_CMPINT_LT );
+        }
+
+        NativeType native;
+    };
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> Load( TypeWrapper<const std::uint8_t*, 64, SIMD> ptr )
+    {
+        return _mm512_loadu_si512( (const __m512i*)ptr.value );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE void Store( typename u8<64, SIMD>::ElementType* ptr, const u8<64, SIMD>& a )
+    {
+        _mm512_storeu_si512( (__m512i*)ptr, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE std::uint8_t Extract0( const u8<64, SIMD>& a )
+    {
+        return static_cast<std::uint8_t>( _mm512_cvtsi512_si32( a.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> Min( const u8<64, SIMD>& a, const u8<64, SIMD>& b )
+    {
+        return _mm512_min_epu8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> Max( const u8<64, SIMD>& a, const u8<64, SIMD>& b )
+    {
+        return _mm512_max_epu8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> Select( const typename u8<64, SIMD>::MaskTypeArg& mask, const u8<64, SIMD>& ifTrue, const u8<64, SIMD>& ifFalse )
+    {
+        return _mm512_mask_blend_epi8( mask.native, ifFalse.native, ifTrue.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> BitwiseAndNot( const u8<64, SIMD>& a, const u8<64, SIMD>& b )
+    {
+        return _mm512_andnot_si512( b.native, a.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> Masked( const typename u8<64, SIMD>::MaskTypeArg& mask, const u8<64, SIMD>& a )
+    {
+        return _mm512_maskz_mov_epi8( mask.native, a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> InvMasked( const typename u8<64, SIMD>::MaskTypeArg& mask, const u8<64, SIMD>& a )
+    {
+        return _mm512_maskz_mov_epi8( ~mask.native, a.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> MaskedAdd( const typename u8<64, SIMD>::MaskTypeArg& mask, const u8<64, SIMD>& a, const u8<64, SIMD>& b )
+    {
+        return _mm512_mask_add_epi8( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> MaskedSub( const typename u8<64, SIMD>::MaskTypeArg& mask, const u8<64, SIMD>& a, const u8<64, SIMD>& b )
+    {
+        return _mm512_mask_sub_epi8( a.native, mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> InvMaskedAdd( const typename u8<64, SIMD>::MaskTypeArg& mask, const u8<64, SIMD>& a, const u8<64, SIMD>& b )
+    {
+        return _mm512_mask_add_epi8( a.native, ~mask.native, a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> InvMaskedSub( const typename u8<64, SIMD>::MaskTypeArg& mask, const u8<64, SIMD>& a, const u8<64, SIMD>& b )
+    {
+        return _mm512_mask_sub_epi8( a.native, ~mask.native, a.native, b.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> AddSat( const u8<64, SIMD>& a, const u8<64, SIMD>& b )
+    {
+        return _mm512_adds_epu8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> SubSat( const u8<64, SIMD>& a, const u8<64, SIMD>& b )
+    {
+        return _mm512_subs_epu8( a.native, b.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> Average( const u8<64, SIMD>& a, const u8<64, SIMD>& b )
+    {
+        return _mm512_avg_epu8( a.native, b.native );
+    }
+
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> TableLookup( const u8<64, SIMD>& table, const u8<64, SIMD>& idx )
+    {
+        /* pshufb only looks up within 128 bit lanes, broadcast each table lane and merge where the index high nibble selects it */
+        __m512i lane = _mm512_and_si512( _mm512_srli_epi16( idx.native, 4 ), _mm512_set1_epi8( 0x0F ) );
+        __m512i result = _mm512_setzero_si512();
+
+        result = _mm512_mask_shuffle_epi8( result, _mm512_cmpeq_epi8_mask( lane, _mm512_set1_epi8( 0 ) ), _mm512_shuffle_i32x4( table.native, table.native, 0x00 ), idx.native );
+        result = _mm512_mask_shuffle_epi8( result, _mm512_cmpeq_epi8_mask( lane, _mm512_set1_epi8( 1 ) ), _mm512_shuffle_i32x4( table.native, table.native, 0x55 ), idx.native );
+        result = _mm512_mask_shuffle_epi8( result, _mm512_cmpeq_epi8_mask( lane, _mm512_set1_epi8( 2 ) ), _mm512_shuffle_i32x4( table.native, table.native, 0xAA ), idx.native );
+        result = _mm512_mask_shuffle_epi8( result, _mm512_cmpeq_epi8_mask( lane, _mm512_set1_epi8( 3 ) ), _mm512_shuffle_i32x4( table.native, table.native, 0xFF ), idx.native );
+
+        return result;
+    }
+}
@@ -7,7 +7,17 @@
 
 #include "256/f32x8.h"
 #include "256/i32x8.h"
+#include "256/u32x8.h"
 #include "256/m32x8.h"
+#include "256/i64x4.h"
+#include "256/f64x4.h"
+#include "256/m64x4.h"
+#include "256/i8x32.h"
+#include "256/u8x32.h"
+#include "256/m8x32.h"
+#include "256/i16x16.h"
+#include "256/u16x16.h"
+#include "256/m16x16.h"
 
 namespace FS
 {
@@ -23,24 +33,281 @@ namespace FS
         return _mm256_cvtepi32_ps( a.native );
     }
 
-    template<typename U, typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 8, SIMD>>>
-    FS_FORCEINLINE Register<U, 8, SIMD> Cast( const Register<T, 8, SIMD>& a, TypeDummy<U> )
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<8, SIMD>>>
+    FS_FORCEINLINE u32<8, SIMD> Convert( const f32<8, SIMD>& a, TypeDummy<uint32_t> )
     {
-        if constexpr( 
-            std::is_same_v<typename Register<T, 8, SIMD>::NativeType, __m256> &&
-            std::is_same_v<typename Register<U, 8, SIMD>::NativeType, __m256i> )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
         {
-            return _mm256_castps_si256( a.GetNative() );
+            return _mm256_cvtps_epu32( a.native );
         }
-        else if constexpr( 
-            std::is_same_v<typename Register<T, 8, SIMD>::NativeType, __m256i> &&
-            std::is_same_v<typename Register<U, 8, SIMD>::NativeType, __m256> )
+        else
+        {
+            /* values >= 2^31 overflow the signed convert, bring them into range and restore the top bit after */
+            const __m256 two31 = _mm256_set1_ps( 2147483648.0f );
+            __m256 high = _mm256_cmp_ps( a.native, two31, _CMP_GE_OQ );
+            __m256i converted = _mm256_cvtps_epi32( _mm256_sub_ps( a.native, _mm256_and_ps( high, two31 ) ) );
+            return _mm256_xor_si256( converted, _mm256_slli_epi32( _mm256_castps_si256( high ), 31 ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<8, SIMD>>>
+    FS_FORCEINLINE f32<8, SIMD> Convert( const u32<8, SIMD>& a, TypeDummy<float> )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
         {
-            return _mm256_castsi256_ps( a.GetNative() );
+            return _mm256_cvtepu32_ps( a.native );
         }
         else
         {
-            return a.GetNative();
+            /* both 16 bit halves convert exactly, the final add is the only rounding step */
+            __m256 high = _mm256_cvtepi32_ps( _mm256_srli_epi32( a.native, 16 ) );
+            __m256 low = _mm256_cvtepi32_ps( _mm256_and_si256( a.native, _mm256_set1_epi32( 0xFFFF ) ) );
+            return _mm256_add_ps( _mm256_mul_ps( high, _mm256_set1_ps( 65536.0f ) ), low );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Convert( const f32<4, SIMD>& a, TypeDummy<double> )
+    {
+        return _mm256_cvtps_pd( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Convert( const f64<4, SIMD>& a, TypeDummy<float> )
+    {
+        return _mm256_cvtpd_ps( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Convert( const i32<4, SIMD>& a, TypeDummy<double> )
+    {
+        return _mm256_cvtepi32_pd( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> Convert( const f64<4, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return _mm256_cvtpd_epi32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>, typename = EnableIfNotNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Convert( const f32<8, SIMD>& a, TypeDummy<double> )
+    {
+        return f64<8, SIMD>{ _mm256_cvtps_pd( _mm256_castps256_ps128( a.native ) ), _mm256_cvtps_pd( _mm256_extractf128_ps( a.native, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<8, SIMD>>, typename = EnableIfNotNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f32<8, SIMD> Convert( const f64<8, SIMD>& a, TypeDummy<float> )
+    {
+        return _mm256_set_m128( _mm256_cvtpd_ps( a.v1.native ), _mm256_cvtpd_ps( a.v0.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>, typename = EnableIfNotNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Convert( const i32<8, SIMD>& a, TypeDummy<double> )
+    {
+        return f64<8, SIMD>{ _mm256_cvtepi32_pd( _mm256_castsi256_si128( a.native ) ), _mm256_cvtepi32_pd( _mm256_extracti128_si256( a.native, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>, typename = EnableIfNotNative<f64<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Convert( const f64<8, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return _mm256_set_m128i( _mm256_cvtpd_epi32( a.v1.native ), _mm256_cvtpd_epi32( a.v0.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> Convert( const i8<16, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return _mm256_cvtepi8_epi16( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>, typename = EnableIfNotNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> Convert( const i8<32, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return i16<32, SIMD>{ _mm256_cvtepi8_epi16( _mm256_castsi256_si128( a.native ) ), _mm256_cvtepi8_epi16( _mm256_extracti128_si256( a.native, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> Convert( const u8<16, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        return _mm256_cvtepu8_epi16( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>, typename = EnableIfNotNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> Convert( const u8<32, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        return u16<32, SIMD>{ _mm256_cvtepu8_epi16( _mm256_castsi256_si128( a.native ) ), _mm256_cvtepu8_epi16( _mm256_extracti128_si256( a.native, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Convert( const i16<8, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return _mm256_cvtepi16_epi32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>, typename = EnableIfNotNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> Convert( const i16<16, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return i32<16, SIMD>{ _mm256_cvtepi16_epi32( _mm256_castsi256_si128( a.native ) ), _mm256_cvtepi16_epi32( _mm256_extracti128_si256( a.native, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Convert( const u16<8, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return _mm256_cvtepu16_epi32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>, typename = EnableIfNotNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> Convert( const u16<16, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return i32<16, SIMD>{ _mm256_cvtepu16_epi32( _mm256_castsi256_si128( a.native ) ), _mm256_cvtepu16_epi32( _mm256_extracti128_si256( a.native, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Convert( const i16<16, SIMD>& a, TypeDummy<int8_t> )
+    {
+        return _mm_packs_epi16( _mm256_castsi256_si128( a.native ), _mm256_extracti128_si256( a.native, 1 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<32, SIMD>>, typename = EnableIfNotNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> Convert( const i16<32, SIMD>& a, TypeDummy<int8_t> )
+    {
+        // Packs interleave 128 bit lanes, permute to restore element order
+        return _mm256_permute4x64_epi64( _mm256_packs_epi16( a.v0.native, a.v1.native ), _MM_SHUFFLE( 3, 1, 2, 0 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Convert( const i16<16, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        return _mm_packus_epi16( _mm256_castsi256_si128( a.native ), _mm256_extracti128_si256( a.native, 1 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>, typename = EnableIfNotNative<i16<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> Convert( const i16<32, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        // Packs interleave 128 bit lanes, permute to restore element order
+        return _mm256_permute4x64_epi64( _mm256_packus_epi16( a.v0.native, a.v1.native ), _MM_SHUFFLE( 3, 1, 2, 0 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Convert( const u16<16, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        const __m256i max = _mm256_set1_epi16( 0xFF );
+        __m256i clamped = _mm256_min_epu16( a.native, max );
+        return _mm_packus_epi16( _mm256_castsi256_si128( clamped ), _mm256_extracti128_si256( clamped, 1 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<32, SIMD>>, typename = EnableIfNotNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> Convert( const u16<32, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        const __m256i max = _mm256_set1_epi16( 0xFF );
+        // Packs interleave 128 bit lanes, permute to restore element order
+        return _mm256_permute4x64_epi64( _mm256_packus_epi16( _mm256_min_epu16( a.v0.native, max ), _mm256_min_epu16( a.v1.native, max ) ), _MM_SHUFFLE( 3, 1, 2, 0 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Convert( const i32<8, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return _mm_packs_epi32( _mm256_castsi256_si128( a.native ), _mm256_extracti128_si256( a.native, 1 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<16, SIMD>>, typename = EnableIfNotNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> Convert( const i32<16, SIMD>& a, TypeDummy<int16_t> )
+    {
+        // Packs interleave 128 bit lanes, permute to restore element order
+        return _mm256_permute4x64_epi64( _mm256_packs_epi32( a.v0.native, a.v1.native ), _MM_SHUFFLE( 3, 1, 2, 0 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Convert( const i32<8, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        return _mm_packus_epi32( _mm256_castsi256_si128( a.native ), _mm256_extracti128_si256( a.native, 1 ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<16, SIMD>>, typename = EnableIfNotNative<i32<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> Convert( const i32<16, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        // Packs interleave 128 bit lanes, permute to restore element order
+        return _mm256_permute4x64_epi64( _mm256_packus_epi32( a.v0.native, a.v1.native ), _MM_SHUFFLE( 3, 1, 2, 0 ) );
+    }
+
+    namespace impl
+    {
+        template<typename U>
+        FS_FORCEINLINE U NativeCast( __m256 a )
+        {
+            if constexpr( std::is_same_v<U, __m256i> )
+            {
+                return _mm256_castps_si256( a );
+            }
+            else
+            {
+                return _mm256_castps_pd( a );
+            }
+        }
+
+        template<typename U>
+        FS_FORCEINLINE U NativeCast( __m256i a )
+        {
+            if constexpr( std::is_same_v<U, __m256> )
+            {
+                return _mm256_castsi256_ps( a );
+            }
+            else
+            {
+                return _mm256_castsi256_pd( a );
+            }
+        }
+
+        template<typename U>
+        FS_FORCEINLINE U NativeCast( __m256d a )
+        {
+            if constexpr( std::is_same_v<U, __m256> )
+            {
+                return _mm256_castpd_ps( a );
+            }
+            else
+            {
+                return _mm256_castpd_si256( a );
+            }
+        }
+
+        template<typename T>
+        FS_FORCEINLINE void NativeStoreStream( T* ptr, __m256 a )
+        {
+            _mm256_stream_ps( reinterpret_cast<float*>( ptr ), a );
+        }
+
+        template<typename T>
+        FS_FORCEINLINE void NativeStoreStream( T* ptr, __m256i a )
+        {
+            _mm256_stream_si256( reinterpret_cast<__m256i*>( ptr ), a );
         }
+
+        template<typename T>
+        FS_FORCEINLINE void NativeStoreStream( T* ptr, __m256d a )
+        {
+            _mm256_stream_pd( reinterpret_cast<double*>( ptr ), a );
+        }
+
+        FS_FORCEINLINE std::pair<__m128, __m128> NativeSplit( __m256 a )
+        {
+            return { _mm256_castps256_ps128( a ), _mm256_extractf128_ps( a, 1 ) };
+        }
+
+        FS_FORCEINLINE std::pair<__m128i, __m128i> NativeSplit( __m256i a )
+        {
+            return { _mm256_castsi256_si128( a ), _mm256_extractf128_si256( a, 1 ) };
+        }
+
+        FS_FORCEINLINE std::pair<__m128d, __m128d> NativeSplit( __m256d a )
+        {
+            return { _mm256_castpd256_pd128( a ), _mm256_extractf128_pd( a, 1 ) };
+        }
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 32, SIMD>>>
+    FS_FORCEINLINE void StoreStream( typename Register<T, 32, SIMD>::ElementType* ptr, const Register<T, 32, SIMD>& a )
+    {
+        impl::NativeStoreStream( ptr, a.GetNative() );
     }
 }
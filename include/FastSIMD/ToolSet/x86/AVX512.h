@@ -3,7 +3,17 @@
 
 #include "512/f32x16.h"
 #include "512/i32x16.h"
+#include "512/u32x16.h"
 #include "512/mNx16.h"
+#include "512/i64x8.h"
+#include "512/f64x8.h"
+#include "512/m64x8.h"
+#include "512/i8x64.h"
+#include "512/u8x64.h"
+#include "512/m8x64.h"
+#include "512/i16x32.h"
+#include "512/u16x32.h"
+#include "512/m16x32.h"
 
 namespace FS
 {
@@ -19,24 +29,260 @@ namespace FS
         return _mm512_cvtepi32_ps( a.native );
     }
 
-    template<typename U, typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 16, SIMD>>>
-    FS_FORCEINLINE Register<U, 16, SIMD> Cast( const Register<T, 16, SIMD>& a, TypeDummy<U> )
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<16, SIMD>>>
+    FS_FORCEINLINE u32<16, SIMD> Convert( const f32<16, SIMD>& a, TypeDummy<uint32_t> )
     {
-        if constexpr( 
-            std::is_same_v<typename Register<T, 16, SIMD>::NativeType, __m512> &&
-            std::is_same_v<typename Register<U, 16, SIMD>::NativeType, __m512i> )
+        return _mm512_cvtps_epu32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> Convert( const u32<16, SIMD>& a, TypeDummy<float> )
+    {
+        return _mm512_cvtepu32_ps( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Convert( const f32<8, SIMD>& a, TypeDummy<double> )
+    {
+        return _mm512_cvtps_pd( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f32<8, SIMD> Convert( const f64<8, SIMD>& a, TypeDummy<float> )
+    {
+        return _mm512_cvtpd_ps( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE f64<8, SIMD> Convert( const i32<8, SIMD>& a, TypeDummy<double> )
+    {
+        return _mm512_cvtepi32_pd( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f64<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Convert( const f64<8, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return _mm512_cvtpd_epi32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE f64<16, SIMD> Convert( const f32<16, SIMD>& a, TypeDummy<double> )
+    {
+        return f64<16, SIMD>{ _mm512_cvtps_pd( _mm512_castps512_ps256( a.native ) ), _mm512_cvtps_pd( _mm512_extractf32x8_ps( a.native, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<16, SIMD>>>
+    FS_FORCEINLINE f32<16, SIMD> Convert( const f64<16, SIMD>& a, TypeDummy<float> )
+    {
+        return _mm512_insertf32x8( _mm512_castps256_ps512( _mm512_cvtpd_ps( a.v0.native ) ), _mm512_cvtpd_ps( a.v1.native ), 1 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE f64<16, SIMD> Convert( const i32<16, SIMD>& a, TypeDummy<double> )
+    {
+        return f64<16, SIMD>{ _mm512_cvtepi32_pd( _mm512_castsi512_si256( a.native ) ), _mm512_cvtepi32_pd( _mm512_extracti64x4_epi64( a.native, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> Convert( const f64<16, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return _mm512_inserti64x4( _mm512_castsi256_si512( _mm512_cvtpd_epi32( a.v0.native ) ), _mm512_cvtpd_epi32( a.v1.native ), 1 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> Convert( const i8<32, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return _mm512_cvtepi8_epi16( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>, typename = EnableIfNotNative<i16<64, SIMD>>>
+    FS_FORCEINLINE i16<64, SIMD> Convert( const i8<64, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return i16<64, SIMD>{ _mm512_cvtepi8_epi16( _mm512_castsi512_si256( a.native ) ), _mm512_cvtepi8_epi16( _mm512_extracti64x4_epi64( a.native, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> Convert( const u8<32, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        return _mm512_cvtepu8_epi16( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>, typename = EnableIfNotNative<u16<64, SIMD>>>
+    FS_FORCEINLINE u16<64, SIMD> Convert( const u8<64, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        return u16<64, SIMD>{ _mm512_cvtepu8_epi16( _mm512_castsi512_si256( a.native ) ), _mm512_cvtepu8_epi16( _mm512_extracti64x4_epi64( a.native, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> Convert( const i16<16, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return _mm512_cvtepi16_epi32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>, typename = EnableIfNotNative<i32<32, SIMD>>>
+    FS_FORCEINLINE i32<32, SIMD> Convert( const i16<32, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return i32<32, SIMD>{ _mm512_cvtepi16_epi32( _mm512_castsi512_si256( a.native ) ), _mm512_cvtepi16_epi32( _mm512_extracti64x4_epi64( a.native, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i32<16, SIMD> Convert( const u16<16, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return _mm512_cvtepu16_epi32( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>, typename = EnableIfNotNative<i32<32, SIMD>>>
+    FS_FORCEINLINE i32<32, SIMD> Convert( const u16<32, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return i32<32, SIMD>{ _mm512_cvtepu16_epi32( _mm512_castsi512_si256( a.native ) ), _mm512_cvtepu16_epi32( _mm512_extracti64x4_epi64( a.native, 1 ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE i8<32, SIMD> Convert( const i16<32, SIMD>& a, TypeDummy<int8_t> )
+    {
+        return _mm512_cvtsepi16_epi8( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<64, SIMD>>, typename = EnableIfNotNative<i16<64, SIMD>>>
+    FS_FORCEINLINE i8<64, SIMD> Convert( const i16<64, SIMD>& a, TypeDummy<int8_t> )
+    {
+        return _mm512_inserti64x4( _mm512_castsi256_si512( _mm512_cvtsepi16_epi8( a.v0.native ) ), _mm512_cvtsepi16_epi8( a.v1.native ), 1 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> Convert( const i16<32, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        // Unsigned saturate treats input as unsigned, clamp negatives to 0 first
+        const __m512i zero = _mm512_setzero_si512();
+        return _mm512_cvtusepi16_epi8( _mm512_max_epi16( a.native, zero ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>, typename = EnableIfNotNative<i16<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> Convert( const i16<64, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        // Unsigned saturate treats input as unsigned, clamp negatives to 0 first
+        const __m512i zero = _mm512_setzero_si512();
+        return _mm512_inserti64x4( _mm512_castsi256_si512( _mm512_cvtusepi16_epi8( _mm512_max_epi16( a.v0.native, zero ) ) ), _mm512_cvtusepi16_epi8( _mm512_max_epi16( a.v1.native, zero ) ), 1 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>>
+    FS_FORCEINLINE u8<32, SIMD> Convert( const u16<32, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        return _mm512_cvtusepi16_epi8( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<64, SIMD>>, typename = EnableIfNotNative<u16<64, SIMD>>>
+    FS_FORCEINLINE u8<64, SIMD> Convert( const u16<64, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        return _mm512_inserti64x4( _mm512_castsi256_si512( _mm512_cvtusepi16_epi8( a.v0.native ) ), _mm512_cvtusepi16_epi8( a.v1.native ), 1 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> Convert( const i32<16, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return _mm512_cvtsepi32_epi16( a.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<32, SIMD>>, typename = EnableIfNotNative<i32<32, SIMD>>>
+    FS_FORCEINLINE i16<32, SIMD> Convert( const i32<32, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return _mm512_inserti64x4( _mm512_castsi256_si512( _mm512_cvtsepi32_epi16( a.v0.native ) ), _mm512_cvtsepi32_epi16( a.v1.native ), 1 );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> Convert( const i32<16, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        // Unsigned saturate treats input as unsigned, clamp negatives to 0 first
+        const __m512i zero = _mm512_setzero_si512();
+        return _mm512_cvtusepi32_epi16( _mm512_max_epi32( a.native, zero ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<32, SIMD>>, typename = EnableIfNotNative<i32<32, SIMD>>>
+    FS_FORCEINLINE u16<32, SIMD> Convert( const i32<32, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        // Unsigned saturate treats input as unsigned, clamp negatives to 0 first
+        const __m512i zero = _mm512_setzero_si512();
+        return _mm512_inserti64x4( _mm512_castsi256_si512( _mm512_cvtusepi32_epi16( _mm512_max_epi32( a.v0.native, zero ) ) ), _mm512_cvtusepi32_epi16( _mm512_max_epi32( a.v1.native, zero ) ), 1 );
+    }
+
+    namespace impl
+    {
+        template<typename U>
+        FS_FORCEINLINE U NativeCast( __m512 a )
+        {
+            if constexpr( std::is_same_v<U, __m512i> )
+            {
+                return _mm512_castps_si512( a );
+            }
+            else
+            {
+                return _mm512_castps_pd( a );
+            }
+        }
+
+        template<typename U>
+        FS_FORCEINLINE U NativeCast( __m512i a )
+        {
+            if constexpr( std::is_same_v<U, __m512> )
+            {
+                return _mm512_castsi512_ps( a );
+            }
+            else
+            {
+                return _mm512_castsi512_pd( a );
+            }
+        }
+
+        template<typename U>
+        FS_FORCEINLINE U NativeCast( __m512d a )
+        {
+            if constexpr( std::is_same_v<U, __m512> )
+            {
+                return _mm512_castpd_ps( a );
+            }
+            else
+            {
+                return _mm512_castpd_si512( a );
+            }
+        }
+
+        template<typename T>
+        FS_FORCEINLINE void NativeStoreStream( T* ptr, __m512 a )
         {
-            return _mm512_castps_si512( a.GetNative() );
+            _mm512_stream_ps( reinterpret_cast<float*>( ptr ), a );
         }
-        else if constexpr( 
-            std::is_same_v<typename Register<T, 16, SIMD>::NativeType, __m512i> &&
-            std::is_same_v<typename Register<U, 16, SIMD>::NativeType, __m512> )
+
+        template<typename T>
+        FS_FORCEINLINE void NativeStoreStream( T* ptr, __m512i a )
+        {
+            _mm512_stream_si512( reinterpret_cast<__m512i*>( ptr ), a );
+        }
+
+        template<typename T>
+        FS_FORCEINLINE void NativeStoreStream( T* ptr, __m512d a )
+        {
+            _mm512_stream_pd( reinterpret_cast<double*>( ptr ), a );
+        }
+
+        FS_FORCEINLINE std::pair<__m256, __m256> NativeSplit( __m512 a )
         {
-            return _mm512_castsi512_ps( a.GetNative() );
+            return { _mm512_castps512_ps256( a ), _mm256_castpd_ps( _mm512_extractf64x4_pd( _mm512_castps_pd( a ), 1 ) ) };
         }
-        else
+
+        FS_FORCEINLINE std::pair<__m256i, __m256i> NativeSplit( __m512i a )
+        {
+            return { _mm512_castsi512_si256( a ), _mm512_extracti64x4_epi64( a, 1 ) };
+        }
+
+        FS_FORCEINLINE std::pair<__m256d, __m256d> NativeSplit( __m512d a )
         {
-            return a.GetNative();
+            return { _mm512_castpd512_pd256( a ), _mm512_extractf64x4_pd( a, 1 ) };
         }
     }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 64, SIMD>>>
+    FS_FORCEINLINE void StoreStream( typename Register<T, 64, SIMD>::ElementType* ptr, const Register<T, 64, SIMD>& a )
+    {
+        impl::NativeStoreStream( ptr, a.GetNative() );
+    }
 }
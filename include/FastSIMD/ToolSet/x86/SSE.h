@@ -7,7 +7,17 @@
 
 #include "128/f32x4.h"
 #include "128/i32x4.h"
+#include "128/u32x4.h"
 #include "128/m32x4.h"
+#include "128/i64x2.h"
+#include "128/f64x2.h"
+#include "128/m64x2.h"
+#include "128/i8x16.h"
+#include "128/u8x16.h"
+#include "128/m8x16.h"
+#include "128/i16x8.h"
+#include "128/u16x8.h"
+#include "128/m16x8.h"
 
 namespace FS
 {
@@ -23,24 +33,350 @@ namespace FS
         return _mm_cvtepi32_ps( a.native );
     }
 
-    template<typename U, typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 4, SIMD>>>
-    FS_FORCEINLINE Register<U, 4, SIMD> Cast( const Register<T, 4, SIMD>& a, TypeDummy<U> )
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE u32<4, SIMD> Convert( const f32<4, SIMD>& a, TypeDummy<uint32_t> )
     {
-        if constexpr( 
-            std::is_same_v<typename Register<T, 4, SIMD>::NativeType, __m128> &&
-            std::is_same_v<typename Register<U, 4, SIMD>::NativeType, __m128i> )
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
         {
-            return _mm_castps_si128( a.GetNative() );
+            return _mm_cvtps_epu32( a.native );
         }
-        else if constexpr( 
-            std::is_same_v<typename Register<T, 4, SIMD>::NativeType, __m128i> &&
-            std::is_same_v<typename Register<U, 4, SIMD>::NativeType, __m128> )
+        else
+#endif
+        {
+            /* values >= 2^31 overflow the signed convert, bring them into range and restore the top bit after */
+            const __m128 two31 = _mm_set1_ps( 2147483648.0f );
+            __m128 high = _mm_cmpge_ps( a.native, two31 );
+            __m128i converted = _mm_cvtps_epi32( _mm_sub_ps( a.native, _mm_and_ps( high, two31 ) ) );
+            return _mm_xor_si128( converted, _mm_slli_epi32( _mm_castps_si128( high ), 31 ) );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u32<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Convert( const u32<4, SIMD>& a, TypeDummy<float> )
+    {
+#if FASTSIMD_MAX_FEATURE_VALUE() >= FASTSIMD_FEATURE_VALUE( AVX512 )
+        if constexpr( SIMD & FastSIMD::FeatureFlag::AVX512_VL )
+        {
+            return _mm_cvtepu32_ps( a.native );
+        }
+        else
+#endif
+        {
+            /* both 16 bit halves convert exactly, the final add is the only rounding step */
+            __m128 high = _mm_cvtepi32_ps( _mm_srli_epi32( a.native, 16 ) );
+            __m128 low = _mm_cvtepi32_ps( _mm_and_si128( a.native, _mm_set1_epi32( 0xFFFF ) ) );
+            return _mm_add_ps( _mm_mul_ps( high, _mm_set1_ps( 65536.0f ) ), low );
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = EnableIfNotNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Convert( const f32<4, SIMD>& a, TypeDummy<double> )
+    {
+        return f64<4, SIMD>{ _mm_cvtps_pd( a.native ), _mm_cvtps_pd( _mm_movehl_ps( a.native, a.native ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<f32<4, SIMD>>, typename = EnableIfNotNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f32<4, SIMD> Convert( const f64<4, SIMD>& a, TypeDummy<float> )
+    {
+        return _mm_movelh_ps( _mm_cvtpd_ps( a.v0.native ), _mm_cvtpd_ps( a.v1.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = EnableIfNotNative<f64<4, SIMD>>>
+    FS_FORCEINLINE f64<4, SIMD> Convert( const i32<4, SIMD>& a, TypeDummy<double> )
+    {
+        return f64<4, SIMD>{ _mm_cvtepi32_pd( a.native ), _mm_cvtepi32_pd( _mm_unpackhi_epi64( a.native, a.native ) ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i32<4, SIMD>>, typename = EnableIfNotNative<f64<4, SIMD>>>
+    FS_FORCEINLINE i32<4, SIMD> Convert( const f64<4, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return _mm_unpacklo_epi64( _mm_cvtpd_epi32( a.v0.native ), _mm_cvtpd_epi32( a.v1.native ) );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>, typename = EnableIfNotNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i16<16, SIMD> Convert( const i8<16, SIMD>& a, TypeDummy<int16_t> )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return i16<16, SIMD>{ _mm_cvtepi8_epi16( a.native ), _mm_cvtepi8_epi16( _mm_unpackhi_epi64( a.native, a.native ) ) };
+        }
+        else
+        {
+            // Unpack bytes into the high half of each 16 bit lane then shift down to sign extend
+            return i16<16, SIMD>{ _mm_srai_epi16( _mm_unpacklo_epi8( a.native, a.native ), 8 ), _mm_srai_epi16( _mm_unpackhi_epi8( a.native, a.native ), 8 ) };
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>, typename = EnableIfNotNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u16<16, SIMD> Convert( const u8<16, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        return u16<16, SIMD>{ _mm_unpacklo_epi8( a.native, _mm_setzero_si128() ), _mm_unpackhi_epi8( a.native, _mm_setzero_si128() ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>, typename = EnableIfNotNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Convert( const i16<8, SIMD>& a, TypeDummy<int32_t> )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
         {
-            return _mm_castsi128_ps( a.GetNative() );
+            return i32<8, SIMD>{ _mm_cvtepi16_epi32( a.native ), _mm_cvtepi16_epi32( _mm_unpackhi_epi64( a.native, a.native ) ) };
         }
         else
+        {
+            return i32<8, SIMD>{ _mm_srai_epi32( _mm_unpacklo_epi16( a.native, a.native ), 16 ), _mm_srai_epi32( _mm_unpackhi_epi16( a.native, a.native ), 16 ) };
+        }
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>, typename = EnableIfNotNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i32<8, SIMD> Convert( const u16<8, SIMD>& a, TypeDummy<int32_t> )
+    {
+        return i32<8, SIMD>{ _mm_unpacklo_epi16( a.native, _mm_setzero_si128() ), _mm_unpackhi_epi16( a.native, _mm_setzero_si128() ) };
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i8<16, SIMD>>, typename = EnableIfNotNative<i16<16, SIMD>>>
+    FS_FORCEINLINE i8<16, SIMD> Convert( const i16<16, SIMD>& a, TypeDummy<int8_t> )
+    {
+        return _mm_packs_epi16( a.v0.native, a.v1.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>, typename = EnableIfNotNative<i16<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Convert( const i16<16, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        return _mm_packus_epi16( a.v0.native, a.v1.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u8<16, SIMD>>, typename = EnableIfNotNative<u16<16, SIMD>>>
+    FS_FORCEINLINE u8<16, SIMD> Convert( const u16<16, SIMD>& a, TypeDummy<uint8_t> )
+    {
+        // Clamp to 255 first so packus doesn't see values above 0x7FFF as negative
+        u16<8, SIMD> max( (std::uint16_t)0xFF );
+        return _mm_packus_epi16( Min( a.v0, max ).native, Min( a.v1, max ).native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<i16<8, SIMD>>, typename = EnableIfNotNative<i32<8, SIMD>>>
+    FS_FORCEINLINE i16<8, SIMD> Convert( const i32<8, SIMD>& a, TypeDummy<int16_t> )
+    {
+        return _mm_packs_epi32( a.v0.native, a.v1.native );
+    }
+
+    template<FastSIMD::FeatureSet SIMD, typename = EnableIfNative<u16<8, SIMD>>, typename = EnableIfNotNative<i32<8, SIMD>>>
+    FS_FORCEINLINE u16<8, SIMD> Convert( const i32<8, SIMD>& a, TypeDummy<uint16_t> )
+    {
+        if constexpr( SIMD & FastSIMD::FeatureFlag::SSE41 )
+        {
+            return _mm_packus_epi32( a.v0.native, a.v1.native );
+        }
+        else
+        {
+            // Clamp to u16 range, bias into i16 range for signed pack then remove bias
+            i32<4, SIMD> min( 0 );
+            i32<4, SIMD> max( 0xFFFF );
+            i32<4, SIMD> bias( 0x8000 );
+
+            __m128i packed = _mm_packs_epi32( ( Min( Max( a.v0, min ), max ) - bias ).native, ( Min( Max( a.v1, min ), max ) - bias ).native );
+            return _mm_xor_si128( packed, _mm_set1_epi16( (std::int16_t)0x8000 ) );
+        }
+    }
+
+    namespace impl
+    {
+        template<typename U>
+        FS_FORCEINLINE U NativeCast( __m128 a )
+        {
+            if constexpr( std::is_same_v<U, __m128i> )
+            {
+                return _mm_castps_si128( a );
+            }
+            else
+            {
+                return _mm_castps_pd( a );
+            }
+        }
+
+        template<typename U>
+        FS_FORCEINLINE U NativeCast( __m128i a )
+        {
+            if constexpr( std::is_same_v<U, __m128> )
+            {
+                return _mm_castsi128_ps( a );
+            }
+            else
+            {
+                return _mm_castsi128_pd( a );
+            }
+        }
+
+        template<typename U>
+        FS_FORCEINLINE U NativeCast( __m128d a )
+        {
+            if constexpr( std::is_same_v<U, __m128> )
+            {
+                return _mm_castpd_ps( a );
+            }
+            else
+            {
+                return _mm_castpd_si128( a );
+            }
+        }
+
+        template<typename T>
+        FS_FORCEINLINE void NativeStoreStream( T* ptr, __m128 a )
+        {
+            _mm_stream_ps( reinterpret_cast<float*>( ptr ), a );
+        }
+
+        template<typename T>
+        FS_FORCEINLINE void NativeStoreStream( T* ptr, __m128i a )
+        {
+            _mm_stream_si128( reinterpret_cast<__m128i*>( ptr ), a );
+        }
+
+        template<typename T>
+        FS_FORCEINLINE void NativeStoreStream( T* ptr, __m128d a )
+        {
+            _mm_stream_pd( reinterpret_cast<double*>( ptr ), a );
+        }
+
+        // Move the element BYTES into the register down to the first element
+        template<std::size_t BYTES>
+        FS_FORCEINLINE __m128 NativeShiftDown( __m128 a )
+        {
+            if constexpr( BYTES == 8 )
+            {
+                return _mm_movehl_ps( a, a );
+            }
+            else
+            {
+                return _mm_shuffle_ps( a, a, _MM_SHUFFLE( 1, 1, 1, 1 ) );
+            }
+        }
+
+        template<std::size_t BYTES>
+        FS_FORCEINLINE __m128i NativeShiftDown( __m128i a )
+        {
+            if constexpr( BYTES == 8 )
+            {
+                return _mm_shuffle_epi32( a, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+            }
+            else if constexpr( BYTES == 4 )
+            {
+                return _mm_shuffle_epi32( a, _MM_SHUFFLE( 1, 1, 1, 1 ) );
+            }
+            else
+            {
+                return _mm_srli_si128( a, BYTES );
+            }
+        }
+
+        template<std::size_t BYTES>
+        FS_FORCEINLINE __m128d NativeShiftDown( __m128d a )
+        {
+            return _mm_unpackhi_pd( a, a );
+        }
+
+        // Combine upper half into lower half until the first element holds the result
+        // Wider registers are reduced to 128 bits first using NativeSplit
+        template<std::size_t COUNT = 0, typename T, std::size_t N, FastSIMD::FeatureSet SIMD, typename OP>
+        FS_FORCEINLINE T NativeReduce( const Register<T, N, SIMD>& a, OP op )
+        {
+            constexpr std::size_t remaining = COUNT ? COUNT : N;
+
+            if constexpr( sizeof( typename Register<T, N, SIMD>::NativeType ) > 16 )
+            {
+                auto halves = NativeSplit( a.GetNative() );
+
+                return NativeReduce( Register<T, N / 2, SIMD>( op( Register<T, N / 2, SIMD>( halves.first ), Register<T, N / 2, SIMD>( halves.second ) ) ), op );
+            }
+            else if constexpr( remaining > 1 )
+            {
+                Register<T, N, SIMD> shifted = NativeShiftDown<remaining / 2 * sizeof( T )>( a.GetNative() );
+
+                return NativeReduce<remaining / 2>( Register<T, N, SIMD>( op( a, shifted ) ), op );
+            }
+            else
+            {
+                return Extract0( a );
+            }
+        }
+    }
+
+    // Cast is the same for all register widths, NativeCast overloads handle each native type
+    template<typename U, typename T, std::size_t N, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, N, SIMD>>>
+    FS_FORCEINLINE Register<U, N, SIMD> Cast( const Register<T, N, SIMD>& a, TypeDummy<U> )
+    {
+        using NativeU = typename Register<U, N, SIMD>::NativeType;
+
+        if constexpr( std::is_same_v<typename Register<T, N, SIMD>::NativeType, NativeU> )
         {
             return a.GetNative();
         }
+        else
+        {
+            return impl::NativeCast<NativeU>( a.GetNative() );
+        }
+    }
+
+    // Non-temporal stores for each element count, NativeStoreStream overloads handle each native type
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 2, SIMD>>>
+    FS_FORCEINLINE void StoreStream( typename Register<T, 2, SIMD>::ElementType* ptr, const Register<T, 2, SIMD>& a )
+    {
+        impl::NativeStoreStream( ptr, a.GetNative() );
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 4, SIMD>>>
+    FS_FORCEINLINE void StoreStream( typename Register<T, 4, SIMD>::ElementType* ptr, const Register<T, 4, SIMD>& a )
+    {
+        impl::NativeStoreStream( ptr, a.GetNative() );
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 8, SIMD>>>
+    FS_FORCEINLINE void StoreStream( typename Register<T, 8, SIMD>::ElementType* ptr, const Register<T, 8, SIMD>& a )
+    {
+        impl::NativeStoreStream( ptr, a.GetNative() );
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename = EnableIfNative<Register<T, 16, SIMD>>>
+    FS_FORCEINLINE void StoreStream( typename Register<T, 16, SIMD>::ElementType* ptr, const Register<T, 16, SIMD>& a )
+    {
+        impl::NativeStoreStream( ptr, a.GetNative() );
+    }
+
+    // Reductions for each element count, NativeReduce handles each native type
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename OP, typename = EnableIfNative<Register<T, 2, SIMD>>>
+    FS_FORCEINLINE T Reduce( const Register<T, 2, SIMD>& a, OP op )
+    {
+        return impl::NativeReduce( a, op );
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename OP, typename = EnableIfNative<Register<T, 4, SIMD>>>
+    FS_FORCEINLINE T Reduce( const Register<T, 4, SIMD>& a, OP op )
+    {
+        return impl::NativeReduce( a, op );
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename OP, typename = EnableIfNative<Register<T, 8, SIMD>>>
+    FS_FORCEINLINE T Reduce( const Register<T, 8, SIMD>& a, OP op )
+    {
+        return impl::NativeReduce( a, op );
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename OP, typename = EnableIfNative<Register<T, 16, SIMD>>>
+    FS_FORCEINLINE T Reduce( const Register<T, 16, SIMD>& a, OP op )
+    {
+        return impl::NativeReduce( a, op );
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename OP, typename = EnableIfNative<Register<T, 32, SIMD>>>
+    FS_FORCEINLINE T Reduce( const Register<T, 32, SIMD>& a, OP op )
+    {
+        return impl::NativeReduce( a, op );
+    }
+
+    template<typename T, FastSIMD::FeatureSet SIMD, typename OP, typename = EnableIfNative<Register<T, 64, SIMD>>>
+    FS_FORCEINLINE T Reduce( const Register<T, 64, SIMD>& a, OP op )
+    {
+        return impl::NativeReduce( a, op );
     }
 }
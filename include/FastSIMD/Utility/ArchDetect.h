@@ -49,7 +49,7 @@
 #define FASTSIMD_FEATURE_VALUE_AVX2() 9
 #define FASTSIMD_FEATURE_VALUE_AVX512() 10
 
-#if defined( __AVX512F__ ) && defined( __AVX512VL__ ) && defined( __AVX512BW__ ) && defined( __AVX512DQ__ )
+#if defined( __AVX512F__ ) && defined( __AVX512VL__ ) && defined( __AVX512BW__ ) && defined( __AVX512DQ__ ) && defined( __AVX512CD__ )
 #define FASTSIMD_FEATURE_DETECT() AVX512
 #elif defined( __AVX2__ )
 #define FASTSIMD_FEATURE_DETECT() AVX2
@@ -98,3 +98,7 @@
 #ifndef FASTSIMD_IS_RELAXED
 #define FASTSIMD_IS_RELAXED 0
 #endif
+
+#ifndef FASTSIMD_IS_DETERMINISTIC
+#define FASTSIMD_IS_DETERMINISTIC 0
+#endif
@@ -22,6 +22,8 @@ namespace FastSIMD
         AVX512_VL,
         AVX512_DQ,
         AVX512_BW,
+        AVX512_CD,
+        AVX512_VPOPCNTDQ,
 
         ARM,
         NEON,
@@ -54,7 +56,7 @@ namespace FastSIMD
         SSE42       =            SSE41 | FeatureFlag::SSE42,
         AVX         =            SSE42 | FeatureFlag::AVX,
         AVX2        =              AVX | FeatureFlag::AVX2,
-        AVX512      =             AVX2 | FeatureFlag::AVX512_F | FeatureFlag::AVX512_VL | FeatureFlag::AVX512_DQ | FeatureFlag::AVX512_BW,
+        AVX512      =             AVX2 | FeatureFlag::AVX512_F | FeatureFlag::AVX512_VL | FeatureFlag::AVX512_DQ | FeatureFlag::AVX512_BW | FeatureFlag::AVX512_CD,
 
         NEON        = FeatureFlag::ARM | FeatureFlag::NEON,
         AARCH64     =             NEON | FeatureFlag::AARCH64,
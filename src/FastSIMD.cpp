@@ -186,6 +186,14 @@ namespace FastSIMD
             supportedFlags = supportedFlags | FeatureFlag::AVX512_BW;
         // AVX512BW supported
 
+        if( ( abcd[1] >> 28 & 1 ) == 1 )
+            supportedFlags = supportedFlags | FeatureFlag::AVX512_CD;
+        // AVX512CD supported
+
+        if( ( abcd[2] >> 14 & 1 ) == 1 )
+            supportedFlags = supportedFlags | FeatureFlag::AVX512_VPOPCNTDQ;
+        // AVX512VPOPCNTDQ supported, not part of any FeatureSet
+
         return supportedFlags;
     }
 
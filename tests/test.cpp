@@ -7,6 +7,8 @@
 #include <algorithm>
 #include <memory>
 #include <random>
+#include <limits>
+#include <cmath>
 #include <string>
 
 #include <FastSIMD/simd_test_config.h>
@@ -15,6 +17,8 @@ static constexpr size_t TestCount = 4096 * 4096;
 
 static int  * rndInts;
 static float* rndFloats;
+static int64_t* rndInt64s;
+static double* rndDoubles;
 
 static float GenFiniteFloat( std::mt19937& gen )
 {
@@ -33,12 +37,31 @@ static float GenFiniteFloat( std::mt19937& gen )
     return u.f;
 }
 
+static double GenFiniteDouble( std::mt19937& gen )
+{
+    union
+    {
+        double f;
+        uint64_t i;
+    } u;
+
+    do
+    {
+        u.i = ( static_cast<uint64_t>( gen() ) << 32 ) | gen();
+
+    } while( !std::isfinite( u.f ) );
+
+    return u.f;
+}
+
 static void GenerateRandomValues()
 {
     std::cout << "Generating random values..." << std::endl;
 
     rndInts = new int[TestCount + 1024];
     rndFloats = new float[TestCount + 1024];
+    rndInt64s = new int64_t[TestCount + 1024];
+    rndDoubles = new double[TestCount + 1024];
 
     std::random_device rd;  //Will be used to obtain a seed for the random number engine
     std::mt19937 gen( rd() ); //Standard mersenne_twister_engine seeded with rd()
@@ -47,6 +70,8 @@ static void GenerateRandomValues()
     {
         rndInts[i] = (int)gen();
         rndFloats[i] = GenFiniteFloat( gen );
+        rndInt64s[i] = static_cast<int64_t>( ( static_cast<uint64_t>( gen() ) << 32 ) | gen() );
+        rndDoubles[i] = GenFiniteDouble( gen );
     }
 
     //std::sort( rndFloats, rndFloats + TestCount + 1024, std::less() );
@@ -77,14 +102,21 @@ struct TestRunner
             {
                 std::cout << "Generating Tests: " << FastSIMD::GetFeatureSetString( HEAD ) << std::endl;
                 {
-                    std::unique_ptr<TestFastSIMD<RegisterBytes, true>> testSimd( FastSIMD::NewDispatchClass<TestFastSIMD<RegisterBytes, true>>( HEAD ) );
+                    std::unique_ptr<TestFastSIMD<RegisterBytes, false, true>> testSimd( FastSIMD::NewDispatchClass<TestFastSIMD<RegisterBytes, false, true>>( HEAD ) );
 
                     TestCollection simdCollection = testSimd->RegisterTests();
 
                     collections.insert( collections.begin(), simdCollection.begin(), simdCollection.end() );
                 }
                 {
-                    std::unique_ptr<TestFastSIMD<RegisterBytes, false>> testSimd( FastSIMD::NewDispatchClass<TestFastSIMD<RegisterBytes, false>>( HEAD ) );
+                    std::unique_ptr<TestFastSIMD<RegisterBytes, true, false>> testSimd( FastSIMD::NewDispatchClass<TestFastSIMD<RegisterBytes, true, false>>( HEAD ) );
+
+                    TestCollection simdCollection = testSimd->RegisterTests();
+
+                    collections.insert( collections.begin(), simdCollection.begin(), simdCollection.end() );
+                }
+                {
+                    std::unique_ptr<TestFastSIMD<RegisterBytes, false, false>> testSimd( FastSIMD::NewDispatchClass<TestFastSIMD<RegisterBytes, false, false>>( HEAD ) );
 
                     TestCollection simdCollection = testSimd->RegisterTests();
 
@@ -124,28 +156,48 @@ struct TestRunner
     };
 
     // get value of least significant bit
-    static float DeltaUnit( float x )
+    template<typename T>
+    static T DeltaUnit( T x )
     {
-        union
-        {
-            float f;
-            uint32_t i;
-        } u;
         x = std::fabs( x );
 
         if( !std::isfinite( x ) )
         {
-            return 1.f;
+            return T( 1 );
+        }
+        if( x == T( 0 ) || !std::isnormal( x ) )
+        {
+            return std::numeric_limits<T>::min(); // smallest positive normal number
         }
-        if( x == 0.f || !std::isnormal( x ) )
+        return std::nextafter( x, std::numeric_limits<T>::infinity() ) - x;
+    }
+
+    // 8 bit ints would print as chars
+    template<typename T>
+    static auto Printable( T x )
+    {
+        if constexpr( sizeof( T ) == 1 && !std::is_same_v<T, bool> )
+        {
+            return static_cast<int>( x );
+        }
+        else
         {
-            u.i = 0x00800000; // smallest positive normal number
-            return u.f;
+            return x;
+        }
+    }
+
+    // std::abs is ambiguous for unsigned types
+    template<typename T>
+    static auto AbsDiff( T a, T b )
+    {
+        if constexpr( std::is_unsigned_v<T> && !std::is_same_v<T, bool> )
+        {
+            return a > b ? a - b : b - a;
+        }
+        else
+        {
+            return std::abs( a - b );
         }
-        float x1 = x;
-        u.f = x;
-        u.i++;
-        return u.f - x1;
     }
 
     template<typename T>
@@ -169,7 +221,7 @@ struct TestRunner
                         continue;
                     }
 
-                    relativeDif = std::abs( typedScalar[idx] - typedSimd[idx] ) / DeltaUnit( typedScalar[idx] );
+                    relativeDif = static_cast<float>( std::abs( typedScalar[idx] - typedSimd[idx] ) / DeltaUnit( typedScalar[idx] ) );
 
                     if( relativeDif <= accuracy )
                     {
@@ -182,9 +234,9 @@ struct TestRunner
                     std::cerr << "--- " << FastSIMD::GetFeatureSetString( featureSet ) << " FAILED ---" << std::endl;
                 }
                 std::cerr << "idx " << idx << ": " << testName
-                          << " Expected \"" << typedScalar[idx]
-                          << "\" Actual \"" << typedSimd[idx]
-                          << "\" Diff \"" << std::abs( typedScalar[idx] - typedSimd[idx] ) << "\"";
+                          << " Expected \"" << Printable( typedScalar[idx] )
+                          << "\" Actual \"" << Printable( typedSimd[idx] )
+                          << "\" Diff \"" << AbsDiff( typedScalar[idx], typedSimd[idx] ) << "\"";
 
                 if( relativeDif != 0.0f )
                 {
@@ -208,8 +260,29 @@ struct TestRunner
         case TestData::ReturnType::f32:
             return CompareTyped<float>( testName, featureSet, accuracy, outputCount, scalarResults, simdResults );
 
+        case TestData::ReturnType::f64:
+            return CompareTyped<double>( testName, featureSet, accuracy, outputCount, scalarResults, simdResults );
+
         case TestData::ReturnType::i32:
             return CompareTyped<int32_t>( testName, featureSet, accuracy, outputCount, scalarResults, simdResults );
+
+        case TestData::ReturnType::u32:
+            return CompareTyped<uint32_t>( testName, featureSet, accuracy, outputCount, scalarResults, simdResults );
+
+        case TestData::ReturnType::i64:
+            return CompareTyped<int64_t>( testName, featureSet, accuracy, outputCount, scalarResults, simdResults );
+
+        case TestData::ReturnType::i8:
+            return CompareTyped<int8_t>( testName, featureSet, accuracy, outputCount, scalarResults, simdResults );
+
+        case TestData::ReturnType::u8:
+            return CompareTyped<uint8_t>( testName, featureSet, accuracy, outputCount, scalarResults, simdResults );
+
+        case TestData::ReturnType::i16:
+            return CompareTyped<int16_t>( testName, featureSet, accuracy, outputCount, scalarResults, simdResults );
+
+        case TestData::ReturnType::u16:
+            return CompareTyped<uint16_t>( testName, featureSet, accuracy, outputCount, scalarResults, simdResults );
         }
 
         return false;
@@ -220,6 +293,7 @@ struct TestRunner
         std::cout << "Testing: " << testName << std::endl;
 
         char* scalarResults = new char[RegisterBytes];
+        char* deterministicResults = new char[RegisterBytes];
         char* simdResults   = new char[RegisterBytes];
         int failed = 0;
 
@@ -228,11 +302,12 @@ struct TestRunner
             for( size_t testIdx = 0; testIdx < tests.size(); testIdx++ )
             {               
                 TestData& test = tests[testIdx];
+                bool isDeterministicScalar = test.deterministic && test.featureSet == FastSIMD::FeatureSet::SCALAR;
             
-                char* resultsOut = testIdx ? simdResults : scalarResults;
+                char* resultsOut = !testIdx ? scalarResults : isDeterministicScalar ? deterministicResults : simdResults;
                 std::memset( resultsOut, (int)testIdx, RegisterBytes );
                 
-                size_t outputCount = test.testFunc( resultsOut, idx, rndInts, rndFloats );
+                size_t outputCount = test.testFunc( resultsOut, idx, rndInts, rndFloats, rndInt64s, rndDoubles );
 
                 if( testIdx )
                 {
@@ -241,24 +316,41 @@ struct TestRunner
                         std::cerr << "Tests do not match: " << testName; 
                         throw std::exception();
                     }
-                    if( test.featureSet == FastSIMD::FeatureSet::SCALAR && !test.relaxed )
+                    if( test.featureSet == FastSIMD::FeatureSet::SCALAR && !test.relaxed && !test.deterministic )
                     {
                         std::cerr << "Multiple tests with same name: " << testName; 
                         throw std::exception();
                     }
 
                     std::string testNameRelaxed = testName.data();
-                    float accuracy = 0;
+                    float accuracy = test.accuracy;
+                    char* expectedResults = scalarResults;
+                    char* actualResults = simdResults;
 
                     if( test.relaxed )
                     {
                         testNameRelaxed += " RELAXED";
-                        accuracy = test.relaxedAccuracy;
+                        accuracy = std::max( test.accuracy, test.relaxedAccuracy );
+                    }
+                    else if( test.deterministic )
+                    {
+                        testNameRelaxed += " DETERMINISTIC";
+
+                        // DETERMINISTIC SCALAR may trade accuracy for consistency, other FeatureSets must match it exactly
+                        if( isDeterministicScalar )
+                        {
+                            accuracy = std::max( test.accuracy, test.relaxedAccuracy );
+                            actualResults = deterministicResults;
+                        }
+                        else
+                        {
+                            expectedResults = deterministicResults;
+                        }
                     }
 
-                    if( !CompareOutputs( testNameRelaxed, test.featureSet, test.returnType, accuracy, outputCount, scalarResults, simdResults ) )
+                    if( !CompareOutputs( testNameRelaxed, test.featureSet, test.returnType, accuracy, outputCount, expectedResults, actualResults ) )
                     {
-                        std::cerr << "Inputs: " << tests[0].inputsFunc( idx, rndInts, rndFloats ) << std::endl;
+                        std::cerr << "Inputs: " << tests[0].inputsFunc( idx, rndInts, rndFloats, rndInt64s, rndDoubles ) << std::endl;
                         failed++;
                     }
                 }
@@ -277,6 +369,7 @@ struct TestRunner
         }
         
         delete[] scalarResults;
+        delete[] deterministicResults;
         delete[] simdResults;
     }
 
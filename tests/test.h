@@ -14,19 +14,21 @@ struct TestResult
     uint8_t returnCount;
 };
 
-using TestFunction = size_t ( void*, size_t, int32_t*, float* );
-using InputsFunction = std::string ( size_t, int32_t*, float* );
+using TestFunction = size_t ( void*, size_t, int32_t*, float*, int64_t*, double* );
+using InputsFunction = std::string ( size_t, int32_t*, float*, int64_t*, double* );
 
 struct TestData
 {
     enum class ReturnType
     {
-        boolean, f32, i32
+        boolean, f32, f64, i32, u32, i64, i8, u8, i16, u16
     };
     
     FastSIMD::FeatureSet featureSet;
     bool relaxed;
+    bool deterministic;
     ReturnType returnType;
+    float accuracy = 0;
     float relaxedAccuracy = 0;
     std::function<TestFunction> testFunc;
     std::function<InputsFunction> inputsFunc;
@@ -34,7 +36,7 @@ struct TestData
 
 using TestCollection = std::vector<std::pair<std::string_view, TestData>>;
 
-template<size_t RegisterBytes, bool Relaxed>
+template<size_t RegisterBytes, bool Relaxed, bool Deterministic>
 class TestFastSIMD
 {
 public:
@@ -1,5 +1,7 @@
 #pragma once
+#include <array>
 #include <bitset>
+#include <cmath>
 
 #include "test.h"
 
@@ -45,12 +47,54 @@ struct GetReturn<int32_t>
     static constexpr auto Type = TestData::ReturnType::i32;
 };
 
+template<>
+struct GetReturn<uint32_t>
+{
+    static constexpr auto Type = TestData::ReturnType::u32;
+};
+
+template<>
+struct GetReturn<int64_t>
+{
+    static constexpr auto Type = TestData::ReturnType::i64;
+};
+
+template<>
+struct GetReturn<int8_t>
+{
+    static constexpr auto Type = TestData::ReturnType::i8;
+};
+
+template<>
+struct GetReturn<uint8_t>
+{
+    static constexpr auto Type = TestData::ReturnType::u8;
+};
+
+template<>
+struct GetReturn<int16_t>
+{
+    static constexpr auto Type = TestData::ReturnType::i16;
+};
+
+template<>
+struct GetReturn<uint16_t>
+{
+    static constexpr auto Type = TestData::ReturnType::u16;
+};
+
 template<>
 struct GetReturn<float>
 {
     static constexpr auto Type = TestData::ReturnType::f32;
 };
 
+template<>
+struct GetReturn<double>
+{
+    static constexpr auto Type = TestData::ReturnType::f64;
+};
+
 template<>
 struct GetReturn<bool>
 {
@@ -76,8 +120,8 @@ template<typename T, size_t N, FastSIMD::FeatureSet S>
 static constexpr size_t GetReturnCount<FS::Register<T, N, S>> = N;
 
 
-template<FastSIMD::FeatureSet SIMD, size_t RegisterBytes, bool Relaxed>
-class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : public TestFastSIMD<RegisterBytes, Relaxed>
+template<FastSIMD::FeatureSet SIMD, size_t RegisterBytes, bool Relaxed, bool Deterministic>
+class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed, Deterministic>, SIMD> : public TestFastSIMD<RegisterBytes, Relaxed, Deterministic>
 {
     template<typename T>
     using TestReg = FS::Register<T, RegisterBytes / sizeof( T )>;
@@ -94,7 +138,17 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
     static std::string AsString( T arg )
     {
         std::stringstream ss;
-        ss << std::setprecision( 16 ) << std::boolalpha << arg;
+        ss << std::setprecision( 16 ) << std::boolalpha;
+
+        // Print 8 bit ints as numbers rather than chars
+        if constexpr( sizeof( T ) == 1 && !std::is_same_v<T, bool> )
+        {
+            ss << static_cast<int>( arg );
+        }
+        else
+        {
+            ss << arg;
+        }
         return ss.str();
     }
 
@@ -164,6 +218,56 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
         return N;
     }
 
+    // Fixed lookup table for gather tests, indices are masked into range
+    template<typename T>
+    static const T* GatherTable()
+    {
+        static const std::array<T, 256> table = []()
+        {
+            std::array<T, 256> values;
+            for( size_t idx = 0; idx < values.size(); idx++ )
+            {
+                values[idx] = static_cast<T>( static_cast<int32_t>( idx * 37 ) - 4000 );
+            }
+            return values;
+        }();
+        return table.data();
+    }
+
+    // Compile time shuffle patterns for shuffle tests, reversing all elements and reversing within groups of 4
+    template<typename T, size_t N, FastSIMD::FeatureSet S, size_t... I>
+    static FS::Register<T, N, S> ShuffleReverse( const FS::Register<T, N, S>& a, std::index_sequence<I...> )
+    {
+        return FS::Shuffle<( N - 1 - I )...>( a );
+    }
+
+    template<typename T, size_t N, FastSIMD::FeatureSet S, size_t... I>
+    static FS::Register<T, N, S> ShuffleReverseQuads( const FS::Register<T, N, S>& a, std::index_sequence<I...> )
+    {
+        return FS::Shuffle<( ( I & ~size_t( 3 ) ) | ( 3 - ( I & 3 ) ) )...>( a );
+    }
+
+
+    // SCALAR returns the double precision reference rounded to float, so accuracy tiers are checked against true results
+    template<typename FUNC, typename REF, size_t N, FastSIMD::FeatureSet S>
+    static FS::Register<float, N, S> ReferenceOr( const FS::Register<float, N, S>& a, FUNC func, REF ref )
+    {
+        if constexpr( SIMD == FastSIMD::FeatureSet::SCALAR )
+        {
+            float values[N];
+            FS::Store( values, a );
+
+            for( float& value : values )
+            {
+                value = static_cast<float>( ref( static_cast<double>( value ) ) );
+            }
+            return FS::Load<N>( values );
+        }
+        else
+        {
+            return func( a );
+        }
+    }
 
     template<typename T>
     struct GenArg
@@ -197,11 +301,16 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
         }
     };
 
+    template<size_t MN, bool MB>
+    using MaskRndType = std::conditional_t<MN == 8, int8_t,
+                        std::conditional_t<MN == 16, int16_t,
+                        std::conditional_t<MN == 64, std::conditional_t<MB, double, int64_t>, std::conditional_t<MB, float, int>>>>;
+
     template<size_t MN, bool MB, size_t N, FastSIMD::FeatureSet S>
     struct GenArg<FS::Register<FS::Mask<MN, MB>, N, S>>
     {
         template<typename... ARGs>
-        static FS::Register<FS::Mask<MN, MB>, N, S> Load( size_t inIdx, size_t argIdx, std::conditional_t<MB, float, int>* rnd, ARGs... )
+        static FS::Register<FS::Mask<MN, MB>, N, S> Load( size_t inIdx, size_t argIdx, MaskRndType<MN, MB>* rnd, ARGs... )
         {
             return FS::Load<N>( rnd + inIdx + argIdx * N ) > FS::Load<N>( rnd + inIdx + argIdx * N + 1 );
         }
@@ -224,10 +333,10 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
 
         static std::function<TestFunction> Create( FUNC func )
         {
-            return [func]( void* outResult, size_t inIdx, int32_t* rndInts, float* rndFloats )
+            return [func]( void* outResult, size_t inIdx, int32_t* rndInts, float* rndFloats, int64_t* rndInt64s, double* rndDoubles )
             {
                 size_t argIdx = 0;
-                auto tuple = std::tuple{ GenArg<std::decay_t<ARGs>>::Load( inIdx, argIdx++, rndInts, rndFloats )... };
+                auto tuple = std::tuple{ GenArg<std::decay_t<ARGs>>::Load( inIdx, argIdx++, rndInts, rndFloats, rndInt64s, rndDoubles, reinterpret_cast<int8_t*>( rndInts ), reinterpret_cast<uint8_t*>( rndInts ), reinterpret_cast<int16_t*>( rndInts ), reinterpret_cast<uint16_t*>( rndInts ), reinterpret_cast<uint32_t*>( rndInts ) )... };
 
                 return StoreOutput( outResult, std::apply( func, tuple ) );
             };
@@ -235,7 +344,7 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
 
         static std::function<InputsFunction> GetInputs()
         {
-            return []( size_t inIdx, int32_t* rndInts, float* rndFloats ) -> std::string
+            return []( size_t inIdx, int32_t* rndInts, float* rndFloats, int64_t* rndInt64s, double* rndDoubles ) -> std::string
             {
                 if( !sizeof...( ARGs ) )
                 {
@@ -243,7 +352,7 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
                 }
 
                 size_t argIdx = 0;
-                std::initializer_list<std::string> tuple = { AsString( GenArg<std::decay_t<ARGs>>::Load( inIdx, argIdx++, rndInts, rndFloats ) )... };
+                std::initializer_list<std::string> tuple = { AsString( GenArg<std::decay_t<ARGs>>::Load( inIdx, argIdx++, rndInts, rndFloats, rndInt64s, rndDoubles, reinterpret_cast<int8_t*>( rndInts ), reinterpret_cast<uint8_t*>( rndInts ), reinterpret_cast<int16_t*>( rndInts ), reinterpret_cast<uint16_t*>( rndInts ), reinterpret_cast<uint32_t*>( rndInts ) ) )... };
 
                 std::ostringstream inputsString;
                 inputsString << "\n";
@@ -264,6 +373,7 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
         TestData data;
         data.featureSet = SIMD;
         data.relaxed = FastSIMD::IsRelaxed();
+        data.deterministic = FastSIMD::IsDeterministic();
         data.returnType = GetReturn<typename TestFunctionFactory<FUNC>::ReturnType>::Type;
 
         data.testFunc = TestFunctionFactory<FUNC>::Create( func );
@@ -284,6 +394,11 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
 
         RegisterTest( tests, "m32 bit mask", []( TestRegm32 a ) { return a; } );
         RegisterTest( tests, "m32 any mask", []( TestRegm32 a ) { return FS::AnyMask( a ); } );
+        RegisterTest( tests, "m32 all mask", []( TestRegm32 a, TestRegm32 b, TestRegm32 c ) { return FS::AllMask( a | b | c ); } );
+        RegisterTest( tests, "m32 none mask", []( TestRegm32 a, TestRegm32 b, TestRegm32 c ) { return FS::NoneMask( a & b & c ); } );
+        RegisterTest( tests, "m32 count true", []( TestRegm32 a ) { return FS::CountTrue( a ); } );
+        RegisterTest( tests, "m32 first true index", []( TestRegm32 a, TestRegm32 b ) { return FS::FirstTrueIndex( a & b ); } );
+        RegisterTest( tests, "m32 last true index", []( TestRegm32 a, TestRegm32 b ) { return FS::LastTrueIndex( a & b ); } );
 
         RegisterTest( tests, "m32 bit and operator", std::bit_and<TestRegm32>() );
         RegisterTest( tests, "m32 bit or operator", std::bit_or<TestRegm32>() );
@@ -304,6 +419,11 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
         RegisterTest( tests, "i32 load scalar", []( int32_t a ) { return TestRegi32( a ); } );
         RegisterTest( tests, "i32 splat", []( int32_t a ) { return FS::Splat<TestRegi32::ElementCount>( a ); } );
         RegisterTest( tests, "i32 extract 0", []( TestRegi32 a ) { return FS::Extract0( a ); } );
+        RegisterTest( tests, "i32 reduce add", []( TestRegi32 a ) { return FS::ReduceAdd( a ); } );
+        RegisterTest( tests, "i32 reduce min", []( TestRegi32 a ) { return FS::ReduceMin( a ); } );
+        RegisterTest( tests, "i32 reduce max", []( TestRegi32 a ) { return FS::ReduceMax( a ); } );
+        RegisterTest( tests, "i32 reduce and", []( TestRegi32 a ) { return FS::ReduceAnd( a ); } );
+        RegisterTest( tests, "i32 reduce or", []( TestRegi32 a ) { return FS::ReduceOr( a ); } );
         RegisterTest( tests, "i32 load incremented", []() { return FS::LoadIncremented<TestRegi32>(); } );
 
         RegisterTest( tests, "i32 plus operator", std::plus<TestRegi32>() );
@@ -327,8 +447,24 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
         RegisterTest( tests, "i32 bit shift right scalar", []( TestRegi32 a, int b ) { return a >> ( b & 31 ); } );
         RegisterTest( tests, "i32 bit shift right zero extend scalar", []( TestRegi32 a, int b ) { return FS::BitShiftRightZeroExtend( a, b & 31 ); } );
 
-        //RegisterTest( tests, "i32 bit shift left", []( TestRegi32 a, TestRegi32 b ) { return a << FS::Min( TestRegi32( 31 ), FS::Abs( b ) ); } );
-        //RegisterTest( tests, "i32 bit shift right", []( TestRegi32 a, TestRegi32 b ) { return a >> FS::Min( TestRegi32( 31 ), FS::Abs( b ) ); } );
+        RegisterTest( tests, "i32 bit shift left", []( TestRegi32 a, TestRegi32 b ) { return a << FS::Min( TestRegi32( 31 ), FS::Abs( b ) ); } );
+        RegisterTest( tests, "i32 bit shift right", []( TestRegi32 a, TestRegi32 b ) { return a >> FS::Min( TestRegi32( 31 ), FS::Abs( b ) ); } );
+        RegisterTest( tests, "i32 bit shift right zero extend", []( TestRegi32 a, TestRegi32 b ) { return FS::BitShiftRightZeroExtend( a, FS::Min( TestRegi32( 31 ), FS::Abs( b ) ) ); } );
+
+        RegisterTest( tests, "i32 mul hi", []( TestRegi32 a, TestRegi32 b ) { return FS::MulHi( a, b ); } );
+        RegisterTest( tests, "i32 mul widen even", []( TestRegi32 a, TestRegi32 b ) { return FS::MulWidenEven( a, b ); } );
+        RegisterTest( tests, "i32 mul widen odd", []( TestRegi32 a, TestRegi32 b ) { return FS::MulWidenOdd( a, b ); } );
+        RegisterTest( tests, "i32 add saturate", []( TestRegi32 a, TestRegi32 b ) { return FS::AddSat( a, b ); } );
+        RegisterTest( tests, "i32 sub saturate", []( TestRegi32 a, TestRegi32 b ) { return FS::SubSat( a, b ); } );
+        RegisterTest( tests, "i32 pop count", []( TestRegi32 a ) { return FS::PopCount( a ); } );
+        RegisterTest( tests, "i32 pop count sparse", []( TestRegi32 a, TestRegi32 b ) { return FS::PopCount( a & b & ( a >> 3 ) ); } );
+        RegisterTest( tests, "i32 count leading zeros", []( TestRegi32 a, TestRegi32 b ) { return FS::CountLeadingZeros( FS::BitShiftRightZeroExtend( a, FS::Min( TestRegi32( 31 ), FS::Abs( b ) ) ) ); } );
+        RegisterTest( tests, "i32 count leading zeros full", []( TestRegi32 a ) { return FS::CountLeadingZeros( a ); } );
+        RegisterTest( tests, "i32 count trailing zeros", []( TestRegi32 a, TestRegi32 b ) { return FS::CountTrailingZeros( a << FS::Min( TestRegi32( 31 ), FS::Abs( b ) ) ); } );
+        RegisterTest( tests, "i32 rotate left", []( TestRegi32 a, int b ) { return FS::RotateLeft( a, b ); } );
+        RegisterTest( tests, "i32 div", []( TestRegi32 a, int b ) { return FS::Div( a, FS::IntDivider<int32_t>( b ? b : 1 ) ); } );
+        RegisterTest( tests, "i32 div small", []( TestRegi32 a, int b ) { int d = b >> 22; return FS::Div( a, FS::IntDivider<int32_t>( d ? d : 1 ) ); } );
+        RegisterTest( tests, "i32 mod", []( TestRegi32 a, int b ) { int d = b >> 22; return FS::Mod( a, FS::IntDivider<int32_t>( d ? d : 1 ) ); } );
 
         RegisterTest( tests, "i32 equals operator", []( TestRegi32 a, TestRegi32 b ) { return a == b; } );
         RegisterTest( tests, "i32 equals operator alt", []( TestRegi32 a ) { return a == a; } );
@@ -352,10 +488,104 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
         RegisterTest( tests, "i32 inv masked sub", []( TestRegm32 m, TestRegi32 a, TestRegi32 b ) { return FS::InvMaskedSub( m, a, b ); } );
         RegisterTest( tests, "i32 inv masked mul", []( TestRegm32 m, TestRegi32 a, TestRegi32 b ) { return FS::InvMaskedMul( m, a, b ); } );
 
+        RegisterTest( tests, "i32 gather", []( TestRegi32 a ) { return FS::Gather( GatherTable<int32_t>(), a & TestRegi32( 255 ) ); } );
+        RegisterTest( tests, "i32 masked gather", []( TestRegm32 m, TestRegi32 a ) { return FS::MaskedGather( m, GatherTable<int32_t>(), a & TestRegi32( 255 ) ); } );
+        RegisterTest( tests, "i32 scatter", []( TestRegi32 a, TestRegi32 b ) { int32_t buffer[256] = {}; FS::Scatter( buffer, a & TestRegi32( 255 ), b ); return FS::Gather( (const int32_t*)buffer, a & TestRegi32( 255 ) ); } );
+        RegisterTest( tests, "i32 masked scatter", []( TestRegm32 m, TestRegi32 a, TestRegi32 b ) { int32_t buffer[256] = {}; FS::MaskedScatter( m, buffer, a & TestRegi32( 255 ), b ); return FS::Gather( (const int32_t*)buffer, a & TestRegi32( 255 ) ); } );
+
+        RegisterTest( tests, "i32 load partial", []( TestRegi32 a, TestRegi32 b ) { int32_t buffer[TestRegi32::ElementCount]; FS::Store( buffer, a ); return FS::LoadPartial<TestRegi32>( buffer, FS::Extract0( b & TestRegi32( 255 ) ) % ( TestRegi32::ElementCount + 1 ) ); } );
+        RegisterTest( tests, "i32 store partial", []( TestRegi32 a, TestRegi32 b ) { int32_t buffer[TestRegi32::ElementCount] = {}; FS::StorePartial( buffer, a, FS::Extract0( b & TestRegi32( 255 ) ) % ( TestRegi32::ElementCount + 1 ) ); return FS::Load<TestRegi32>( buffer ); } );
+        RegisterTest( tests, "i32 masked load", []( TestRegm32 m, TestRegi32 a ) { int32_t buffer[TestRegi32::ElementCount]; FS::Store( buffer, a ); return FS::MaskedLoad<TestRegi32>( m, buffer ); } );
+        RegisterTest( tests, "i32 masked store", []( TestRegm32 m, TestRegi32 a ) { int32_t buffer[TestRegi32::ElementCount] = {}; FS::MaskedStore( m, buffer, a ); return FS::Load<TestRegi32>( buffer ); } );
+        RegisterTest( tests, "i32 compress", []( TestRegm32 m, TestRegi32 a ) { return FS::Compress( m, a ); } );
+        RegisterTest( tests, "i32 expand", []( TestRegm32 m, TestRegi32 a ) { return FS::Expand( m, a ); } );
+        RegisterTest( tests, "i32 compress store", []( TestRegm32 m, TestRegi32 a ) { int32_t buffer[TestRegi32::ElementCount] = {}; FS::CompressStore( m, buffer, a ); return FS::Load<TestRegi32>( buffer ); } );
+        RegisterTest( tests, "i32 compress store count", []( TestRegm32 m, TestRegi32 a ) { int32_t buffer[TestRegi32::ElementCount]; return (int)FS::CompressStore( m, buffer, a ); } );
+        RegisterTest( tests, "i32 expand load", []( TestRegm32 m, TestRegi32 a ) { int32_t buffer[TestRegi32::ElementCount]; FS::Store( buffer, a ); return FS::ExpandLoad<TestRegi32>( m, buffer ); } );
+        RegisterTest( tests, "i32 store stream", []( TestRegi32 a ) { alignas( TestRegi32 ) int32_t buffer[TestRegi32::ElementCount]; FS::StoreStream( buffer, a ); FS::StreamFence<TestRegi32::FeatureFlags>(); return FS::Load<TestRegi32>( buffer ); } );
+
+        RegisterTest( tests, "i32 shuffle reverse", []( TestRegi32 a ) { return ShuffleReverse( a, std::make_index_sequence<TestRegi32::ElementCount>{} ); } );
+        RegisterTest( tests, "i32 shuffle reverse quads", []( TestRegi32 a ) { return ShuffleReverseQuads( a, std::make_index_sequence<TestRegi32::ElementCount>{} ); } );
+        RegisterTest( tests, "i32 permute", []( TestRegi32 a, TestRegi32 b ) { return FS::Permute( a, b ); } );
+        RegisterTest( tests, "i32 permute2", []( TestRegi32 a, TestRegi32 b, TestRegi32 c ) { return FS::Permute2( a, b, c ); } );
+
+        RegisterTest( tests, "i32 prefix sum", []( TestRegi32 a ) { return FS::PrefixSum( a ); } );
+        RegisterTest( tests, "i32 prefix sum array", []( TestRegi32 a, TestRegi32 b ) { int32_t buffer[TestRegi32::ElementCount * 2]; FS::Store( buffer, a ); FS::Store( buffer + TestRegi32::ElementCount, b ); FS::PrefixSum<TestRegi32>( buffer, buffer, TestRegi32::ElementCount * 2 - 3 ); return FS::Load<TestRegi32>( buffer + TestRegi32::ElementCount ); } );
+
+        using TestRegu32 = TestReg<uint32_t>;
+
+        RegisterTest( tests, "u32 load store", []( TestRegu32 a ) { return a; } );
+        RegisterTest( tests, "u32 load scalar", []( uint32_t a ) { return TestRegu32( a ); } );
+        RegisterTest( tests, "u32 splat", []( uint32_t a ) { return FS::Splat<TestRegu32::ElementCount>( a ); } );
+        RegisterTest( tests, "u32 extract 0", []( TestRegu32 a ) { return FS::Extract0( a ); } );
+        RegisterTest( tests, "u32 reduce add", []( TestRegu32 a ) { return FS::ReduceAdd( a ); } );
+        RegisterTest( tests, "u32 reduce min", []( TestRegu32 a ) { return FS::ReduceMin( a ); } );
+        RegisterTest( tests, "u32 reduce max", []( TestRegu32 a ) { return FS::ReduceMax( a ); } );
+        RegisterTest( tests, "u32 reduce and", []( TestRegu32 a ) { return FS::ReduceAnd( a ); } );
+        RegisterTest( tests, "u32 reduce or", []( TestRegu32 a ) { return FS::ReduceOr( a ); } );
+        RegisterTest( tests, "u32 load incremented", []() { return FS::LoadIncremented<TestRegu32>(); } );
+
+        RegisterTest( tests, "u32 plus operator", std::plus<TestRegu32>() );
+        RegisterTest( tests, "u32 minus operator", std::minus<TestRegu32>() );
+        RegisterTest( tests, "u32 multiply operator", std::multiplies<TestRegu32>() );
+
+        RegisterTest( tests, "u32 bit and operator", std::bit_and<TestRegu32>() );
+        RegisterTest( tests, "u32 bit or operator", std::bit_or<TestRegu32>() );
+        RegisterTest( tests, "u32 bit xor operator", std::bit_xor<TestRegu32>() );
+        RegisterTest( tests, "u32 bit not operator", std::bit_not<TestRegu32>() );
+        RegisterTest( tests, "u32 negate operator", std::negate<TestRegu32>() );
+        RegisterTest( tests, "u32 bit and not", []( TestRegu32 a, TestRegu32 b ) { return FS::BitwiseAndNot( a, b ); } );
+
+        RegisterTest( tests, "u32 increment", []( TestRegu32 a ) { return FS::Increment( a ); } );
+        RegisterTest( tests, "u32 decrement", []( TestRegu32 a ) { return FS::Decrement( a ); } );
+        RegisterTest( tests, "u32 min", []( TestRegu32 a, TestRegu32 b ) { return FS::Min( a, b ); } );
+        RegisterTest( tests, "u32 max", []( TestRegu32 a, TestRegu32 b ) { return FS::Max( a, b ); } );
+
+        RegisterTest( tests, "u32 bit shift left scalar", []( TestRegu32 a, int b ) { return a << ( b & 31 ); } );
+        RegisterTest( tests, "u32 bit shift right scalar", []( TestRegu32 a, int b ) { return a >> ( b & 31 ); } );
+
+        RegisterTest( tests, "u32 bit shift left", []( TestRegu32 a, TestRegu32 b ) { return a << ( b & TestRegu32( 31 ) ); } );
+        RegisterTest( tests, "u32 bit shift right", []( TestRegu32 a, TestRegu32 b ) { return a >> ( b & TestRegu32( 31 ) ); } );
+
+        RegisterTest( tests, "u32 mul hi", []( TestRegu32 a, TestRegu32 b ) { return FS::MulHi( a, b ); } );
+        RegisterTest( tests, "u32 mul widen even", []( TestRegu32 a, TestRegu32 b ) { return FS::MulWidenEven( a, b ); } );
+        RegisterTest( tests, "u32 mul widen odd", []( TestRegu32 a, TestRegu32 b ) { return FS::MulWidenOdd( a, b ); } );
+        RegisterTest( tests, "u32 add saturate", []( TestRegu32 a, TestRegu32 b ) { return FS::AddSat( a, b ); } );
+        RegisterTest( tests, "u32 sub saturate", []( TestRegu32 a, TestRegu32 b ) { return FS::SubSat( a, b ); } );
+        RegisterTest( tests, "u32 pop count", []( TestRegu32 a ) { return FS::PopCount( a ); } );
+        RegisterTest( tests, "u32 count leading zeros", []( TestRegu32 a, TestRegu32 b ) { return FS::CountLeadingZeros( a >> ( b & TestRegu32( 31 ) ) ); } );
+        RegisterTest( tests, "u32 count trailing zeros", []( TestRegu32 a, TestRegu32 b ) { return FS::CountTrailingZeros( a << ( b & TestRegu32( 31 ) ) ); } );
+        RegisterTest( tests, "u32 rotate left", []( TestRegu32 a, int b ) { return FS::RotateLeft( a, b ); } );
+        RegisterTest( tests, "u32 div", []( TestRegu32 a, uint32_t b ) { return FS::Div( a, FS::IntDivider<uint32_t>( b ? b : 1 ) ); } );
+        RegisterTest( tests, "u32 div small", []( TestRegu32 a, uint32_t b ) { uint32_t d = b >> 22; return FS::Div( a, FS::IntDivider<uint32_t>( d ? d : 1 ) ); } );
+        RegisterTest( tests, "u32 mod", []( TestRegu32 a, uint32_t b ) { uint32_t d = b >> 22; return FS::Mod( a, FS::IntDivider<uint32_t>( d ? d : 1 ) ); } );
+
+        RegisterTest( tests, "u32 equals operator", []( TestRegu32 a, TestRegu32 b ) { return a == b; } );
+        RegisterTest( tests, "u32 equals operator alt", []( TestRegu32 a ) { return a == a; } );
+        RegisterTest( tests, "u32 not equals operator", []( TestRegu32 a, TestRegu32 b ) { return a != b; } );
+        RegisterTest( tests, "u32 less than operator", []( TestRegu32 a, TestRegu32 b ) { return a < b; } );
+        RegisterTest( tests, "u32 greater than operator", []( TestRegu32 a, TestRegu32 b ) { return a > b; } );
+        RegisterTest( tests, "u32 less equal than operator", []( TestRegu32 a, TestRegu32 b ) { return a <= b; } );
+        RegisterTest( tests, "u32 greater equal than operator", []( TestRegu32 a, TestRegu32 b ) { return a >= b; } );
+        RegisterTest( tests, "u32 less equal than operator alt", []( TestRegu32 a ) { return a <= a; } );
+        RegisterTest( tests, "u32 greater equal than operator alt", []( TestRegu32 a ) { return a >= a; } );
+
+        RegisterTest( tests, "u32 select", []( TestRegm32 m, TestRegu32 a, TestRegu32 b ) { return FS::Select( m, a, b ); } );
+        RegisterTest( tests, "u32 masked", []( TestRegm32 m, TestRegu32 a ) { return FS::Masked( m, a ); } );
+        RegisterTest( tests, "u32 inv masked", []( TestRegm32 m, TestRegu32 a ) { return FS::InvMasked( m, a ); } );
+        RegisterTest( tests, "u32 masked increment", []( TestRegm32 m, TestRegu32 a ) { return FS::MaskedIncrement( m, a ); } );
+        RegisterTest( tests, "u32 masked decrement", []( TestRegm32 m, TestRegu32 a ) { return FS::MaskedDecrement( m, a ); } );
+        RegisterTest( tests, "u32 masked add", []( TestRegm32 m, TestRegu32 a, TestRegu32 b ) { return FS::MaskedAdd( m, a, b ); } );
+        RegisterTest( tests, "u32 masked sub", []( TestRegm32 m, TestRegu32 a, TestRegu32 b ) { return FS::MaskedSub( m, a, b ); } );
+        RegisterTest( tests, "u32 masked mul", []( TestRegm32 m, TestRegu32 a, TestRegu32 b ) { return FS::MaskedMul( m, a, b ); } );
+
         RegisterTest( tests, "f32 load store", []( TestRegf32 a ) { return a; } );
         RegisterTest( tests, "f32 load scalar", []( float a ) { return TestRegf32( a ); } );
         RegisterTest( tests, "f32 splat", []( float a ) { return FS::Splat<TestRegf32::ElementCount>( a ); } );
         RegisterTest( tests, "f32 extract 0", []( TestRegf32 a ) { return FS::Extract0( a ); } );
+        RegisterTest( tests, "f32 reduce add", []( TestRegf32 a ) { return FS::ReduceAdd( a ); } );
+        RegisterTest( tests, "f32 reduce min", []( TestRegf32 a ) { return FS::ReduceMin( a ); } );
+        RegisterTest( tests, "f32 reduce max", []( TestRegf32 a ) { return FS::ReduceMax( a ); } );
         RegisterTest( tests, "f32 load incremented", []() { return FS::LoadIncremented<TestRegf32>(); } );
 
         RegisterTest( tests, "f32 plus operator", std::plus<TestRegf32>() );
@@ -367,6 +597,16 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
         RegisterTest( tests, "f32 fused multiply sub", []( TestRegf32 a, TestRegf32 b ) { return FS::FMulSub( a, TestRegf32( -1 ), b ); } );
         RegisterTest( tests, "f32 fused negative multiply add", []( TestRegf32 a, TestRegf32 b ) { return FS::FNMulAdd( a, TestRegf32( -1 ), b ); } );
         RegisterTest( tests, "f32 fused negative multiply sub", []( TestRegf32 a, TestRegf32 b ) { return FS::FNMulSub( a, TestRegf32( -1 ), b ); } );
+        // Inputs are multiples of 1/4 in -2:2 so every intermediate is exact, results must match bit for bit whether or not FMulAdd fuses
+        RegisterTest( tests, "f32 poly horner", []( TestRegf32 a ) {
+            const float coeffs[] = { 1.0f, 0.5f, 0.25f, 0.125f, 0.0625f, 0.03125f, 0.015625f };
+            return FS::PolyHorner( FS::Round( FS::Min( FS::Max( a, TestRegf32( -2.0f ) ), TestRegf32( 2.0f ) ) * TestRegf32( 4.0f ) ) * TestRegf32( 0.25f ), coeffs );
+        } );
+        RegisterTest( tests, "f32 poly estrin", []( TestRegf32 a ) {
+            const float coeffs[] = { 1.0f, 0.5f, 0.25f, 0.125f, 0.0625f, 0.03125f, 0.015625f };
+            return FS::PolyEstrin( FS::Round( FS::Min( FS::Max( a, TestRegf32( -2.0f ) ), TestRegf32( 2.0f ) ) * TestRegf32( 4.0f ) ) * TestRegf32( 0.25f ), coeffs );
+        } );
+        RegisterTest( tests, "f32 poly", []( TestRegf32 a ) { return FS::Poly( FS::Round( FS::Min( FS::Max( a, TestRegf32( -2.0f ) ), TestRegf32( 2.0f ) ) * TestRegf32( 4.0f ) ) * TestRegf32( 0.25f ), 1.0f, 0.5f, 0.25f ); } );
 
         RegisterTest( tests, "f32 bit and operator", std::bit_and<TestRegf32>() );
         RegisterTest( tests, "f32 bit or operator", std::bit_or<TestRegf32>() );
@@ -401,6 +641,51 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
         RegisterTest( tests, "f32 inv masked sub", []( TestRegm32 m, TestRegf32 a, TestRegf32 b ) { return FS::InvMaskedSub( m, a, b ); } );
         RegisterTest( tests, "f32 inv masked mul", []( TestRegm32 m, TestRegf32 a, TestRegf32 b ) { return FS::InvMaskedMul( m, a, b ); } );
 
+        RegisterTest( tests, "f32 gather", []( TestRegi32 a ) { return FS::Gather( GatherTable<float>(), a & TestRegi32( 255 ) ); } );
+        RegisterTest( tests, "f32 masked gather", []( TestRegm32 m, TestRegi32 a ) { return FS::MaskedGather( m, GatherTable<float>(), a & TestRegi32( 255 ) ); } );
+        RegisterTest( tests, "f32 scatter", []( TestRegi32 a, TestRegf32 b ) { float buffer[256] = {}; FS::Scatter( buffer, a & TestRegi32( 255 ), b ); return FS::Gather( (const float*)buffer, a & TestRegi32( 255 ) ); } );
+        RegisterTest( tests, "f32 masked scatter", []( TestRegm32 m, TestRegi32 a, TestRegf32 b ) { float buffer[256] = {}; FS::MaskedScatter( m, buffer, a & TestRegi32( 255 ), b ); return FS::Gather( (const float*)buffer, a & TestRegi32( 255 ) ); } );
+
+        RegisterTest( tests, "f32 load partial", []( TestRegf32 a, TestRegi32 b ) { float buffer[TestRegf32::ElementCount]; FS::Store( buffer, a ); return FS::LoadPartial<TestRegf32>( buffer, FS::Extract0( b & TestRegi32( 255 ) ) % ( TestRegf32::ElementCount + 1 ) ); } );
+        RegisterTest( tests, "f32 store partial", []( TestRegf32 a, TestRegi32 b ) { float buffer[TestRegf32::ElementCount] = {}; FS::StorePartial( buffer, a, FS::Extract0( b & TestRegi32( 255 ) ) % ( TestRegf32::ElementCount + 1 ) ); return FS::Load<TestRegf32>( buffer ); } );
+        RegisterTest( tests, "f32 masked load", []( TestRegm32 m, TestRegf32 a ) { float buffer[TestRegf32::ElementCount]; FS::Store( buffer, a ); return FS::MaskedLoad<TestRegf32>( m, buffer ); } );
+        RegisterTest( tests, "f32 masked store", []( TestRegm32 m, TestRegf32 a ) { float buffer[TestRegf32::ElementCount] = {}; FS::MaskedStore( m, buffer, a ); return FS::Load<TestRegf32>( buffer ); } );
+        RegisterTest( tests, "f32 compress", []( TestRegm32 m, TestRegf32 a ) { return FS::Compress( m, a ); } );
+        RegisterTest( tests, "f32 expand", []( TestRegm32 m, TestRegf32 a ) { return FS::Expand( m, a ); } );
+        RegisterTest( tests, "f32 compress store", []( TestRegm32 m, TestRegf32 a ) { float buffer[TestRegf32::ElementCount] = {}; FS::CompressStore( m, buffer, a ); return FS::Load<TestRegf32>( buffer ); } );
+        RegisterTest( tests, "f32 compress store count", []( TestRegm32 m, TestRegf32 a ) { float buffer[TestRegf32::ElementCount]; return (int)FS::CompressStore( m, buffer, a ); } );
+        RegisterTest( tests, "f32 expand load", []( TestRegm32 m, TestRegf32 a ) { float buffer[TestRegf32::ElementCount]; FS::Store( buffer, a ); return FS::ExpandLoad<TestRegf32>( m, buffer ); } );
+        RegisterTest( tests, "f32 store stream", []( TestRegf32 a ) { alignas( TestRegf32 ) float buffer[TestRegf32::ElementCount]; FS::StoreStream( buffer, a ); FS::StreamFence<TestRegf32::FeatureFlags>(); return FS::Load<TestRegf32>( buffer ); } );
+        RegisterTest( tests, "f32 prefetch", []( TestRegf32 a ) { float buffer[TestRegf32::ElementCount]; FS::Store( buffer, a ); FS::Prefetch<0>( buffer ); FS::Prefetch<1>( buffer ); FS::Prefetch<2>( buffer ); FS::Prefetch( buffer ); return FS::Load<TestRegf32>( buffer ); } );
+
+        RegisterTest( tests, "f32 shuffle reverse", []( TestRegf32 a ) { return ShuffleReverse( a, std::make_index_sequence<TestRegf32::ElementCount>{} ); } );
+        RegisterTest( tests, "f32 shuffle reverse quads", []( TestRegf32 a ) { return ShuffleReverseQuads( a, std::make_index_sequence<TestRegf32::ElementCount>{} ); } );
+        RegisterTest( tests, "f32 permute", []( TestRegf32 a, TestRegi32 b ) { return FS::Permute( a, b ); } );
+        RegisterTest( tests, "f32 permute2", []( TestRegf32 a, TestRegf32 b, TestRegi32 c ) { return FS::Permute2( a, b, c ); } );
+
+        // Integer valued inputs keep float sums exact regardless of summation order
+        RegisterTest( tests, "f32 prefix sum", []( TestRegi32 a ) { return FS::PrefixSum( FS::Convert<float>( a & TestRegi32( 0xFFFF ) ) ); } );
+        RegisterTest( tests, "f32 prefix sum array", []( TestRegi32 a, TestRegi32 b ) { float buffer[TestRegf32::ElementCount * 2]; FS::Store( buffer, FS::Convert<float>( a & TestRegi32( 0xFFFF ) ) ); FS::Store( buffer + TestRegf32::ElementCount, FS::Convert<float>( b & TestRegi32( 0xFFFF ) ) ); FS::PrefixSum<TestRegf32>( buffer, buffer, TestRegf32::ElementCount * 2 - 3 ); return FS::Load<TestRegf32>( buffer + TestRegf32::ElementCount ); } );
+
+        RegisterTest( tests, "f32 load interleaved2 0", []( TestRegf32 a, TestRegf32 b ) { float buffer[TestRegf32::ElementCount * 2]; FS::Store( buffer, a ); FS::Store( buffer + TestRegf32::ElementCount, b ); return FS::LoadInterleaved2<TestRegf32>( buffer )[0]; } );
+        RegisterTest( tests, "f32 load interleaved2 1", []( TestRegf32 a, TestRegf32 b ) { float buffer[TestRegf32::ElementCount * 2]; FS::Store( buffer, a ); FS::Store( buffer + TestRegf32::ElementCount, b ); return FS::LoadInterleaved2<TestRegf32>( buffer )[1]; } );
+        RegisterTest( tests, "f32 load interleaved3 0", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 3]; FS::Store( buffer, a ); FS::Store( buffer + TestRegf32::ElementCount, b ); FS::Store( buffer + TestRegf32::ElementCount * 2, c ); return FS::LoadInterleaved3<TestRegf32>( buffer )[0]; } );
+        RegisterTest( tests, "f32 load interleaved3 1", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 3]; FS::Store( buffer, a ); FS::Store( buffer + TestRegf32::ElementCount, b ); FS::Store( buffer + TestRegf32::ElementCount * 2, c ); return FS::LoadInterleaved3<TestRegf32>( buffer )[1]; } );
+        RegisterTest( tests, "f32 load interleaved3 2", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 3]; FS::Store( buffer, a ); FS::Store( buffer + TestRegf32::ElementCount, b ); FS::Store( buffer + TestRegf32::ElementCount * 2, c ); return FS::LoadInterleaved3<TestRegf32>( buffer )[2]; } );
+        RegisterTest( tests, "f32 load interleaved4 0", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 4]; FS::Store( buffer, a ); FS::Store( buffer + TestRegf32::ElementCount, b ); FS::Store( buffer + TestRegf32::ElementCount * 2, c ); FS::Store( buffer + TestRegf32::ElementCount * 3, -a ); return FS::LoadInterleaved4<TestRegf32>( buffer )[0]; } );
+        RegisterTest( tests, "f32 load interleaved4 1", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 4]; FS::Store( buffer, a ); FS::Store( buffer + TestRegf32::ElementCount, b ); FS::Store( buffer + TestRegf32::ElementCount * 2, c ); FS::Store( buffer + TestRegf32::ElementCount * 3, -a ); return FS::LoadInterleaved4<TestRegf32>( buffer )[1]; } );
+        RegisterTest( tests, "f32 load interleaved4 2", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 4]; FS::Store( buffer, a ); FS::Store( buffer + TestRegf32::ElementCount, b ); FS::Store( buffer + TestRegf32::ElementCount * 2, c ); FS::Store( buffer + TestRegf32::ElementCount * 3, -a ); return FS::LoadInterleaved4<TestRegf32>( buffer )[2]; } );
+        RegisterTest( tests, "f32 load interleaved4 3", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 4]; FS::Store( buffer, a ); FS::Store( buffer + TestRegf32::ElementCount, b ); FS::Store( buffer + TestRegf32::ElementCount * 2, c ); FS::Store( buffer + TestRegf32::ElementCount * 3, -a ); return FS::LoadInterleaved4<TestRegf32>( buffer )[3]; } );
+        RegisterTest( tests, "f32 store interleaved2 0", []( TestRegf32 a, TestRegf32 b ) { float buffer[TestRegf32::ElementCount * 2]; FS::StoreInterleaved2( buffer, a, b ); return FS::Load<TestRegf32>( buffer ); } );
+        RegisterTest( tests, "f32 store interleaved2 1", []( TestRegf32 a, TestRegf32 b ) { float buffer[TestRegf32::ElementCount * 2]; FS::StoreInterleaved2( buffer, a, b ); return FS::Load<TestRegf32>( buffer + TestRegf32::ElementCount ); } );
+        RegisterTest( tests, "f32 store interleaved3 0", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 3]; FS::StoreInterleaved3( buffer, a, b, c ); return FS::Load<TestRegf32>( buffer ); } );
+        RegisterTest( tests, "f32 store interleaved3 1", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 3]; FS::StoreInterleaved3( buffer, a, b, c ); return FS::Load<TestRegf32>( buffer + TestRegf32::ElementCount ); } );
+        RegisterTest( tests, "f32 store interleaved3 2", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 3]; FS::StoreInterleaved3( buffer, a, b, c ); return FS::Load<TestRegf32>( buffer + TestRegf32::ElementCount * 2 ); } );
+        RegisterTest( tests, "f32 store interleaved4 0", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 4]; FS::StoreInterleaved4( buffer, a, b, c, -a ); return FS::Load<TestRegf32>( buffer ); } );
+        RegisterTest( tests, "f32 store interleaved4 1", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 4]; FS::StoreInterleaved4( buffer, a, b, c, -a ); return FS::Load<TestRegf32>( buffer + TestRegf32::ElementCount ); } );
+        RegisterTest( tests, "f32 store interleaved4 2", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 4]; FS::StoreInterleaved4( buffer, a, b, c, -a ); return FS::Load<TestRegf32>( buffer + TestRegf32::ElementCount * 2 ); } );
+        RegisterTest( tests, "f32 store interleaved4 3", []( TestRegf32 a, TestRegf32 b, TestRegf32 c ) { float buffer[TestRegf32::ElementCount * 4]; FS::StoreInterleaved4( buffer, a, b, c, -a ); return FS::Load<TestRegf32>( buffer + TestRegf32::ElementCount * 3 ); } );
+
         RegisterTest( tests, "f32 round", []( TestRegf32 a ) { return FS::Round( a ); } );
         RegisterTest( tests, "f32 ceil", []( TestRegf32 a ) { return FS::Ceil( a ); } );
         RegisterTest( tests, "f32 floor", []( TestRegf32 a ) { return FS::Floor( a ); } );
@@ -418,10 +703,37 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
             a = FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 1.e-16f ) ), TestRegf32( 1.e+16f ) ) | FS::SignBit( a );
             return FS::Reciprocal( a );
         } ).relaxedAccuracy = 8192;
+        RegisterTest( tests, "f32 inv sqrt estimate", []( TestRegf32 a ) { return FS::InvSqrt<FS::Precision::Estimate>( FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 1.e-16f ) ), TestRegf32( 1.e+16f ) ) ); } ).relaxedAccuracy = 64;
+        RegisterTest( tests, "f32 inv sqrt newton step", []( TestRegf32 a ) { return FS::InvSqrt<FS::Precision::NewtonStep>( FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 1.e-16f ) ), TestRegf32( 1.e+16f ) ) ); } ).relaxedAccuracy = 64;
+        RegisterTest( tests, "f32 inv sqrt newton step error", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 1.e-16f ) ), TestRegf32( 1.e+16f ) ), []( auto x ) { return FS::InvSqrt<FS::Precision::NewtonStep>( x ); }, []( double x ) { return 1.0 / std::sqrt( x ); } ); } ).accuracy = 24;
+        RegisterTest( tests, "f32 inv sqrt full", []( TestRegf32 a ) { return FS::InvSqrt<FS::Precision::Full>( FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 1.e-16f ) ), TestRegf32( 1.e+16f ) ) ); } );
+        RegisterTest( tests, "f32 reciprocal estimate", []( TestRegf32 a ) {
+            a = FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 1.e-16f ) ), TestRegf32( 1.e+16f ) ) | FS::SignBit( a );
+            return FS::Reciprocal<FS::Precision::Estimate>( a );
+        } ).relaxedAccuracy = 64;
+        RegisterTest( tests, "f32 reciprocal newton step", []( TestRegf32 a ) {
+            a = FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 1.e-16f ) ), TestRegf32( 1.e+16f ) ) | FS::SignBit( a );
+            return FS::Reciprocal<FS::Precision::NewtonStep>( a );
+        } ).relaxedAccuracy = 64;
+        RegisterTest( tests, "f32 reciprocal newton step error", []( TestRegf32 a ) {
+            a = FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 1.e-16f ) ), TestRegf32( 1.e+16f ) ) | FS::SignBit( a );
+            return ReferenceOr( a, []( auto x ) { return FS::Reciprocal<FS::Precision::NewtonStep>( x ); }, []( double x ) { return 1.0 / x; } );
+        } ).accuracy = 24;
+        RegisterTest( tests, "f32 reciprocal full", []( TestRegf32 a ) {
+            a = FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 1.e-16f ) ), TestRegf32( 1.e+16f ) ) | FS::SignBit( a );
+            return FS::Reciprocal<FS::Precision::Full>( a );
+        } );
 
         RegisterTest( tests, "f32 cos", []( TestRegf32 a ) { return FS::Cos( FS::Min( FS::Max( a, TestRegf32( -4096.0f ) ), TestRegf32( 4096.0f ) ) ); } ).relaxedAccuracy = 16384;
         RegisterTest( tests, "f32 sin", []( TestRegf32 a ) { return FS::Sin( FS::Min( FS::Max( a, TestRegf32( -4096.0f ) ), TestRegf32( 4096.0f ) ) ); } ).relaxedAccuracy = 16384;
         RegisterTest( tests, "f32 tan", []( TestRegf32 a ) { return FS::Tan( FS::Min( FS::Max( a, TestRegf32( -4096.0f ) ), TestRegf32( 4096.0f ) ) ); } ).relaxedAccuracy = 16384;
+        RegisterTest( tests, "f32 sincos matches sin cos", []( TestRegf32 a ) {
+            a = FS::Min( FS::Max( a, TestRegf32( -4096.0f ) ), TestRegf32( 4096.0f ) );
+            TestRegf32 sin, cos;
+            FS::SinCos( a, sin, cos );
+            return ( sin == FS::Sin( a ) ) & ( cos == FS::Cos( a ) );
+        } );
+        RegisterTest( tests, "f32 tan from sincos", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -1.5f ) ), TestRegf32( 1.5f ) ), []( auto x ) { return FS::TanFromSinCos( x ); }, []( double x ) { return std::tan( x ); } ); } ).accuracy = 32;
         RegisterTest( tests, "f32 acos", []( TestRegf32 a ) { return FS::ACos( FS::Min( FS::Max( a, TestRegf32( -0.999f ) ), TestRegf32( 0.999f ) ) ); } ).relaxedAccuracy = 8192;
         RegisterTest( tests, "f32 asin", []( TestRegf32 a ) {
             // Clamp to avoid extreme near-zero and near-1 values
@@ -454,6 +766,49 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
             b = FS::Min( FS::Max( b, TestRegf32( -8.0f ) ), TestRegf32( 8.0f ) );
             return FS::Pow( a, b ); 
         } ).relaxedAccuracy = 16384;
+        RegisterTest( tests, "f32 pow int", []( TestRegf32 a, TestRegi32 b ) { 
+            a = FS::Min( FS::Max( a, TestRegf32( -16.0f ) ), TestRegf32( 16.0f ) );
+            b = FS::Min( FS::Max( b, TestRegi32( -24 ) ), TestRegi32( 24 ) );
+            return FS::PowInt( a, b ); 
+        } );
+        RegisterTest( tests, "f32 pow int extremes", []( TestRegf32 a, TestRegi32 b ) { 
+            a = FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 0.5f ) ), TestRegf32( 2.0f ) );
+            return FS::PowInt( a, b ); 
+        } );
+        RegisterTest( tests, "f32 pow 2", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -1.e+16f ) ), TestRegf32( 1.e+16f ) ), []( auto x ) { return FS::Pow<2>( x ); }, []( double x ) { return x * x; } ); } );
+        RegisterTest( tests, "f32 pow 3", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -1.e+12f ) ), TestRegf32( 1.e+12f ) ), []( auto x ) { return FS::Pow<3>( x ); }, []( double x ) { return x * x * x; } ); } ).accuracy = 1;
+        RegisterTest( tests, "f32 pow -2", []( TestRegf32 a ) { return FS::Pow<-2>( FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 1.e-16f ) ), TestRegf32( 1.e+16f ) ) ); } ).relaxedAccuracy = 8192;
+        RegisterTest( tests, "f32 pow 3/2", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 1.e-16f ) ), TestRegf32( 1.e+16f ) ), []( auto x ) { return FS::Pow<3, 2>( x ); }, []( double x ) { return x * std::sqrt( x ); } ); } ).accuracy = 1;
+        RegisterTest( tests, "f32 pow -1/2", []( TestRegf32 a ) { return FS::Pow<-1, 2>( FS::Min( FS::Max( FS::Abs( a ), TestRegf32( 1.e-16f ) ), TestRegf32( 1.e+16f ) ) ); } ).relaxedAccuracy = 8192;
+
+        // Accuracy tiers: Precise within 1 ULP, Fast relative error below 2^-12
+        constexpr float kPreciseAccuracy = 1;
+        constexpr float kFastAccuracy = 4096;
+
+        RegisterTest( tests, "f32 precise sin", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -4096.0f ) ), TestRegf32( 4096.0f ) ), []( auto x ) { return FS::Precise::Sin( x ); }, []( double x ) { return std::sin( x ); } ); } ).accuracy = kPreciseAccuracy;
+        RegisterTest( tests, "f32 precise cos", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -4096.0f ) ), TestRegf32( 4096.0f ) ), []( auto x ) { return FS::Precise::Cos( x ); }, []( double x ) { return std::cos( x ); } ); } ).accuracy = kPreciseAccuracy;
+        RegisterTest( tests, "f32 precise sincos sin", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -4096.0f ) ), TestRegf32( 4096.0f ) ), []( auto x ) { decltype( x ) sin, cos; FS::Precise::SinCos( x, sin, cos ); return sin; }, []( double x ) { return std::sin( x ); } ); } ).accuracy = kPreciseAccuracy;
+        RegisterTest( tests, "f32 precise sincos cos", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -4096.0f ) ), TestRegf32( 4096.0f ) ), []( auto x ) { decltype( x ) sin, cos; FS::Precise::SinCos( x, sin, cos ); return cos; }, []( double x ) { return std::cos( x ); } ); } ).accuracy = kPreciseAccuracy;
+        RegisterTest( tests, "f32 precise exp2", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -126.0f ) ), TestRegf32( 127.0f ) ), []( auto x ) { return FS::Precise::Exp2( x ); }, []( double x ) { return std::exp2( x ); } ); } ).accuracy = kPreciseAccuracy;
+        RegisterTest( tests, "f32 precise exp", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -87.0f ) ), TestRegf32( 88.0f ) ), []( auto x ) { return FS::Precise::Exp( x ); }, []( double x ) { return std::exp( x ); } ); } ).accuracy = kPreciseAccuracy;
+        RegisterTest( tests, "f32 precise log2", []( TestRegf32 a ) { return ReferenceOr( FS::Max( FS::Abs( a ), TestRegf32( 1.17549435e-38f ) ), []( auto x ) { return FS::Precise::Log2( x ); }, []( double x ) { return std::log2( x ); } ); } ).accuracy = kPreciseAccuracy;
+        RegisterTest( tests, "f32 precise log", []( TestRegf32 a ) { return ReferenceOr( FS::Max( FS::Abs( a ), TestRegf32( 1.17549435e-38f ) ), []( auto x ) { return FS::Precise::Log( x ); }, []( double x ) { return std::log( x ); } ); } ).accuracy = kPreciseAccuracy;
+
+        RegisterTest( tests, "f32 fast sin", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -4096.0f ) ), TestRegf32( 4096.0f ) ), []( auto x ) { return FS::Fast::Sin( x ); }, []( double x ) { return std::sin( x ); } ); } ).accuracy = kFastAccuracy;
+        RegisterTest( tests, "f32 fast cos", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -4096.0f ) ), TestRegf32( 4096.0f ) ), []( auto x ) { return FS::Fast::Cos( x ); }, []( double x ) { return std::cos( x ); } ); } ).accuracy = kFastAccuracy;
+        RegisterTest( tests, "f32 fast exp2", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -126.0f ) ), TestRegf32( 127.0f ) ), []( auto x ) { return FS::Fast::Exp2( x ); }, []( double x ) { return std::exp2( x ); } ); } ).accuracy = kFastAccuracy;
+        RegisterTest( tests, "f32 fast exp", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -87.0f ) ), TestRegf32( 88.0f ) ), []( auto x ) { return FS::Fast::Exp( x ); }, []( double x ) { return std::exp( x ); } ); } ).accuracy = kFastAccuracy;
+        RegisterTest( tests, "f32 fast log2", []( TestRegf32 a ) { return ReferenceOr( FS::Max( FS::Abs( a ), TestRegf32( 1.17549435e-38f ) ), []( auto x ) { return FS::Fast::Log2( x ); }, []( double x ) { return std::log2( x ); } ); } ).accuracy = kFastAccuracy;
+        RegisterTest( tests, "f32 fast log", []( TestRegf32 a ) { return ReferenceOr( FS::Max( FS::Abs( a ), TestRegf32( 1.17549435e-38f ) ), []( auto x ) { return FS::Fast::Log( x ); }, []( double x ) { return std::log( x ); } ); } ).accuracy = kFastAccuracy;
+
+        RegisterTest( tests, "f32 exp10", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -37.0f ) ), TestRegf32( 38.0f ) ), []( auto x ) { return FS::Exp10( x ); }, []( double x ) { return std::pow( 10.0, x ); } ); } ).accuracy = 2;
+        RegisterTest( tests, "f32 log10", []( TestRegf32 a ) { return ReferenceOr( FS::Max( FS::Abs( a ), TestRegf32( 1.17549435e-38f ) ), []( auto x ) { return FS::Log10( x ); }, []( double x ) { return std::log10( x ); } ); } ).accuracy = 3;
+        RegisterTest( tests, "f32 expm1", []( TestRegf32 a ) { return ReferenceOr( FS::Min( FS::Max( a, TestRegf32( -87.0f ) ), TestRegf32( 88.0f ) ), []( auto x ) { return FS::Expm1( x ); }, []( double x ) { return std::expm1( x ); } ); } ).accuracy = 1;
+        RegisterTest( tests, "f32 log1p", []( TestRegf32 a ) { return ReferenceOr( FS::Max( a, TestRegf32( -0.99999f ) ), []( auto x ) { return FS::Log1p( x ); }, []( double x ) { return std::log1p( x ); } ); } ).accuracy = 2;
+        RegisterTest( tests, "f32 tanh", []( TestRegf32 a ) { return ReferenceOr( a, []( auto x ) { return FS::Tanh( x ); }, []( double x ) { return std::tanh( x ); } ); } ).accuracy = 3;
+        RegisterTest( tests, "f32 sigmoid", []( TestRegf32 a ) { return ReferenceOr( FS::Max( a, TestRegf32( -87.0f ) ), []( auto x ) { return FS::Sigmoid( x ); }, []( double x ) { return 1.0 / ( 1.0 + std::exp( -x ) ); } ); } ).accuracy = 3;
+        RegisterTest( tests, "f32 erf", []( TestRegf32 a ) { return ReferenceOr( a, []( auto x ) { return FS::Erf( x ); }, []( double x ) { return std::erf( x ); } ); } ).accuracy = 2;
+        RegisterTest( tests, "f32 cbrt", []( TestRegf32 a ) { return ReferenceOr( a, []( auto x ) { return FS::Cbrt( x ); }, []( double x ) { return std::cbrt( x ); } ); } ).accuracy = 1;
 
         RegisterTest( tests, "i32 convert to f32", []( TestRegi32 a ) { return FS::Convert<float>( a ); } );
         RegisterTest( tests, "f32 convert to i32", []( TestRegf32 a ) { return FS::Convert<int32_t>( FS::Min( FS::Max( a, TestRegf32( -2147483647 - 1 ) ), TestRegf32( 2147483520 ) ) ); } );
@@ -461,6 +816,11 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
         RegisterTest( tests, "f32 cast to i32", []( TestRegf32 a ) { return FS::Cast<int32_t>( a ); } );
         RegisterTest( tests, "i32 cast to f32", []( TestRegi32 a ) { return FS::Cast<float>( a ); } );
 
+        RegisterTest( tests, "u32 convert to f32", []( TestRegu32 a ) { return FS::Convert<float>( a ); } );
+        RegisterTest( tests, "f32 convert to u32", []( TestRegf32 a ) { return FS::Convert<uint32_t>( FS::Min( FS::Max( a, TestRegf32( 0 ) ), TestRegf32( 4294967040.0f ) ) ); } );
+        RegisterTest( tests, "u32 cast to i32", []( TestRegu32 a ) { return FS::Cast<int32_t>( a ); } );
+        RegisterTest( tests, "u32 cast to f32", []( TestRegu32 a ) { return FS::Cast<float>( a ); } );
+
         if constexpr( !( SIMD & FeatureFlag::AVX512_F ) )
         {
             RegisterTest( tests, "m32 cast to i32", []( TestRegm32 a ) { return FS_BIND_INTRINSIC( FS::Cast<FS::Mask<32>> )( FS_BIND_INTRINSIC( FS::Cast<int32_t> )( a ) ); } );
@@ -468,8 +828,425 @@ class FastSIMD::DispatchClass<TestFastSIMD<RegisterBytes, Relaxed>, SIMD> : publ
             RegisterTest( tests, "m32i cast to i32", []( TestRegm32i a ) { return FS_BIND_INTRINSIC( FS::Cast<typename TestRegm32i::ElementType> )( FS_BIND_INTRINSIC( FS::Cast<int32_t> )( a ) ); } );
             RegisterTest( tests, "m32i cast to f32", []( TestRegm32i a ) { return FS_BIND_INTRINSIC( FS::Cast<typename TestRegm32i::ElementType> )( FS_BIND_INTRINSIC( FS::Cast<float> )( a ) ); } );
         }
+        using TestRegi64 = TestReg<int64_t>;
+        using TestRegm64i = typename TestRegi64::MaskType;
+
+        RegisterTest( tests, "m64i bit mask", []( TestRegm64i a ) { return a; } );
+        RegisterTest( tests, "m64i any mask", []( TestRegm64i a ) { return FS::AnyMask( a ); } );
+        RegisterTest( tests, "m64i all mask", []( TestRegm64i a, TestRegm64i b, TestRegm64i c ) { return FS::AllMask( a | b | c ); } );
+        RegisterTest( tests, "m64i none mask", []( TestRegm64i a, TestRegm64i b, TestRegm64i c ) { return FS::NoneMask( a & b & c ); } );
+        RegisterTest( tests, "m64i count true", []( TestRegm64i a ) { return FS::CountTrue( a ); } );
+        RegisterTest( tests, "m64i first true index", []( TestRegm64i a, TestRegm64i b ) { return FS::FirstTrueIndex( a & b ); } );
+        RegisterTest( tests, "m64i last true index", []( TestRegm64i a, TestRegm64i b ) { return FS::LastTrueIndex( a & b ); } );
+
+        RegisterTest( tests, "m64i bit and operator", std::bit_and<TestRegm64i>() );
+        RegisterTest( tests, "m64i bit or operator", std::bit_or<TestRegm64i>() );
+        RegisterTest( tests, "m64i bit xor operator", std::bit_xor<TestRegm64i>() );
+        RegisterTest( tests, "m64i bit not operator", std::bit_not<TestRegm64i>() );
+        RegisterTest( tests, "m64i bit and not", []( TestRegm64i a, TestRegm64i b ) { return FS::BitwiseAndNot( a, b ); } );
+
+        RegisterTest( tests, "i64 load store", []( TestRegi64 a ) { return a; } );
+        RegisterTest( tests, "i64 load scalar", []( int64_t a ) { return TestRegi64( a ); } );
+        RegisterTest( tests, "i64 splat", []( int64_t a ) { return FS::Splat<TestRegi64::ElementCount>( a ); } );
+        RegisterTest( tests, "i64 extract 0", []( TestRegi64 a ) { return FS::Extract0( a ); } );
+        RegisterTest( tests, "i64 reduce add", []( TestRegi64 a ) { return FS::ReduceAdd( a ); } );
+        RegisterTest( tests, "i64 reduce min", []( TestRegi64 a ) { return FS::ReduceMin( a ); } );
+        RegisterTest( tests, "i64 reduce max", []( TestRegi64 a ) { return FS::ReduceMax( a ); } );
+        RegisterTest( tests, "i64 reduce and", []( TestRegi64 a ) { return FS::ReduceAnd( a ); } );
+        RegisterTest( tests, "i64 reduce or", []( TestRegi64 a ) { return FS::ReduceOr( a ); } );
+        RegisterTest( tests, "i64 load incremented", []() { return FS::LoadIncremented<TestRegi64>(); } );
+
+        RegisterTest( tests, "i64 plus operator", std::plus<TestRegi64>() );
+        RegisterTest( tests, "i64 minus operator", std::minus<TestRegi64>() );
+        RegisterTest( tests, "i64 multiply operator", std::multiplies<TestRegi64>() );
+
+        RegisterTest( tests, "i64 bit and operator", std::bit_and<TestRegi64>() );
+        RegisterTest( tests, "i64 bit or operator", std::bit_or<TestRegi64>() );
+        RegisterTest( tests, "i64 bit xor operator", std::bit_xor<TestRegi64>() );
+        RegisterTest( tests, "i64 bit not operator", std::bit_not<TestRegi64>() );
+        RegisterTest( tests, "i64 negate operator", std::negate<TestRegi64>() );
+        RegisterTest( tests, "i64 bit and not", []( TestRegi64 a, TestRegi64 b ) { return FS::BitwiseAndNot( a, b ); } );
+
+        RegisterTest( tests, "i64 increment", []( TestRegi64 a ) { return FS::Increment( a ); } );
+        RegisterTest( tests, "i64 decrement", []( TestRegi64 a ) { return FS::Decrement( a ); } );
+        RegisterTest( tests, "i64 abs", []( TestRegi64 a ) { return FS::Abs( a ); } );
+        RegisterTest( tests, "i64 min", []( TestRegi64 a, TestRegi64 b ) { return FS::Min( a, b ); } );
+        RegisterTest( tests, "i64 max", []( TestRegi64 a, TestRegi64 b ) { return FS::Max( a, b ); } );
+
+        RegisterTest( tests, "i64 bit shift left scalar", []( TestRegi64 a, int b ) { return a << ( b & 63 ); } );
+        RegisterTest( tests, "i64 bit shift right scalar", []( TestRegi64 a, int b ) { return a >> ( b & 63 ); } );
+        RegisterTest( tests, "i64 bit shift right zero extend scalar", []( TestRegi64 a, int b ) { return FS::BitShiftRightZeroExtend( a, b & 63 ); } );
+
+        RegisterTest( tests, "i64 equals operator", []( TestRegi64 a, TestRegi64 b ) { return a == b; } );
+        RegisterTest( tests, "i64 equals operator alt", []( TestRegi64 a ) { return a == a; } );
+        RegisterTest( tests, "i64 not equals operator", []( TestRegi64 a, TestRegi64 b ) { return a != b; } );
+        RegisterTest( tests, "i64 less than operator", []( TestRegi64 a, TestRegi64 b ) { return a < b; } );
+        RegisterTest( tests, "i64 greater than operator", []( TestRegi64 a, TestRegi64 b ) { return a > b; } );
+        RegisterTest( tests, "i64 less equal than operator", []( TestRegi64 a, TestRegi64 b ) { return a <= b; } );
+        RegisterTest( tests, "i64 greater equal than operator", []( TestRegi64 a, TestRegi64 b ) { return a >= b; } );
+        RegisterTest( tests, "i64 greater than operator high equal", []( TestRegi64 a, TestRegi64 b ) { return a > ( ( a & TestRegi64( -4294967296 ) ) | ( b & TestRegi64( 4294967295 ) ) ); } );
+
+        RegisterTest( tests, "i64 select", []( TestRegm64i m, TestRegi64 a, TestRegi64 b ) { return FS::Select( m, a, b ); } );
+        RegisterTest( tests, "i64 masked", []( TestRegm64i m, TestRegi64 a ) { return FS::Masked( m, a ); } );
+        RegisterTest( tests, "i64 inv masked", []( TestRegm64i m, TestRegi64 a ) { return FS::InvMasked( m, a ); } );
+        RegisterTest( tests, "i64 masked increment", []( TestRegm64i m, TestRegi64 a ) { return FS::MaskedIncrement( m, a ); } );
+        RegisterTest( tests, "i64 masked decrement", []( TestRegm64i m, TestRegi64 a ) { return FS::MaskedDecrement( m, a ); } );
+        RegisterTest( tests, "i64 masked add", []( TestRegm64i m, TestRegi64 a, TestRegi64 b ) { return FS::MaskedAdd( m, a, b ); } );
+        RegisterTest( tests, "i64 masked sub", []( TestRegm64i m, TestRegi64 a, TestRegi64 b ) { return FS::MaskedSub( m, a, b ); } );
+        RegisterTest( tests, "i64 masked mul", []( TestRegm64i m, TestRegi64 a, TestRegi64 b ) { return FS::MaskedMul( m, a, b ); } );
+        RegisterTest( tests, "i64 inv masked add", []( TestRegm64i m, TestRegi64 a, TestRegi64 b ) { return FS::InvMaskedAdd( m, a, b ); } );
+        RegisterTest( tests, "i64 inv masked sub", []( TestRegm64i m, TestRegi64 a, TestRegi64 b ) { return FS::InvMaskedSub( m, a, b ); } );
+        RegisterTest( tests, "i64 inv masked mul", []( TestRegm64i m, TestRegi64 a, TestRegi64 b ) { return FS::InvMaskedMul( m, a, b ); } );
+
+        using TestRegi8 = TestReg<int8_t>;
+        using TestRegu8 = TestReg<uint8_t>;
+        using TestRegi16 = TestReg<int16_t>;
+        using TestRegu16 = TestReg<uint16_t>;
+
+        using TestRegm8 = typename TestRegi8::MaskType;
+
+        RegisterTest( tests, "m8 bit mask", []( TestRegm8 a ) { return a; } );
+        RegisterTest( tests, "m8 any mask", []( TestRegm8 a ) { return FS::AnyMask( a ); } );
+        RegisterTest( tests, "m8 all mask", []( TestRegm8 a, TestRegm8 b, TestRegm8 c ) { return FS::AllMask( a | b | c ); } );
+        RegisterTest( tests, "m8 none mask", []( TestRegm8 a, TestRegm8 b, TestRegm8 c ) { return FS::NoneMask( a & b & c ); } );
+        RegisterTest( tests, "m8 count true", []( TestRegm8 a ) { return FS::CountTrue( a ); } );
+        RegisterTest( tests, "m8 first true index", []( TestRegm8 a, TestRegm8 b ) { return FS::FirstTrueIndex( a & b ); } );
+        RegisterTest( tests, "m8 last true index", []( TestRegm8 a, TestRegm8 b ) { return FS::LastTrueIndex( a & b ); } );
+
+        RegisterTest( tests, "m8 bit and operator", std::bit_and<TestRegm8>() );
+        RegisterTest( tests, "m8 bit or operator", std::bit_or<TestRegm8>() );
+        RegisterTest( tests, "m8 bit xor operator", std::bit_xor<TestRegm8>() );
+        RegisterTest( tests, "m8 bit not operator", std::bit_not<TestRegm8>() );
+        RegisterTest( tests, "m8 bit and not", []( TestRegm8 a, TestRegm8 b ) { return FS::BitwiseAndNot( a, b ); } );
+
+        RegisterTest( tests, "i8 load store", []( TestRegi8 a ) { return a; } );
+        RegisterTest( tests, "i8 load scalar", []( int8_t a ) { return TestRegi8( a ); } );
+        RegisterTest( tests, "i8 splat", []( int8_t a ) { return FS::Splat<TestRegi8::ElementCount>( a ); } );
+        RegisterTest( tests, "i8 extract 0", []( TestRegi8 a ) { return FS::Extract0( a ); } );
+        RegisterTest( tests, "i8 reduce add", []( TestRegi8 a ) { return FS::ReduceAdd( a ); } );
+        RegisterTest( tests, "i8 reduce min", []( TestRegi8 a ) { return FS::ReduceMin( a ); } );
+        RegisterTest( tests, "i8 reduce max", []( TestRegi8 a ) { return FS::ReduceMax( a ); } );
+        RegisterTest( tests, "i8 load incremented", []() { return FS::LoadIncremented<TestRegi8>(); } );
+        RegisterTest( tests, "i8 table lookup", []( TestRegi8 a, TestRegu8 b ) { return FS::TableLookup( a, b ); } );
+        RegisterTest( tests, "i8 table lookup in range", []( TestRegi8 a, TestRegu8 b ) { return FS::TableLookup( a, b & TestRegu8( TestRegu8::ElementCount * 2 - 1 ) ); } );
+
+        RegisterTest( tests, "i8 plus operator", std::plus<TestRegi8>() );
+        RegisterTest( tests, "i8 minus operator", std::minus<TestRegi8>() );
+
+        RegisterTest( tests, "i8 bit and operator", std::bit_and<TestRegi8>() );
+        RegisterTest( tests, "i8 bit or operator", std::bit_or<TestRegi8>() );
+        RegisterTest( tests, "i8 bit xor operator", std::bit_xor<TestRegi8>() );
+        RegisterTest( tests, "i8 bit not operator", std::bit_not<TestRegi8>() );
+        RegisterTest( tests, "i8 negate operator", std::negate<TestRegi8>() );
+        RegisterTest( tests, "i8 bit and not", []( TestRegi8 a, TestRegi8 b ) { return FS::BitwiseAndNot( a, b ); } );
+
+        RegisterTest( tests, "i8 increment", []( TestRegi8 a ) { return FS::Increment( a ); } );
+        RegisterTest( tests, "i8 decrement", []( TestRegi8 a ) { return FS::Decrement( a ); } );
+        RegisterTest( tests, "i8 abs", []( TestRegi8 a ) { return FS::Abs( a ); } );
+        RegisterTest( tests, "i8 min", []( TestRegi8 a, TestRegi8 b ) { return FS::Min( a, b ); } );
+        RegisterTest( tests, "i8 max", []( TestRegi8 a, TestRegi8 b ) { return FS::Max( a, b ); } );
+        RegisterTest( tests, "i8 add saturate", []( TestRegi8 a, TestRegi8 b ) { return FS::AddSat( a, b ); } );
+        RegisterTest( tests, "i8 sub saturate", []( TestRegi8 a, TestRegi8 b ) { return FS::SubSat( a, b ); } );
+
+        RegisterTest( tests, "i8 bit shift left scalar", []( TestRegi8 a, int b ) { return a << ( b & 7 ); } );
+        RegisterTest( tests, "i8 bit shift right scalar", []( TestRegi8 a, int b ) { return a >> ( b & 7 ); } );
+        RegisterTest( tests, "i8 bit shift right zero extend scalar", []( TestRegi8 a, int b ) { return FS::BitShiftRightZeroExtend( a, b & 7 ); } );
+
+        RegisterTest( tests, "i8 equals operator", []( TestRegi8 a, TestRegi8 b ) { return a == b; } );
+        RegisterTest( tests, "i8 equals operator alt", []( TestRegi8 a ) { return a == a; } );
+        RegisterTest( tests, "i8 not equals operator", []( TestRegi8 a, TestRegi8 b ) { return a != b; } );
+        RegisterTest( tests, "i8 less than operator", []( TestRegi8 a, TestRegi8 b ) { return a < b; } );
+        RegisterTest( tests, "i8 greater than operator", []( TestRegi8 a, TestRegi8 b ) { return a > b; } );
+        RegisterTest( tests, "i8 less equal than operator", []( TestRegi8 a, TestRegi8 b ) { return a <= b; } );
+        RegisterTest( tests, "i8 greater equal than operator", []( TestRegi8 a, TestRegi8 b ) { return a >= b; } );
+
+        RegisterTest( tests, "i8 select", []( TestRegm8 m, TestRegi8 a, TestRegi8 b ) { return FS::Select( m, a, b ); } );
+        RegisterTest( tests, "i8 masked", []( TestRegm8 m, TestRegi8 a ) { return FS::Masked( m, a ); } );
+        RegisterTest( tests, "i8 inv masked", []( TestRegm8 m, TestRegi8 a ) { return FS::InvMasked( m, a ); } );
+        RegisterTest( tests, "i8 masked increment", []( TestRegm8 m, TestRegi8 a ) { return FS::MaskedIncrement( m, a ); } );
+        RegisterTest( tests, "i8 masked decrement", []( TestRegm8 m, TestRegi8 a ) { return FS::MaskedDecrement( m, a ); } );
+        RegisterTest( tests, "i8 masked add", []( TestRegm8 m, TestRegi8 a, TestRegi8 b ) { return FS::MaskedAdd( m, a, b ); } );
+        RegisterTest( tests, "i8 masked sub", []( TestRegm8 m, TestRegi8 a, TestRegi8 b ) { return FS::MaskedSub( m, a, b ); } );
+
+        RegisterTest( tests, "u8 load store", []( TestRegu8 a ) { return a; } );
+        RegisterTest( tests, "u8 load scalar", []( uint8_t a ) { return TestRegu8( a ); } );
+        RegisterTest( tests, "u8 splat", []( uint8_t a ) { return FS::Splat<TestRegu8::ElementCount>( a ); } );
+        RegisterTest( tests, "u8 extract 0", []( TestRegu8 a ) { return FS::Extract0( a ); } );
+        RegisterTest( tests, "u8 reduce add", []( TestRegu8 a ) { return FS::ReduceAdd( a ); } );
+        RegisterTest( tests, "u8 reduce min", []( TestRegu8 a ) { return FS::ReduceMin( a ); } );
+        RegisterTest( tests, "u8 reduce max", []( TestRegu8 a ) { return FS::ReduceMax( a ); } );
+        RegisterTest( tests, "u8 load incremented", []() { return FS::LoadIncremented<TestRegu8>(); } );
+
+        RegisterTest( tests, "u8 plus operator", std::plus<TestRegu8>() );
+        RegisterTest( tests, "u8 minus operator", std::minus<TestRegu8>() );
+
+        RegisterTest( tests, "u8 bit and operator", std::bit_and<TestRegu8>() );
+        RegisterTest( tests, "u8 bit or operator", std::bit_or<TestRegu8>() );
+        RegisterTest( tests, "u8 bit xor operator", std::bit_xor<TestRegu8>() );
+        RegisterTest( tests, "u8 bit not operator", std::bit_not<TestRegu8>() );
+        RegisterTest( tests, "u8 negate operator", std::negate<TestRegu8>() );
+        RegisterTest( tests, "u8 bit and not", []( TestRegu8 a, TestRegu8 b ) { return FS::BitwiseAndNot( a, b ); } );
+
+        RegisterTest( tests, "u8 increment", []( TestRegu8 a ) { return FS::Increment( a ); } );
+        RegisterTest( tests, "u8 decrement", []( TestRegu8 a ) { return FS::Decrement( a ); } );
+        RegisterTest( tests, "u8 min", []( TestRegu8 a, TestRegu8 b ) { return FS::Min( a, b ); } );
+        RegisterTest( tests, "u8 max", []( TestRegu8 a, TestRegu8 b ) { return FS::Max( a, b ); } );
+        RegisterTest( tests, "u8 add saturate", []( TestRegu8 a, TestRegu8 b ) { return FS::AddSat( a, b ); } );
+        RegisterTest( tests, "u8 sub saturate", []( TestRegu8 a, TestRegu8 b ) { return FS::SubSat( a, b ); } );
+        RegisterTest( tests, "u8 average", []( TestRegu8 a, TestRegu8 b ) { return FS::Average( a, b ); } );
+        RegisterTest( tests, "u8 table lookup", []( TestRegu8 a, TestRegu8 b ) { return FS::TableLookup( a, b ); } );
+        RegisterTest( tests, "u8 table lookup in range", []( TestRegu8 a, TestRegu8 b ) { return FS::TableLookup( a, b & TestRegu8( TestRegu8::ElementCount * 2 - 1 ) ); } );
+
+        RegisterTest( tests, "u8 bit shift left scalar", []( TestRegu8 a, int b ) { return a << ( b & 7 ); } );
+        RegisterTest( tests, "u8 bit shift right scalar", []( TestRegu8 a, int b ) { return a >> ( b & 7 ); } );
+
+        RegisterTest( tests, "u8 equals operator", []( TestRegu8 a, TestRegu8 b ) { return a == b; } );
+        RegisterTest( tests, "u8 equals operator alt", []( TestRegu8 a ) { return a == a; } );
+        RegisterTest( tests, "u8 not equals operator", []( TestRegu8 a, TestRegu8 b ) { return a != b; } );
+        RegisterTest( tests, "u8 less than operator", []( TestRegu8 a, TestRegu8 b ) { return a < b; } );
+        RegisterTest( tests, "u8 greater than operator", []( TestRegu8 a, TestRegu8 b ) { return a > b; } );
+        RegisterTest( tests, "u8 less equal than operator", []( TestRegu8 a, TestRegu8 b ) { return a <= b; } );
+        RegisterTest( tests, "u8 greater equal than operator", []( TestRegu8 a, TestRegu8 b ) { return a >= b; } );
+
+        RegisterTest( tests, "u8 select", []( TestRegm8 m, TestRegu8 a, TestRegu8 b ) { return FS::Select( m, a, b ); } );
+        RegisterTest( tests, "u8 masked", []( TestRegm8 m, TestRegu8 a ) { return FS::Masked( m, a ); } );
+        RegisterTest( tests, "u8 inv masked", []( TestRegm8 m, TestRegu8 a ) { return FS::InvMasked( m, a ); } );
+        RegisterTest( tests, "u8 masked increment", []( TestRegm8 m, TestRegu8 a ) { return FS::MaskedIncrement( m, a ); } );
+        RegisterTest( tests, "u8 masked decrement", []( TestRegm8 m, TestRegu8 a ) { return FS::MaskedDecrement( m, a ); } );
+        RegisterTest( tests, "u8 masked add", []( TestRegm8 m, TestRegu8 a, TestRegu8 b ) { return FS::MaskedAdd( m, a, b ); } );
+        RegisterTest( tests, "u8 masked sub", []( TestRegm8 m, TestRegu8 a, TestRegu8 b ) { return FS::MaskedSub( m, a, b ); } );
+
+        using TestRegm16 = typename TestRegi16::MaskType;
+
+        RegisterTest( tests, "m16 bit mask", []( TestRegm16 a ) { return a; } );
+        RegisterTest( tests, "m16 any mask", []( TestRegm16 a ) { return FS::AnyMask( a ); } );
+        RegisterTest( tests, "m16 all mask", []( TestRegm16 a, TestRegm16 b, TestRegm16 c ) { return FS::AllMask( a | b | c ); } );
+        RegisterTest( tests, "m16 none mask", []( TestRegm16 a, TestRegm16 b, TestRegm16 c ) { return FS::NoneMask( a & b & c ); } );
+        RegisterTest( tests, "m16 count true", []( TestRegm16 a ) { return FS::CountTrue( a ); } );
+        RegisterTest( tests, "m16 first true index", []( TestRegm16 a, TestRegm16 b ) { return FS::FirstTrueIndex( a & b ); } );
+        RegisterTest( tests, "m16 last true index", []( TestRegm16 a, TestRegm16 b ) { return FS::LastTrueIndex( a & b ); } );
+
+        RegisterTest( tests, "m16 bit and operator", std::bit_and<TestRegm16>() );
+        RegisterTest( tests, "m16 bit or operator", std::bit_or<TestRegm16>() );
+        RegisterTest( tests, "m16 bit xor operator", std::bit_xor<TestRegm16>() );
+        RegisterTest( tests, "m16 bit not operator", std::bit_not<TestRegm16>() );
+        RegisterTest( tests, "m16 bit and not", []( TestRegm16 a, TestRegm16 b ) { return FS::BitwiseAndNot( a, b ); } );
+
+        RegisterTest( tests, "i16 load store", []( TestRegi16 a ) { return a; } );
+        RegisterTest( tests, "i16 load scalar", []( int16_t a ) { return TestRegi16( a ); } );
+        RegisterTest( tests, "i16 splat", []( int16_t a ) { return FS::Splat<TestRegi16::ElementCount>( a ); } );
+        RegisterTest( tests, "i16 extract 0", []( TestRegi16 a ) { return FS::Extract0( a ); } );
+        RegisterTest( tests, "i16 reduce add", []( TestRegi16 a ) { return FS::ReduceAdd( a ); } );
+        RegisterTest( tests, "i16 reduce min", []( TestRegi16 a ) { return FS::ReduceMin( a ); } );
+        RegisterTest( tests, "i16 reduce max", []( TestRegi16 a ) { return FS::ReduceMax( a ); } );
+        RegisterTest( tests, "i16 load incremented", []() { return FS::LoadIncremented<TestRegi16>(); } );
+
+        RegisterTest( tests, "i16 plus operator", std::plus<TestRegi16>() );
+        RegisterTest( tests, "i16 minus operator", std::minus<TestRegi16>() );
+        RegisterTest( tests, "i16 multiply operator", std::multiplies<TestRegi16>() );
+
+        RegisterTest( tests, "i16 bit and operator", std::bit_and<TestRegi16>() );
+        RegisterTest( tests, "i16 bit or operator", std::bit_or<TestRegi16>() );
+        RegisterTest( tests, "i16 bit xor operator", std::bit_xor<TestRegi16>() );
+        RegisterTest( tests, "i16 bit not operator", std::bit_not<TestRegi16>() );
+        RegisterTest( tests, "i16 negate operator", std::negate<TestRegi16>() );
+        RegisterTest( tests, "i16 bit and not", []( TestRegi16 a, TestRegi16 b ) { return FS::BitwiseAndNot( a, b ); } );
+
+        RegisterTest( tests, "i16 increment", []( TestRegi16 a ) { return FS::Increment( a ); } );
+        RegisterTest( tests, "i16 decrement", []( TestRegi16 a ) { return FS::Decrement( a ); } );
+        RegisterTest( tests, "i16 abs", []( TestRegi16 a ) { return FS::Abs( a ); } );
+        RegisterTest( tests, "i16 min", []( TestRegi16 a, TestRegi16 b ) { return FS::Min( a, b ); } );
+        RegisterTest( tests, "i16 max", []( TestRegi16 a, TestRegi16 b ) { return FS::Max( a, b ); } );
+        RegisterTest( tests, "i16 add saturate", []( TestRegi16 a, TestRegi16 b ) { return FS::AddSat( a, b ); } );
+        RegisterTest( tests, "i16 sub saturate", []( TestRegi16 a, TestRegi16 b ) { return FS::SubSat( a, b ); } );
+
+        RegisterTest( tests, "i16 bit shift left scalar", []( TestRegi16 a, int b ) { return a << ( b & 15 ); } );
+        RegisterTest( tests, "i16 bit shift right scalar", []( TestRegi16 a, int b ) { return a >> ( b & 15 ); } );
+        RegisterTest( tests, "i16 bit shift right zero extend scalar", []( TestRegi16 a, int b ) { return FS::BitShiftRightZeroExtend( a, b & 15 ); } );
+
+        RegisterTest( tests, "i16 equals operator", []( TestRegi16 a, TestRegi16 b ) { return a == b; } );
+        RegisterTest( tests, "i16 equals operator alt", []( TestRegi16 a ) { return a == a; } );
+        RegisterTest( tests, "i16 not equals operator", []( TestRegi16 a, TestRegi16 b ) { return a != b; } );
+        RegisterTest( tests, "i16 less than operator", []( TestRegi16 a, TestRegi16 b ) { return a < b; } );
+        RegisterTest( tests, "i16 greater than operator", []( TestRegi16 a, TestRegi16 b ) { return a > b; } );
+        RegisterTest( tests, "i16 less equal than operator", []( TestRegi16 a, TestRegi16 b ) { return a <= b; } );
+        RegisterTest( tests, "i16 greater equal than operator", []( TestRegi16 a, TestRegi16 b ) { return a >= b; } );
+
+        RegisterTest( tests, "i16 select", []( TestRegm16 m, TestRegi16 a, TestRegi16 b ) { return FS::Select( m, a, b ); } );
+        RegisterTest( tests, "i16 masked", []( TestRegm16 m, TestRegi16 a ) { return FS::Masked( m, a ); } );
+        RegisterTest( tests, "i16 inv masked", []( TestRegm16 m, TestRegi16 a ) { return FS::InvMasked( m, a ); } );
+        RegisterTest( tests, "i16 masked increment", []( TestRegm16 m, TestRegi16 a ) { return FS::MaskedIncrement( m, a ); } );
+        RegisterTest( tests, "i16 masked decrement", []( TestRegm16 m, TestRegi16 a ) { return FS::MaskedDecrement( m, a ); } );
+        RegisterTest( tests, "i16 masked add", []( TestRegm16 m, TestRegi16 a, TestRegi16 b ) { return FS::MaskedAdd( m, a, b ); } );
+        RegisterTest( tests, "i16 masked sub", []( TestRegm16 m, TestRegi16 a, TestRegi16 b ) { return FS::MaskedSub( m, a, b ); } );
+
+        RegisterTest( tests, "u16 load store", []( TestRegu16 a ) { return a; } );
+        RegisterTest( tests, "u16 load scalar", []( uint16_t a ) { return TestRegu16( a ); } );
+        RegisterTest( tests, "u16 splat", []( uint16_t a ) { return FS::Splat<TestRegu16::ElementCount>( a ); } );
+        RegisterTest( tests, "u16 extract 0", []( TestRegu16 a ) { return FS::Extract0( a ); } );
+        RegisterTest( tests, "u16 reduce add", []( TestRegu16 a ) { return FS::ReduceAdd( a ); } );
+        RegisterTest( tests, "u16 reduce min", []( TestRegu16 a ) { return FS::ReduceMin( a ); } );
+        RegisterTest( tests, "u16 reduce max", []( TestRegu16 a ) { return FS::ReduceMax( a ); } );
+        RegisterTest( tests, "u16 load incremented", []() { return FS::LoadIncremented<TestRegu16>(); } );
+
+        RegisterTest( tests, "u16 plus operator", std::plus<TestRegu16>() );
+        RegisterTest( tests, "u16 minus operator", std::minus<TestRegu16>() );
+        RegisterTest( tests, "u16 multiply operator", std::multiplies<TestRegu16>() );
+
+        RegisterTest( tests, "u16 bit and operator", std::bit_and<TestRegu16>() );
+        RegisterTest( tests, "u16 bit or operator", std::bit_or<TestRegu16>() );
+        RegisterTest( tests, "u16 bit xor operator", std::bit_xor<TestRegu16>() );
+        RegisterTest( tests, "u16 bit not operator", std::bit_not<TestRegu16>() );
+        RegisterTest( tests, "u16 negate operator", std::negate<TestRegu16>() );
+        RegisterTest( tests, "u16 bit and not", []( TestRegu16 a, TestRegu16 b ) { return FS::BitwiseAndNot( a, b ); } );
+
+        RegisterTest( tests, "u16 increment", []( TestRegu16 a ) { return FS::Increment( a ); } );
+        RegisterTest( tests, "u16 decrement", []( TestRegu16 a ) { return FS::Decrement( a ); } );
+        RegisterTest( tests, "u16 min", []( TestRegu16 a, TestRegu16 b ) { return FS::Min( a, b ); } );
+        RegisterTest( tests, "u16 max", []( TestRegu16 a, TestRegu16 b ) { return FS::Max( a, b ); } );
+        RegisterTest( tests, "u16 add saturate", []( TestRegu16 a, TestRegu16 b ) { return FS::AddSat( a, b ); } );
+        RegisterTest( tests, "u16 sub saturate", []( TestRegu16 a, TestRegu16 b ) { return FS::SubSat( a, b ); } );
+        RegisterTest( tests, "u16 average", []( TestRegu16 a, TestRegu16 b ) { return FS::Average( a, b ); } );
+
+        RegisterTest( tests, "u16 bit shift left scalar", []( TestRegu16 a, int b ) { return a << ( b & 15 ); } );
+        RegisterTest( tests, "u16 bit shift right scalar", []( TestRegu16 a, int b ) { return a >> ( b & 15 ); } );
+
+        RegisterTest( tests, "u16 equals operator", []( TestRegu16 a, TestRegu16 b ) { return a == b; } );
+        RegisterTest( tests, "u16 equals operator alt", []( TestRegu16 a ) { return a == a; } );
+        RegisterTest( tests, "u16 not equals operator", []( TestRegu16 a, TestRegu16 b ) { return a != b; } );
+        RegisterTest( tests, "u16 less than operator", []( TestRegu16 a, TestRegu16 b ) { return a < b; } );
+        RegisterTest( tests, "u16 greater than operator", []( TestRegu16 a, TestRegu16 b ) { return a > b; } );
+        RegisterTest( tests, "u16 less equal than operator", []( TestRegu16 a, TestRegu16 b ) { return a <= b; } );
+        RegisterTest( tests, "u16 greater equal than operator", []( TestRegu16 a, TestRegu16 b ) { return a >= b; } );
+
+        RegisterTest( tests, "u16 select", []( TestRegm16 m, TestRegu16 a, TestRegu16 b ) { return FS::Select( m, a, b ); } );
+        RegisterTest( tests, "u16 masked", []( TestRegm16 m, TestRegu16 a ) { return FS::Masked( m, a ); } );
+        RegisterTest( tests, "u16 inv masked", []( TestRegm16 m, TestRegu16 a ) { return FS::InvMasked( m, a ); } );
+        RegisterTest( tests, "u16 masked increment", []( TestRegm16 m, TestRegu16 a ) { return FS::MaskedIncrement( m, a ); } );
+        RegisterTest( tests, "u16 masked decrement", []( TestRegm16 m, TestRegu16 a ) { return FS::MaskedDecrement( m, a ); } );
+        RegisterTest( tests, "u16 masked add", []( TestRegm16 m, TestRegu16 a, TestRegu16 b ) { return FS::MaskedAdd( m, a, b ); } );
+        RegisterTest( tests, "u16 masked sub", []( TestRegm16 m, TestRegu16 a, TestRegu16 b ) { return FS::MaskedSub( m, a, b ); } );
+
+        using TestRegi8x32 = FS::Register<int8_t, 32>;
+        using TestRegu8x32 = FS::Register<uint8_t, 32>;
+        using TestRegi16x32 = FS::Register<int16_t, 32>;
+        using TestRegu16x32 = FS::Register<uint16_t, 32>;
+        using TestRegi16x16 = FS::Register<int16_t, 16>;
+        using TestRegu16x16 = FS::Register<uint16_t, 16>;
+        using TestRegi32x16 = FS::Register<int32_t, 16>;
+
+        RegisterTest( tests, "i8 convert to i16", []( TestRegi8x32 a ) { return FS::Convert<int16_t>( a ); } );
+        RegisterTest( tests, "u8 convert to u16", []( TestRegu8x32 a ) { return FS::Convert<uint16_t>( a ); } );
+        RegisterTest( tests, "i16 convert to i32", []( TestRegi16x16 a ) { return FS::Convert<int32_t>( a ); } );
+        RegisterTest( tests, "u16 convert to i32", []( TestRegu16x16 a ) { return FS::Convert<int32_t>( a ); } );
+        RegisterTest( tests, "i16 convert to i8", []( TestRegi16x32 a ) { return FS::Convert<int8_t>( a ); } );
+        RegisterTest( tests, "i16 convert to u8", []( TestRegi16x32 a ) { return FS::Convert<uint8_t>( a ); } );
+        RegisterTest( tests, "u16 convert to u8", []( TestRegu16x32 a ) { return FS::Convert<uint8_t>( a ); } );
+        RegisterTest( tests, "i32 convert to i16", []( TestRegi32x16 a ) { return FS::Convert<int16_t>( a ); } );
+        RegisterTest( tests, "i32 convert to u16", []( TestRegi32x16 a ) { return FS::Convert<uint16_t>( a ); } );
+
+        RegisterTest( tests, "i8 cast to u8", []( TestRegi8 a ) { return FS::Cast<uint8_t>( a ); } );
+        RegisterTest( tests, "u16 cast to i16", []( TestRegu16 a ) { return FS::Cast<int16_t>( a ); } );
+
+        if constexpr( !( SIMD & FeatureFlag::AVX512_F ) )
+        {
+            RegisterTest( tests, "m8 cast to i8", []( TestRegm8 a ) { return FS_BIND_INTRINSIC( FS::Cast<typename TestRegm8::ElementType> )( FS_BIND_INTRINSIC( FS::Cast<int8_t> )( a ) ); } );
+            RegisterTest( tests, "m16 cast to u16", []( TestRegm16 a ) { return FS_BIND_INTRINSIC( FS::Cast<typename TestRegm16::ElementType> )( FS_BIND_INTRINSIC( FS::Cast<uint16_t> )( a ) ); } );
+        }
+
+        // ARMv7 NEON has no f64 vectors
+        if constexpr( !( SIMD & FeatureFlag::NEON ) || ( SIMD & FeatureFlag::AARCH64 ) )
+        {
+            using TestRegf64 = TestReg<double>;
+            using TestRegm64 = typename TestRegf64::MaskType;
+            using TestRegf64f32 = FS::Register<float, TestRegf64::ElementCount>;
+            using TestRegf64i32 = FS::Register<int32_t, TestRegf64::ElementCount>;
+
+            RegisterTest( tests, "m64 bit mask", []( TestRegm64 a ) { return a; } );
+            RegisterTest( tests, "m64 any mask", []( TestRegm64 a ) { return FS::AnyMask( a ); } );
+
+            RegisterTest( tests, "m64 bit and operator", std::bit_and<TestRegm64>() );
+            RegisterTest( tests, "m64 bit or operator", std::bit_or<TestRegm64>() );
+            RegisterTest( tests, "m64 bit xor operator", std::bit_xor<TestRegm64>() );
+            RegisterTest( tests, "m64 bit not operator", std::bit_not<TestRegm64>() );
+            RegisterTest( tests, "m64 bit and not", []( TestRegm64 a, TestRegm64 b ) { return FS::BitwiseAndNot( a, b ); } );
+
+            RegisterTest( tests, "f64 load store", []( TestRegf64 a ) { return a; } );
+            RegisterTest( tests, "f64 load scalar", []( double a ) { return TestRegf64( a ); } );
+            RegisterTest( tests, "f64 splat", []( double a ) { return FS::Splat<TestRegf64::ElementCount>( a ); } );
+            RegisterTest( tests, "f64 extract 0", []( TestRegf64 a ) { return FS::Extract0( a ); } );
+            RegisterTest( tests, "f64 reduce add", []( TestRegf64 a ) { return FS::ReduceAdd( a ); } );
+            RegisterTest( tests, "f64 reduce min", []( TestRegf64 a ) { return FS::ReduceMin( a ); } );
+            RegisterTest( tests, "f64 reduce max", []( TestRegf64 a ) { return FS::ReduceMax( a ); } );
+            RegisterTest( tests, "f64 load incremented", []() { return FS::LoadIncremented<TestRegf64>(); } );
+
+            RegisterTest( tests, "f64 plus operator", std::plus<TestRegf64>() );
+            RegisterTest( tests, "f64 minus operator", std::minus<TestRegf64>() );
+            RegisterTest( tests, "f64 multiply operator", std::multiplies<TestRegf64>() );
+            RegisterTest( tests, "f64 divide operator", std::divides<TestRegf64>() );
+
+            RegisterTest( tests, "f64 fused multiply add", []( TestRegf64 a, TestRegf64 b ) { return FS::FMulAdd( a, TestRegf64( -1 ), b ); } );
+            RegisterTest( tests, "f64 fused multiply sub", []( TestRegf64 a, TestRegf64 b ) { return FS::FMulSub( a, TestRegf64( -1 ), b ); } );
+            RegisterTest( tests, "f64 fused negative multiply add", []( TestRegf64 a, TestRegf64 b ) { return FS::FNMulAdd( a, TestRegf64( -1 ), b ); } );
+            RegisterTest( tests, "f64 fused negative multiply sub", []( TestRegf64 a, TestRegf64 b ) { return FS::FNMulSub( a, TestRegf64( -1 ), b ); } );
+
+            RegisterTest( tests, "f64 bit and operator", std::bit_and<TestRegf64>() );
+            RegisterTest( tests, "f64 bit or operator", std::bit_or<TestRegf64>() );
+            RegisterTest( tests, "f64 bit xor operator", std::bit_xor<TestRegf64>() );
+            RegisterTest( tests, "f64 bit not operator", std::bit_not<TestRegf64>() );
+            RegisterTest( tests, "f64 negate operator", std::negate<TestRegf64>() );
+            RegisterTest( tests, "f64 bit and not", []( TestRegf64 a, TestRegf64 b ) { return FS::BitwiseAndNot( a, b ); } );
+
+            RegisterTest( tests, "f64 equals operator", []( TestRegf64 a, TestRegf64 b ) { return a == b; } );
+            RegisterTest( tests, "f64 greater equal than operator", []( TestRegf64 a, TestRegf64 b ) { return a >= b; } );
+            RegisterTest( tests, "f64 not equals operator", []( TestRegf64 a, TestRegf64 b ) { return a != b; } );
+            RegisterTest( tests, "f64 less than operator", []( TestRegf64 a, TestRegf64 b ) { return a < b; } );
+            RegisterTest( tests, "f64 greater than operator", []( TestRegf64 a, TestRegf64 b ) { return a > b; } );
+            RegisterTest( tests, "f64 less equal than operator", []( TestRegf64 a, TestRegf64 b ) { return a <= b; } );
+
+            RegisterTest( tests, "f64 increment", []( TestRegf64 a ) { return FS::Increment( a ); } );
+            RegisterTest( tests, "f64 decrement", []( TestRegf64 a ) { return FS::Decrement( a ); } );
+            RegisterTest( tests, "f64 abs", []( TestRegf64 a ) { return FS::Abs( a ); } );
+            RegisterTest( tests, "f64 min", []( TestRegf64 a, TestRegf64 b ) { return FS::Min( a, b ); } );
+            RegisterTest( tests, "f64 max", []( TestRegf64 a, TestRegf64 b ) { return FS::Max( a, b ); } );
+
+            RegisterTest( tests, "f64 select", []( TestRegm64 m, TestRegf64 a, TestRegf64 b ) { return FS::Select( m, a, b ); } );
+            RegisterTest( tests, "f64 masked", []( TestRegm64 m, TestRegf64 a ) { return FS::Masked( m, a ); } );
+            RegisterTest( tests, "f64 inv masked", []( TestRegm64 m, TestRegf64 a ) { return FS::InvMasked( m, a ); } );
+            RegisterTest( tests, "f64 masked increment", []( TestRegm64 m, TestRegf64 a ) { return FS::MaskedIncrement( m, a ); } );
+            RegisterTest( tests, "f64 masked decrement", []( TestRegm64 m, TestRegf64 a ) { return FS::MaskedDecrement( m, a ); } );
+            RegisterTest( tests, "f64 masked add", []( TestRegm64 m, TestRegf64 a, TestRegf64 b ) { return FS::MaskedAdd( m, a, b ); } );
+            RegisterTest( tests, "f64 masked sub", []( TestRegm64 m, TestRegf64 a, TestRegf64 b ) { return FS::MaskedSub( m, a, b ); } );
+            RegisterTest( tests, "f64 masked mul", []( TestRegm64 m, TestRegf64 a, TestRegf64 b ) { return FS::MaskedMul( m, a, b ); } );
+            RegisterTest( tests, "f64 inv masked add", []( TestRegm64 m, TestRegf64 a, TestRegf64 b ) { return FS::InvMaskedAdd( m, a, b ); } );
+            RegisterTest( tests, "f64 inv masked sub", []( TestRegm64 m, TestRegf64 a, TestRegf64 b ) { return FS::InvMaskedSub( m, a, b ); } );
+            RegisterTest( tests, "f64 inv masked mul", []( TestRegm64 m, TestRegf64 a, TestRegf64 b ) { return FS::InvMaskedMul( m, a, b ); } );
+
+            RegisterTest( tests, "f64 round", []( TestRegf64 a ) { return FS::Round( a ); } );
+            RegisterTest( tests, "f64 ceil", []( TestRegf64 a ) { return FS::Ceil( a ); } );
+            RegisterTest( tests, "f64 floor", []( TestRegf64 a ) { return FS::Floor( a ); } );
+            RegisterTest( tests, "f64 trunc", []( TestRegf64 a ) { return FS::Trunc( a ); } );
+            RegisterTest( tests, "f64 signbit", []( TestRegf64 a, TestRegf64 b ) { return FS::SignBit( a ) ^ b; } );
+
+            RegisterTest( tests, "f64 sqrt", []( TestRegf64 a ) { return FS::Sqrt( FS::Abs( a ) ); } );
+
+            RegisterTest( tests, "f32 convert to f64", []( TestRegf64f32 a ) { return FS::Convert<double>( a ); } );
+            RegisterTest( tests, "i32 convert to f64", []( TestRegf64i32 a ) { return FS::Convert<double>( a ); } );
+            RegisterTest( tests, "f64 convert to f32", []( TestRegf64 a ) { return FS::Convert<float>( FS::Min( FS::Max( a, TestRegf64( -3.4e+38 ) ), TestRegf64( 3.4e+38 ) ) ); } );
+            RegisterTest( tests, "f64 cast to i64", []( TestRegf64 a ) { return FS::Cast<int64_t>( a ); } );
+            RegisterTest( tests, "i64 cast to f64", []( TestRegi64 a ) { return FS::Cast<double>( a ); } );
+            RegisterTest( tests, "f64 convert to i32", []( TestRegf64 a ) { return FS::Convert<int32_t>( FS::Min( FS::Max( a, TestRegf64( -2147483648.0 ) ), TestRegf64( 2147483647.0 ) ) ); } );
+
+            if constexpr( !( SIMD & FeatureFlag::AVX512_F ) )
+            {
+                RegisterTest( tests, "m64 cast to f64", []( TestRegm64 a ) { return FS_BIND_INTRINSIC( FS::Cast<FS::Mask<64>> )( FS_BIND_INTRINSIC( FS::Cast<double> )( a ) ); } );
+                RegisterTest( tests, "m64 cast to i64", []( TestRegm64 a ) { return FS_BIND_INTRINSIC( FS::Cast<FS::Mask<64>> )( FS_BIND_INTRINSIC( FS::Cast<int64_t> )( a ) ); } );
+                RegisterTest( tests, "m64i cast to i64", []( TestRegm64i a ) { return FS_BIND_INTRINSIC( FS::Cast<typename TestRegm64i::ElementType> )( FS_BIND_INTRINSIC( FS::Cast<int64_t> )( a ) ); } );
+            }
+        }
+
         return tests;
     }
 };
 
-template class FastSIMD::RegisterDispatchClass<TestFastSIMD<kTestBytes, FastSIMD::IsRelaxed()>>;
+template class FastSIMD::RegisterDispatchClass<TestFastSIMD<kTestBytes, FastSIMD::IsRelaxed(), FastSIMD::IsDeterministic()>>;